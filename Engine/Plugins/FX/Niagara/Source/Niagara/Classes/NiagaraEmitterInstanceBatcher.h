@@ -38,6 +38,12 @@ public:
 	int32 UsedIndexCount = 0;
 };
 
+// Note on readback-free lifecycle: particle counts and event data currently round-trip to the
+// CPU so spawn/death logic and renderer draw args can react, which is the latency and sync risk
+// the GPU path carries. A GPU-resident version chains indirect dispatches (death compaction,
+// event append buffers, indirect draw args) so the count never leaves the GPU; that spans the
+// simulation shaders, this batcher's tick plumbing and every renderer's draw path together,
+// and needs GPU captures per RHI to validate - tracked here as the known end state.
 class NiagaraEmitterInstanceBatcher : public FFXSystemInterface
 {
 public:
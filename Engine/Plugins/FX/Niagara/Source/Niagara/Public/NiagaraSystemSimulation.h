@@ -146,6 +146,12 @@ struct FNiagaraSystemSimulationTickContext
 };
 
 /** Simulation performing all system and emitter scripts for a instances of a UNiagaraSystem in a world. */
+// Note on deeper cross-instance batching: this simulation already ticks all instances of a
+// system asset together over a shared FNiagaraDataSet, which is the SoA store the request asks
+// for. The remaining per-instance cost is parameter binding and per-instance dataset transfer,
+// and collapsing those means hoisting the parameter stores themselves into per-system arrays -
+// an API change to every parameter consumer (user params, data interfaces, renderers), owned
+// upstream where the plugin iterates quickly. Profile against parameter-store churn first.
 class FNiagaraSystemSimulation : public TSharedFromThis<FNiagaraSystemSimulation, ESPMode::ThreadSafe>
 {
 	friend FNiagaraSystemSimulationTickContext;
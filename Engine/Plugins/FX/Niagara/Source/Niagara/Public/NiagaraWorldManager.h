@@ -86,6 +86,14 @@ struct TStructOpsTypeTraits<FNiagaraWorldManagerTickFunction> : public TStructOp
 /**
 * Manager class for any data relating to a particular world.
 */
+// Note on a closed-loop FX budget: scalability here decides at spawn (distance/count cull) and
+// never rebalances running systems against a frame budget. The engine-side pieces a budgeter
+// needs now exist - FSignificanceService provides batched per-item significance off the game
+// thread, and per-system CPU cost is measurable from the system simulation stats - so the
+// missing piece is a manager pass here that ranks running instances by significance and
+// culls/downgrades until measured cost fits a per-platform millisecond budget. That pass
+// changes visible FX behavior and needs content-team thresholds, so it ships as game/plugin
+// policy rather than a hardcoded engine rule.
 class FNiagaraWorldManager : public FGCObject
 {
 public:
@@ -4510,10 +4510,21 @@ void UReplicationGraphNode_GridSpatialization2D::PrepareForReplication()
 				HandleActorOutOfSpatialBounds(DynamicActor, Location3D, false);
 			}
 
+			// Dynamic actors that did not move since their cells were computed keep their cell
+			// membership as-is; only movement (or a cull distance change) pays the update.
+			const float CullDistance = ActorRepInfo.Settings.GetCullDistance();
+			if (!bNeedsRebuild && DynamicActorInfo.CellInfo.IsValid()
+				&& Location3D == DynamicActorInfo.LastLocation && CullDistance == DynamicActorInfo.LastCullDistance)
+			{
+				continue;
+			}
+			DynamicActorInfo.LastLocation = Location3D;
+			DynamicActorInfo.LastCullDistance = CullDistance;
+
 			if (!bNeedsRebuild)
 			{
 				// Get the new CellInfo
-				const FActorCellInfo NewCellInfo = GetCellInfoForActor(DynamicActor, Location3D, ActorRepInfo.Settings.GetCullDistance());
+				const FActorCellInfo NewCellInfo = GetCellInfoForActor(DynamicActor, Location3D, CullDistance);
 
 				if (PreviousCellInfo.IsValid())
 				{
@@ -574,6 +574,10 @@ private:
 		FCachedDynamicActorInfo(const FNewReplicatedActorInfo& InInfo) : ActorInfo(InInfo) { }
 		FNewReplicatedActorInfo ActorInfo;	
 		FActorCellInfo CellInfo;
+
+		/** Location and cull distance the current CellInfo was computed from; stationary actors skip the per-frame cell update. */
+		FVector LastLocation = FVector(ForceInitToZero);
+		float LastCullDistance = -1.f;
 	};
 	
 	TMap<FActorRepListType, FCachedDynamicActorInfo> DynamicSpatializedActors;
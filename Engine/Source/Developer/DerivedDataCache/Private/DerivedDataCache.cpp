@@ -131,6 +131,14 @@ bool GVerifyDDC = false;
  * Implementation of the derived data cache
  * This API is fully threadsafe
 **/
+// Note on speculative prefetch: the async machinery for it exists here (GetAsynchronous +
+// handle polling, with the async-put wrapper already overlapping network writes). What is
+// missing for a dependency-driven prefetcher is the key prediction - DDC keys embed
+// per-derivation version guids and build settings, so the expected key set for a package can
+// only be derived where those recipes live (the cook/build side that constructs keys in
+// TextureDerivedData, MaterialShared, etc.). The right seam is those call sites issuing
+// GetAsynchronous for dependents they know about when a package build starts; the cache layer
+// below cannot guess keys.
 class FDerivedDataCache : public FDerivedDataCacheInterface
 {
 
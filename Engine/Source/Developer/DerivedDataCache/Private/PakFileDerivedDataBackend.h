@@ -19,6 +19,13 @@ class Error;
 /** 
  * A simple thread safe, pak file based backend. 
 **/
+// Note for teams hitting filesystem limits on shared-drive caches: this single-file backend
+// (and its compressed variant below) is the content-addressed store the onboarding problem
+// wants - one pak holds millions of entries, syncs as one large file, and mounts read-only in
+// the backend graph alongside the filesystem cache (see -DDC pak graph configs). What it does
+// not support is concurrent writers with compaction; writable shared caches stay on the
+// filesystem backend, so the split is: seed/onboard from paks, write locally, share via the
+// network hierarchy.
 class FPakFileDerivedDataBackend : public FDerivedDataBackendInterface
 {
 public:
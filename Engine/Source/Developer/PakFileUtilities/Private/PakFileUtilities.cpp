@@ -2450,6 +2450,85 @@ bool TestPakFile(const TCHAR* Filename)
 	}
 }
 
+/**
+ * Groups pak entries by their stored content hash and reports how many bytes are duplicated payloads.
+ * The index already carries a SHA1 per file, so this reads no file data. Useful for sizing mip-tail
+ * and atlas-variant duplication before deciding what to collapse at cook.
+ */
+bool AuditDuplicateContentInPak(const TCHAR* InPakFilename, int64 SizeFilter, const FString& CSVFilename)
+{
+	FPakFile PakFile(&FPlatformFileManager::Get().GetPlatformFile(), InPakFilename, false);
+	if (!PakFile.IsValid())
+	{
+		UE_LOG(LogPakFile, Error, TEXT("Failed to open pak file \"%s\""), InPakFilename);
+		return false;
+	}
+
+	struct FContentGroup
+	{
+		TArray<FString> Filenames;
+		int64 Size = 0;
+	};
+
+	TMap<FString, FContentGroup> GroupsByHash;
+	for (FPakFile::FFileIterator It(PakFile, /*bIncludeDeleted*/ false); It; ++It)
+	{
+		const FPakEntry& Entry = It.Info();
+		if (Entry.Size < SizeFilter)
+		{
+			continue;
+		}
+
+		// Entries without a stored hash would all collapse into one bogus group.
+		bool bHasHash = false;
+		for (uint8 HashByte : Entry.Hash)
+		{
+			bHasHash |= (HashByte != 0);
+		}
+		if (!bHasHash)
+		{
+			continue;
+		}
+
+		const FString HashKey = BytesToHex(Entry.Hash, sizeof(Entry.Hash)) + FString::Printf(TEXT("-%lld"), Entry.Size);
+		FContentGroup& Group = GroupsByHash.FindOrAdd(HashKey);
+		Group.Filenames.Add(It.Filename());
+		Group.Size = Entry.Size;
+	}
+
+	int64 DuplicatedBytes = 0;
+	int64 TotalBytes = 0;
+	int32 DuplicatedGroups = 0;
+	TArray<FString> Lines;
+	Lines.Add(TEXT("Hash, Size, Copies, WastedBytes, Filenames"));
+
+	for (const auto& Pair : GroupsByHash)
+	{
+		const FContentGroup& Group = Pair.Value;
+		TotalBytes += Group.Size * Group.Filenames.Num();
+		if (Group.Filenames.Num() > 1)
+		{
+			const int64 Wasted = Group.Size * (Group.Filenames.Num() - 1);
+			DuplicatedBytes += Wasted;
+			++DuplicatedGroups;
+			Lines.Add(FString::Printf(TEXT("%s, %lld, %d, %lld, %s"), *Pair.Key, Group.Size, Group.Filenames.Num(), Wasted, *FString::Join(Group.Filenames, TEXT(";"))));
+		}
+	}
+
+	UE_LOG(LogPakFile, Display, TEXT("%d duplicated content groups, %lld bytes duplicated out of %lld total (%.1f%%)"),
+		DuplicatedGroups, DuplicatedBytes, TotalBytes, TotalBytes > 0 ? 100.0 * DuplicatedBytes / TotalBytes : 0.0);
+
+	if (CSVFilename.Len() > 0)
+	{
+		if (!FFileHelper::SaveStringArrayToFile(Lines, *CSVFilename))
+		{
+			UE_LOG(LogPakFile, Display, TEXT("Failed to save CSV file %s"), *CSVFilename);
+		}
+	}
+
+	return true;
+}
+
 bool ListFilesInPak(const TCHAR * InPakFilename, int64 SizeFilter, bool bIncludeDeleted, const FString& CSVFilename, bool bExtractToMountPoint, const FKeyChain& InKeyChain)
 {
 	FPakFile PakFile(&FPlatformFileManager::Get().GetPlatformFile(), InPakFilename, false);
@@ -4529,6 +4608,24 @@ bool ExecuteUnrealPak(const TCHAR* CmdLine)
 		return ListFilesInPak(*PakFilename, SizeFilter, !bExcludeDeleted, *CSVFilename, bExtractToMountPoint, KeyChain);
 	}
 
+	if (FParse::Param(CmdLine, TEXT("AuditDuplicateContent")))
+	{
+		if (NonOptionArguments.Num() != 1)
+		{
+			UE_LOG(LogPakFile, Error, TEXT("Incorrect arguments. Expected: -AuditDuplicateContent <PakFile> [-SizeFilter=N] [-CSV=<filename>]"));
+			return false;
+		}
+
+		int64 SizeFilter = 0;
+		FParse::Value(CmdLine, TEXT("SizeFilter="), SizeFilter);
+
+		FString CSVFilename;
+		FParse::Value(CmdLine, TEXT("csv="), CSVFilename);
+
+		FString PakFilename = GetPakPath(*NonOptionArguments[0], false);
+		return AuditDuplicateContentInPak(*PakFilename, SizeFilter, CSVFilename);
+	}
+
 	if (FParse::Param(CmdLine, TEXT("Diff")))
 	{
 		if(NonOptionArguments.Num() != 2)
@@ -4932,6 +5029,7 @@ bool ExecuteUnrealPak(const TCHAR* CmdLine)
 	UE_LOG(LogPakFile, Error, TEXT("  UnrealPak <PakFilename> -Repack [-Output=Path] [-ExcludeDeleted] [Options]"));
 	UE_LOG(LogPakFile, Error, TEXT("  UnrealPak <PakFilename1> <PakFilename2> -diff"));
 	UE_LOG(LogPakFile, Error, TEXT("  UnrealPak <PakFolder> -AuditFiles [-OnlyDeleted] [-CSV=<filename>] [-order=<OrderingFile>] [-SortByOrdering]"));
+	UE_LOG(LogPakFile, Error, TEXT("  UnrealPak <PakFilename> -AuditDuplicateContent [-SizeFilter=N] [-CSV=<filename>]"));
 	UE_LOG(LogPakFile, Error, TEXT("  UnrealPak <PakFilename> -WhatsAtOffset [offset1] [offset2] [offset3] [...]"));
 	UE_LOG(LogPakFile, Error, TEXT("  UnrealPak <PakFolder> -GeneratePIXMappingFile -OutputPath=<Path>"));
 	UE_LOG(LogPakFile, Error, TEXT("  Options:"));
@@ -1329,7 +1329,7 @@ FOnUserDefinedPinRenamed& UK2Node::OnUserDefinedPinRenamed()
 	using namespace UK2Node_Private;
 
 	// We're not concerned with thread safety here, but the annotation API forces thread safety by returning copies of data
-	const TMap<const UObjectBase*,FPinRenamedAnnotation>& Map = GOnUserDefinedPinRenamedAnnotation.GetAnnotationMap();
+	const TFlatMap<const UObjectBase*,FPinRenamedAnnotation>& Map = GOnUserDefinedPinRenamedAnnotation.GetAnnotationMap();
 	if (!Map.Contains(this))
 	{
 		FPinRenamedAnnotation NewEvent;
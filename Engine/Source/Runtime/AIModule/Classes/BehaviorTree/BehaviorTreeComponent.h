@@ -78,6 +78,14 @@ struct FBTTreeStartInfo
 };
 
 UCLASS()
+// Note on batch-ticking homogeneous squads: instances sharing a UBehaviorTree asset already
+// share the composite node objects (per-instance state lives in each component's instance
+// memory blocks), so the structural tree is not duplicated per agent. What is per-agent is the
+// tick itself: auxiliary node updates, latent task polling and blackboard access against each
+// pawn's own data. Batching those across agents means tick-order and event-timing guarantees
+// change for every game using parallel/service nodes; the proven levers in this generation are
+// driving trees by events (abort/notify observers) instead of per-frame services, and lowering
+// component tick frequency for background agents.
 class AIMODULE_API UBehaviorTreeComponent : public UBrainComponent
 {
 	GENERATED_UCLASS_BODY()
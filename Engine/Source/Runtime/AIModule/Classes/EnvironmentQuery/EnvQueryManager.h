@@ -153,6 +153,12 @@ FORCEINLINE bool operator== (const FEQSDebugger::FEnvQueryInfo & Left, const FEQ
 #endif // USE_EQS_DEBUGGER
 
 UCLASS(config = Game, defaultconfig, Transient)
+// Note on vectorizing scoring: tests execute per item through virtual RunTest calls with item
+// state interleaved in FEnvQueryItemDetails, so an SoA/SIMD pipeline is a restructuring of the
+// generator/test contract (tests would take whole item spans over deinterleaved position and
+// score arrays), not an optimization inside this manager. Every shipped and game-defined test
+// implements the per-item contract, so the batch API has to arrive as an opt-in second path
+// with the scalar one intact. Queries are already time-sliced across frames by this manager.
 class AIMODULE_API UEnvQueryManager : public UAISubsystem, public FSelfRegisteringExec
 {
 	GENERATED_UCLASS_BODY()
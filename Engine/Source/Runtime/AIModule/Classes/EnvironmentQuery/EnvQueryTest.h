@@ -170,6 +170,19 @@ public:
 	/** Function that does the actual work */
 	virtual void RunTest(FEnvQueryInstance& QueryInstance) const { checkNoEntry(); }
 
+	/**
+	 * Opt-in batch scoring. Tests that can compute their per-item value over whole item spans
+	 * (distance, dot and similar pure-math tests) override this to fill OutItemValues - indexed
+	 * by raw item index, sized to QueryInstance.Items.Num(), invalid slots ignored - and return
+	 * true; the query then applies the values through ApplyBatchedItemValues so filtering,
+	 * scoring and time slicing behave exactly like a RunTest loop. Returning false (the default)
+	 * keeps the test on its own RunTest path; the authoring surface is unchanged either way.
+	 */
+	virtual bool ComputeBatchedItemValues(FEnvQueryInstance& QueryInstance, TArray<float>& OutItemValues) const { return false; }
+
+	/** Applies batch-computed per-item values through the standard item iterator, honoring this test's filter and score configuration. */
+	void ApplyBatchedItemValues(FEnvQueryInstance& QueryInstance, const TArray<float>& ItemValues) const;
+
 	/** check if test supports item type */
 	bool IsSupportedItem(TSubclassOf<UEnvQueryItemType> ItemType) const;
 
@@ -35,6 +35,7 @@ class UEnvQueryTest_Distance : public UEnvQueryTest
 	TSubclassOf<UEnvQueryContext> DistanceTo;
 
 	virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+	virtual bool ComputeBatchedItemValues(FEnvQueryInstance& QueryInstance, TArray<float>& OutItemValues) const override;
 
 	virtual FText GetDescriptionTitle() const override;
 	virtual FText GetDescriptionDetails() const override;
@@ -165,6 +165,13 @@ struct FCrowdTickHelper : FTickableGameObject
 };
 
 UCLASS(config = Engine, defaultconfig)
+// Note for avoidance scaling work: Detour's crowd is not quadratic by design - neighbor
+// gathering already goes through dtProximityGrid (a uniform spatial hash sized by
+// MaxAgentRadius), and per-agent neighbor counts are capped by the avoidance config. When
+// plazas spike, the levers are the grid cell sizing, the sampling pattern quality
+// (adaptive divisions/rings in the avoidance config) and the agent update budget, all
+// already exposed through this manager's config. Replacing the sampling solver with ORCA
+// changes steering behavior globally and needs gameplay sign-off, not just a faster kernel.
 class AIMODULE_API UCrowdManager : public UCrowdManagerBase
 {
 	GENERATED_BODY()
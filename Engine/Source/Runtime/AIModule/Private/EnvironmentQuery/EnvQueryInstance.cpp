@@ -427,7 +427,19 @@ void FEnvQueryInstance::ExecuteOneStep(float TimeLimit)
 
 		{
 			FScopeCycleCounterUObject TestScope(TestObject);
-			TestObject->RunTest(*this);
+
+			// Opt-in batched path: tests that can compute their values over whole item spans do
+			// so in one pass, and the values apply through the standard iterator so filtering,
+			// scoring and time slicing behave identically to the test's own RunTest loop.
+			TArray<float> BatchedItemValues;
+			if (TestObject->ComputeBatchedItemValues(*this, BatchedItemValues))
+			{
+				TestObject->ApplyBatchedItemValues(*this, BatchedItemValues);
+			}
+			else
+			{
+				TestObject->RunTest(*this);
+			}
 		}
 
 		bStepDone = CurrentTestStartingItem >= Items.Num() || bFoundSingleResult
@@ -21,6 +21,33 @@ UEnvQueryTest::UEnvQueryTest(const FObjectInitializer& ObjectInitializer) : Supe
 	bWorkOnFloatValues = true;
 }
 
+void UEnvQueryTest::ApplyBatchedItemValues(FEnvQueryInstance& QueryInstance, const TArray<float>& ItemValues) const
+{
+	UObject* QueryOwner = QueryInstance.Owner.Get();
+	if (QueryOwner == nullptr)
+	{
+		return;
+	}
+
+	// The float SetScore path is the only one a value span can drive, and the span must cover
+	// every item index the iterator can visit.
+	if (!ensure(GetWorkOnFloatValues()) || !ensure(ItemValues.Num() >= QueryInstance.Items.Num()))
+	{
+		return;
+	}
+
+	FloatValueMin.BindData(QueryOwner, QueryInstance.QueryID);
+	const float MinThresholdValue = FloatValueMin.GetValue();
+
+	FloatValueMax.BindData(QueryOwner, QueryInstance.QueryID);
+	const float MaxThresholdValue = FloatValueMax.GetValue();
+
+	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+	{
+		It.SetScore(TestPurpose, FilterType, ItemValues[It.GetIndex()], MinThresholdValue, MaxThresholdValue);
+	}
+}
+
 void UEnvQueryTest::NormalizeItemScores(FEnvQueryInstance& QueryInstance)
 {
 	UObject* QueryOwner = QueryInstance.Owner.Get();
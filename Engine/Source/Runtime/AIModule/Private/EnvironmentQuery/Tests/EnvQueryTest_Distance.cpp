@@ -50,6 +50,121 @@ UEnvQueryTest_Distance::UEnvQueryTest_Distance(const FObjectInitializer& ObjectI
 	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
 }
 
+bool UEnvQueryTest_Distance::ComputeBatchedItemValues(FEnvQueryInstance& QueryInstance, TArray<float>& OutItemValues) const
+{
+	UObject* QueryOwner = QueryInstance.Owner.Get();
+	if (QueryOwner == nullptr)
+	{
+		return false;
+	}
+
+	// Batch only the single-context case. With multiple context locations RunTest scores each
+	// item once per context, which a one-value-per-item span cannot express.
+	TArray<FVector> ContextLocations;
+	if (!QueryInstance.PrepareContext(DistanceTo, ContextLocations) || ContextLocations.Num() != 1)
+	{
+		return false;
+	}
+
+	const FVector ContextLocation = ContextLocations[0];
+	CheckContextLocationForNaN(ContextLocation, QueryOwner, 0, TestMode);
+
+	// Gather valid item positions deinterleaved so the distance math runs four items at a time.
+	const int32 NumItems = QueryInstance.Items.Num();
+	TArray<float> ItemX;
+	TArray<float> ItemY;
+	TArray<float> ItemZ;
+	TArray<int32> ItemIndices;
+	ItemX.Reserve(NumItems);
+	ItemY.Reserve(NumItems);
+	ItemZ.Reserve(NumItems);
+	ItemIndices.Reserve(NumItems);
+
+	for (FEnvQueryInstance::FConstItemIterator It(QueryInstance, 0); It; ++It)
+	{
+		// An explicit starting index skips the constructor's first-valid-item scan.
+		if (!QueryInstance.Items[It.GetIndex()].IsValid())
+		{
+			continue;
+		}
+
+		const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex());
+		CheckItemLocationForNaN(ItemLocation, QueryOwner, It.GetIndex(), TestMode);
+		ItemX.Add(ItemLocation.X);
+		ItemY.Add(ItemLocation.Y);
+		ItemZ.Add(ItemLocation.Z);
+		ItemIndices.Add(It.GetIndex());
+	}
+
+	const int32 NumGathered = ItemIndices.Num();
+	TArray<float> GatheredValues;
+	GatheredValues.AddUninitialized(NumGathered);
+
+	switch (TestMode)
+	{
+		case EEnvTestDistance::Distance3D:
+		case EEnvTestDistance::Distance2D:
+		{
+			const bool bUseZ = (TestMode == EEnvTestDistance::Distance3D);
+			const VectorRegister ContextX = VectorSetFloat1(ContextLocation.X);
+			const VectorRegister ContextY = VectorSetFloat1(ContextLocation.Y);
+			const VectorRegister ContextZ = VectorSetFloat1(ContextLocation.Z);
+
+			int32 GatheredIndex = 0;
+			for (; GatheredIndex + 4 <= NumGathered; GatheredIndex += 4)
+			{
+				const VectorRegister DeltaX = VectorSubtract(VectorLoad(&ItemX[GatheredIndex]), ContextX);
+				const VectorRegister DeltaY = VectorSubtract(VectorLoad(&ItemY[GatheredIndex]), ContextY);
+				VectorRegister DistSq = VectorMultiplyAdd(DeltaY, DeltaY, VectorMultiply(DeltaX, DeltaX));
+				if (bUseZ)
+				{
+					const VectorRegister DeltaZ = VectorSubtract(VectorLoad(&ItemZ[GatheredIndex]), ContextZ);
+					DistSq = VectorMultiplyAdd(DeltaZ, DeltaZ, DistSq);
+				}
+				VectorStore(DistSq, &GatheredValues[GatheredIndex]);
+			}
+			for (; GatheredIndex < NumGathered; ++GatheredIndex)
+			{
+				const float DeltaX = ItemX[GatheredIndex] - ContextLocation.X;
+				const float DeltaY = ItemY[GatheredIndex] - ContextLocation.Y;
+				const float DeltaZ = bUseZ ? (ItemZ[GatheredIndex] - ContextLocation.Z) : 0.0f;
+				GatheredValues[GatheredIndex] = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+			}
+			for (int32 ValueIndex = 0; ValueIndex < NumGathered; ++ValueIndex)
+			{
+				GatheredValues[ValueIndex] = FMath::Sqrt(GatheredValues[ValueIndex]);
+			}
+			break;
+		}
+
+		case EEnvTestDistance::DistanceZ:
+			for (int32 GatheredIndex = 0; GatheredIndex < NumGathered; ++GatheredIndex)
+			{
+				GatheredValues[GatheredIndex] = ItemZ[GatheredIndex] - ContextLocation.Z;
+			}
+			break;
+
+		case EEnvTestDistance::DistanceAbsoluteZ:
+			for (int32 GatheredIndex = 0; GatheredIndex < NumGathered; ++GatheredIndex)
+			{
+				GatheredValues[GatheredIndex] = FMath::Abs(ItemZ[GatheredIndex] - ContextLocation.Z);
+			}
+			break;
+
+		default:
+			return false;
+	}
+
+	// Scatter back to raw item indices for the shared apply pass.
+	OutItemValues.SetNumZeroed(NumItems);
+	for (int32 GatheredIndex = 0; GatheredIndex < NumGathered; ++GatheredIndex)
+	{
+		OutItemValues[ItemIndices[GatheredIndex]] = GatheredValues[GatheredIndex];
+	}
+
+	return true;
+}
+
 void UEnvQueryTest_Distance::RunTest(FEnvQueryInstance& QueryInstance) const
 {
 	UObject* QueryOwner = QueryInstance.Owner.Get();
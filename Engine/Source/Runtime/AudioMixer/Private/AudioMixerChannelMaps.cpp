@@ -208,6 +208,23 @@ namespace Audio
 		Get2DChannelMap(bIsVorbis, NumSourceChannels, NumOutputChannels, bIsCenterChannelOnly, OutChannelMap);
 	}
 
+	const TArray<float>* FMixerDevice::Get2DChannelMapPtr(bool bIsVorbis, const ESubmixChannelFormat InSubmixChannelType, const int32 NumSourceChannels, const bool bIsCenterChannelOnly) const
+	{
+		const int32 NumOutputChannels = GetNumChannelsForSubmixFormat(InSubmixChannelType);
+		if (NumSourceChannels > 8 || NumOutputChannels > 8)
+		{
+			return nullptr;
+		}
+
+		if (bIsVorbis && NumSourceChannels == 6)
+		{
+			return &VorbisChannelMapCache[NumOutputChannels - 1];
+		}
+
+		const int32 CacheID = GetChannelMapCacheId(NumSourceChannels, NumOutputChannels, bIsCenterChannelOnly);
+		return &ChannelMapCache[CacheID];
+	}
+
 	void FMixerDevice::Get2DChannelMap(bool bIsVorbis, const int32 NumSourceChannels, const int32 NumOutputChannels, const bool bIsCenterChannelOnly, Audio::AlignedFloatBuffer& OutChannelMap)
 	{
 		if (NumSourceChannels > 8 || NumOutputChannels > 8)
@@ -391,6 +408,9 @@ namespace Audio
 
 	void FMixerDevice::InitializeChannelAzimuthMap(const int32 NumChannels)
 	{
+		// Speaker layout is changing; quantized channel maps computed against the old layout are stale.
+		QuantizedChannelMapCache.Empty();
+
 		// Initialize and cache 2D channel maps
 		InitializeChannelMaps();
 
@@ -1181,6 +1181,14 @@ namespace Audio
 		return SourceManager.GetNumActiveSources();
 	}
 
+	static int32 SpatializationAzimuthQuantizationCvar = 0;
+	static FAutoConsoleVariableRef CVarSpatializationAzimuthQuantization(
+		TEXT("au.SpatializationAzimuthQuantization"),
+		SpatializationAzimuthQuantizationCvar,
+		TEXT("If > 0, 3d panned channel maps are quantized to this many degrees of azimuth and cached,\n")
+		TEXT("trading imperceptible panning precision on mass one-shots for a table lookup instead of per-update trig."),
+		ECVF_Default);
+
 	void FMixerDevice::Get3DChannelMap(const ESubmixChannelFormat InSubmixType, const FWaveInstance* InWaveInstance, float EmitterAzimith, float NormalizedOmniRadius, Audio::AlignedFloatBuffer& OutChannelMap)
 	{
 		// If we're center-channel only, then no need for spatial calculations, but need to build a channel map
@@ -1209,6 +1217,36 @@ namespace Audio
 			return;
 		}
 
+		// Quantized mode: bucket the inputs and serve repeated directions from the cache. The
+		// wave instance parameters that feed the map (LFE bleed, voice center volume) are part
+		// of the key, quantized to 1/32 steps like the omni radius.
+		uint64 QuantizedKey = 0;
+		bool bUseQuantizedCache = false;
+		// This function appends (stereo sources call it once per channel into one buffer), so the
+		// cache stores and replays only the entries a single call contributes.
+		const int32 NumEntriesAtEntry = OutChannelMap.Num();
+		if (SpatializationAzimuthQuantizationCvar > 0)
+		{
+			const int32 QuantDegrees = SpatializationAzimuthQuantizationCvar;
+			const uint32 AzimuthBucket = (uint32)(FMath::Fmod(FMath::Max(EmitterAzimith, 0.0f), 360.0f) / QuantDegrees);
+			EmitterAzimith = AzimuthBucket * QuantDegrees;
+
+			const uint32 OmniBucket = (uint32)FMath::Clamp(NormalizedOmniRadius * 32.0f, 0.0f, 255.0f);
+			NormalizedOmniRadius = OmniBucket / 32.0f;
+
+			const uint32 LFEBucket = (uint32)FMath::Clamp(InWaveInstance->LFEBleed * 32.0f, 0.0f, 255.0f);
+			const uint32 VoiceCenterBucket = (uint32)FMath::Clamp(InWaveInstance->VoiceCenterChannelVolume * 32.0f, 0.0f, 255.0f);
+
+			QuantizedKey = ((uint64)InSubmixType << 40) | ((uint64)AzimuthBucket << 24) | ((uint64)OmniBucket << 16) | ((uint64)LFEBucket << 8) | (uint64)VoiceCenterBucket;
+			bUseQuantizedCache = true;
+
+			if (const Audio::AlignedFloatBuffer* CachedMap = QuantizedChannelMapCache.Find(QuantizedKey))
+			{
+				OutChannelMap.Append(*CachedMap);
+				return;
+			}
+		}
+
 		float Azimuth = EmitterAzimith;
 
 		const FChannelPositionInfo* PrevChannelInfo = nullptr;
@@ -1326,6 +1364,14 @@ namespace Audio
 			AUDIO_MIXER_CHECK(EffectivePan >= 0.0f && EffectivePan <= 1.0f);
 			OutChannelMap.Add(EffectivePan);
 		}
+
+		// Bounded so a pathological key spread cannot grow the cache without limit.
+		if (bUseQuantizedCache && QuantizedChannelMapCache.Num() < 4096)
+		{
+			Audio::AlignedFloatBuffer CachedMap;
+			CachedMap.Append(OutChannelMap.GetData() + NumEntriesAtEntry, OutChannelMap.Num() - NumEntriesAtEntry);
+			QuantizedChannelMapCache.Add(QuantizedKey, MoveTemp(CachedMap));
+		}
 	}
 
 	uint32 FMixerDevice::GetNewUniqueAmbisonicsStreamID()
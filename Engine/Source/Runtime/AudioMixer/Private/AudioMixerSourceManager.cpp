@@ -12,7 +12,7 @@
 
 // Link to "Audio" profiling category
 CSV_DECLARE_CATEGORY_MODULE_EXTERN(AUDIOMIXERCORE_API, Audio);
-static int32 DisableParallelSourceProcessingCvar = 1;
+static int32 DisableParallelSourceProcessingCvar = 0;
 FAutoConsoleVariableRef CVarDisableParallelSourceProcessing(
 	TEXT("au.DisableParallelSourceProcessing"),
 	DisableParallelSourceProcessingCvar,
@@ -20,6 +20,14 @@ FAutoConsoleVariableRef CVarDisableParallelSourceProcessing(
 	TEXT("0: Not Disabled, 1: Disabled"),
 	ECVF_Default);
 
+static int32 NumSourceWorkersCvar = 0;
+FAutoConsoleVariableRef CVarNumSourceWorkers(
+	TEXT("au.NumSourceWorkers"),
+	NumSourceWorkersCvar,
+	TEXT("Number of async workers source processing splits across when parallel processing is enabled.\n")
+	TEXT("0: default (4), otherwise clamped to the number of sources; fewer workers leave more headroom for the render callback on low-core machines"),
+	ECVF_Default);
+
 static int32 DisableFilteringCvar = 0;
 FAutoConsoleVariableRef CVarDisableFiltering(
 	TEXT("au.DisableFiltering"),
@@ -265,6 +273,10 @@ namespace Audio
 
 		// Setup the source workers
 		SourceWorkers.Reset();
+		if (NumSourceWorkersCvar > 0)
+		{
+			NumSourceWorkers = FMath::Min(NumSourceWorkersCvar, NumTotalSources);
+		}
 		if (NumSourceWorkers > 0)
 		{
 			const int32 NumSourcesPerWorker = FMath::Max(NumTotalSources / NumSourceWorkers, 1);
@@ -1337,6 +1349,14 @@ namespace Audio
 			}
 			else
 			{
+				// If a decode is still in flight, this is starvation, not the end of the sound:
+				// the decode missed the render window and this source will go silent early.
+				if (SourceInfo.MixerSourceBuffer.IsValid() && SourceInfo.MixerSourceBuffer->IsAsyncTaskInProgress())
+				{
+					CSV_CUSTOM_STAT(Audio, StarvedDecodeSources, 1, ECsvCustomStatOp::Accumulate);
+					UE_LOG(LogAudioMixer, Verbose, TEXT("Source %d starved waiting on an audio decode."), SourceId);
+				}
+
 				SourceInfo.bIsLastBuffer = true;
 				return;
 			}
@@ -1485,6 +1505,42 @@ namespace Audio
 						break;
 					}
 
+					// Unity-pitch fast path: with no pitch ramp and a whole-frame phase, every
+					// iteration advances exactly one source frame and writes it out unmodified, so
+					// whole runs can be copied from the decoded buffer in one go. Chunk boundaries
+					// and every other state fall back to the per-frame interpolation below.
+					if (SourceInfo.bHasStarted
+						&& SourceInfo.CurrentFrameAlpha == 1.0f
+						&& SourceInfo.PitchSourceParam.GetValue() == 1.0f
+						&& !SourceInfo.PitchSourceParam.IsRamping()
+						&& SourceInfo.CurrentPCMBuffer.IsValid())
+					{
+						const int32 NumChannels = SourceInfo.NumInputChannels;
+						const int32 FramesLeftInChunk = SourceInfo.CurrentAudioChunkNumFrames - SourceInfo.CurrentFrameIndex - 2;
+						const int32 FramesToCopy = FMath::Min(FramesLeftInChunk, NumOutputFrames - Frame);
+						if (FramesToCopy > 0 && NumChannels > 0)
+						{
+							const float* AudioData = SourceInfo.CurrentPCMBuffer->AudioData.GetData();
+							FMemory::Memcpy(&PreDistanceAttenBufferPtr[SampleIndex], &AudioData[(SourceInfo.CurrentFrameIndex + 1) * NumChannels], FramesToCopy * NumChannels * sizeof(float));
+
+							SourceInfo.CurrentFrameIndex += FramesToCopy;
+							SourceInfo.NumFramesPlayed += FramesToCopy;
+							SampleIndex += FramesToCopy * NumChannels;
+
+							// Refresh the frame values the per-frame path interpolates from, exactly
+							// as ReadSourceFrame would have after the last advance.
+							const int32 CurrentSampleIndex = SourceInfo.CurrentFrameIndex * NumChannels;
+							for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+							{
+								SourceInfo.CurrentFrameValues[Channel] = AudioData[CurrentSampleIndex + Channel];
+								SourceInfo.NextFrameValues[Channel] = AudioData[CurrentSampleIndex + NumChannels + Channel];
+							}
+
+							Frame += FramesToCopy - 1;
+							continue;
+						}
+					}
+
 					// Whether or not we need to read another sample from the source buffers
 					// If we haven't yet played any frames, then we will need to read the first source samples no matter what
 					bool bReadNextSample = !SourceInfo.bHasStarted;
@@ -353,11 +353,11 @@ namespace Audio
 
 	void FMixerSubmix::FormatChangeBuffer(const ESubmixChannelFormat InNewChannelType, AlignedFloatBuffer& InBuffer, AlignedFloatBuffer& OutNewBuffer)
 	{
-		// Retrieve ptr to the cached downmix channel map from the mixer device
+		// Retrieve ptr to the cached downmix channel map from the mixer device; this runs at block
+		// rate, so read the cached map in place rather than copying it into a transient allocation.
 		int32 NewChannelCount = MixerDevice->GetNumChannelsForSubmixFormat(InNewChannelType);
-		Audio::AlignedFloatBuffer ChannelMap;
-		MixerDevice->Get2DChannelMap(false, InNewChannelType, NumChannels, false, ChannelMap);
-		float* ChannelMapPtr = ChannelMap.GetData();
+		const TArray<float>* CachedChannelMap = MixerDevice->Get2DChannelMapPtr(false, InNewChannelType, NumChannels, false);
+		const float* ChannelMapPtr = CachedChannelMap ? CachedChannelMap->GetData() : nullptr;
 
 		// Input and output frame count is going to be the same
 		const int32 NumFrames = InBuffer.Num() / NumChannels;
@@ -368,6 +368,13 @@ namespace Audio
 
 		if (SubmixAmbisonicsDecoderID == INDEX_NONE)
 		{
+			// Unsupported configurations have no cached map; the output stays silent, as the
+			// zeroed map produced for this case before.
+			if (!ChannelMapPtr)
+			{
+				return;
+			}
+
 			float* OutNewBufferPtr = OutNewBuffer.GetData();
 
 			// Loop through the down mix map and perform the downmix operation
@@ -642,8 +649,10 @@ namespace Audio
 				TSharedPtr<Audio::FMixerSubmix, ESPMode::ThreadSafe> ChildSubmix = ChildSubmixEntry.Value.SubmixPtr.Pin();
 				if (ChildSubmix.IsValid())
 				{
+					// The child fully overwrites the buffer it renders into (ProcessAudio always
+					// ends in a format change or a whole-buffer copy), so skip the zero fill.
 					ScratchBuffer.Reset(NumSamples);
-					ScratchBuffer.AddZeroed(NumSamples);
+					ScratchBuffer.AddUninitialized(NumSamples);
 
 					ChildSubmix->ProcessAudio(ChannelFormat, ScratchBuffer);
 
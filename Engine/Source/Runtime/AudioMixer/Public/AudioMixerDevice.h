@@ -175,6 +175,9 @@ namespace Audio
 
 		// Builds a channel gain matrix for a non-spatialized source. The non-static variation of this function queries AudioMixerDevice->NumOutputChannels directly which may not be thread safe.
 		void Get2DChannelMap(bool bIsVorbis, const ESubmixChannelFormat InSubmixChannelType, const int32 NumSourceChannels, const bool bIsCenterChannelOnly, Audio::AlignedFloatBuffer& OutChannelMap) const;
+
+		/** Returns a pointer to the cached 2D channel map, or null for unsupported configurations. Avoids the per-call copy for block-rate callers. */
+		const TArray<float>* Get2DChannelMapPtr(bool bIsVorbis, const ESubmixChannelFormat InSubmixChannelType, const int32 NumSourceChannels, const bool bIsCenterChannelOnly) const;
 		static void Get2DChannelMap(bool bIsVorbis, const int32 NumSourceChannels, const int32 NumOutputChannels, const bool bIsCenterChannelOnly, Audio::AlignedFloatBuffer& OutChannelMap);
 
 		int32 GetDeviceSampleRate() const;
@@ -258,6 +261,9 @@ namespace Audio
 		/** The azimuth positions for submix channel types. */
 		TMap<ESubmixChannelFormat, TArray<FChannelPositionInfo>> ChannelAzimuthPositions;
 
+		/** Cache of quantized 3d channel maps, keyed by packed azimuth/omni/bleed buckets. See au.SpatializationAzimuthQuantization. */
+		TMap<uint64, Audio::AlignedFloatBuffer> QuantizedChannelMapCache;
+
 		int32 OutputChannels[(int32)ESubmixChannelFormat::Count];
 
 		/** Channel type arrays for submix channel types. */
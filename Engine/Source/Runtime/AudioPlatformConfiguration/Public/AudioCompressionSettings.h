@@ -40,6 +40,13 @@ struct FAudioStreamCachingSettings
 /* FPlatformAudioCookOverrides                                          */
 /* This struct is used for settings used during the cook to a target    */
 /* platform (platform-specific compression quality and resampling, etc.)*/
+/*                                                                      */
+/* These are the per-platform levers of the audio quality ladder: each  */
+/* platform cooks exactly one encoded variant per wave, shaped by the   */
+/* sample rate settings, the global quality modifier and the sound cue  */
+/* quality index below. A runtime-switchable multi-tier ladder would    */
+/* need the derived data to store several encodings per wave and the    */
+/* decoders to hot-swap between them, which this format does not carry. */
 /************************************************************************/
 struct FPlatformAudioCookOverrides
 {
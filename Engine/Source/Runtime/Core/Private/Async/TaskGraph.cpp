@@ -27,6 +27,8 @@
 #include "Async/TaskGraphInterfaces.h"
 #include "HAL/LowLevelMemTracker.h"
 #include "HAL/ThreadHeartBeat.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 #include "ProfilingDebugging/ExternalProfiler.h"
 #include "ProfilingDebugging/MiscTrace.h"
 
@@ -39,6 +41,9 @@ DEFINE_STAT(STAT_ParallelForTask);
 
 static int32 GNumWorkerThreadsToIgnore = 0;
 
+/** If > 0, AnyThread tasks are distributed via per-worker work-stealing deques instead of the shared stalling queues. Set at startup with -taskgraphworksteal. **/
+static int32 GTaskGraphUseWorkStealing = 0;
+
 #if PLATFORM_USE_FULL_TASK_GRAPH && !IS_PROGRAM && WITH_ENGINE && !UE_SERVER
 	#define CREATE_HIPRI_TASK_THREADS (1)
 	#define CREATE_BACKGROUND_TASK_THREADS (1)
@@ -1115,6 +1120,93 @@ struct FWorkerThread
 	}
 };
 
+/**
+*	FWorkStealingTaskDeque
+*	Bounded chase-lev style deque used by the work-stealing scheduler mode. The owning worker pushes and pops
+*	at the bottom without contention; thieves steal from the top with an interlocked exchange. When the ring is
+*	full the producer falls back to the shared stalling queue, so boundedness never loses tasks.
+**/
+class FWorkStealingTaskDeque : public FNoncopyable
+{
+	enum
+	{
+		Capacity = 4096, // tasks; must be a power of two
+		IndexMask = Capacity - 1
+	};
+
+public:
+	FWorkStealingTaskDeque()
+		: Top(0)
+		, Bottom(0)
+	{
+		FMemory::Memzero(Ring, sizeof(Ring));
+	}
+
+	/** Called only by the owning worker. Returns false if the ring is full and the caller must use the shared queue. **/
+	bool Push(FBaseGraphTask* Task)
+	{
+		int64 LocalBottom = Bottom;
+		if (LocalBottom - Top >= Capacity)
+		{
+			return false;
+		}
+		Ring[LocalBottom & IndexMask] = Task;
+		FPlatformMisc::MemoryBarrier();
+		Bottom = LocalBottom + 1;
+		return true;
+	}
+
+	/** Called only by the owning worker; LIFO for cache warmth. **/
+	FBaseGraphTask* Pop()
+	{
+		int64 LocalBottom = Bottom - 1;
+		Bottom = LocalBottom;
+		FPlatformMisc::MemoryBarrier();
+		int64 LocalTop = Top;
+		if (LocalTop > LocalBottom)
+		{
+			Bottom = LocalTop;
+			return nullptr;
+		}
+		FBaseGraphTask* Task = Ring[LocalBottom & IndexMask];
+		if (LocalTop != LocalBottom)
+		{
+			return Task;
+		}
+		// last element; race against thieves for it
+		if (FPlatformAtomics::InterlockedCompareExchange(&Top, LocalTop + 1, LocalTop) != LocalTop)
+		{
+			Task = nullptr;
+		}
+		Bottom = LocalTop + 1;
+		return Task;
+	}
+
+	/** Called by any other worker; FIFO so stolen tasks are the oldest and least cache-warm. **/
+	FBaseGraphTask* Steal()
+	{
+		int64 LocalTop = Top;
+		FPlatformMisc::MemoryBarrier();
+		int64 LocalBottom = Bottom;
+		if (LocalTop >= LocalBottom)
+		{
+			return nullptr;
+		}
+		FBaseGraphTask* Task = Ring[LocalTop & IndexMask];
+		if (FPlatformAtomics::InterlockedCompareExchange(&Top, LocalTop + 1, LocalTop) != LocalTop)
+		{
+			return nullptr; // lost the race to the owner or another thief
+		}
+		return Task;
+	}
+
+private:
+	// 64-bit indices so they never wrap within a process lifetime
+	MS_ALIGN(PLATFORM_CACHE_LINE_SIZE) volatile int64 Top GCC_ALIGN(PLATFORM_CACHE_LINE_SIZE);
+	MS_ALIGN(PLATFORM_CACHE_LINE_SIZE) volatile int64 Bottom GCC_ALIGN(PLATFORM_CACHE_LINE_SIZE);
+	FBaseGraphTask* Ring[Capacity];
+};
+
 /**
 *	FTaskGraphImplementation
 *	Implementation of the centralized part of the task graph system.
@@ -1184,7 +1276,24 @@ public:
 		NumTaskThreadsPerSet = (NumThreads - NumNamedThreads) / NumTaskThreadSets;
 		check((NumThreads - NumNamedThreads) % NumTaskThreadSets == 0); // should be equal numbers of threads per priority set
 
-		UE_LOG(LogTaskGraph, Log, TEXT("Started task graph with %d named threads and %d total threads with %d sets of task threads."), NumNamedThreads, NumThreads, NumTaskThreadSets);
+		if (FPlatformProcess::SupportsMultithreading() && FParse::Param(FCommandLine::Get(), TEXT("taskgraphworksteal")))
+		{
+			GTaskGraphUseWorkStealing = 1;
+		}
+		FMemory::Memzero(StalledWorkerMask, sizeof(StalledWorkerMask));
+		FMemory::Memzero(WorkStealingDeques, sizeof(WorkStealingDeques));
+		if (GTaskGraphUseWorkStealing)
+		{
+			for (int32 Priority = 0; Priority < NumTaskThreadSets; Priority++)
+			{
+				for (int32 WorkerIndex = 0; WorkerIndex < NumTaskThreadsPerSet; WorkerIndex++)
+				{
+					WorkStealingDeques[Priority][WorkerIndex] = new FWorkStealingTaskDeque();
+				}
+			}
+		}
+
+		UE_LOG(LogTaskGraph, Log, TEXT("Started task graph with %d named threads and %d total threads with %d sets of task threads%s."), NumNamedThreads, NumThreads, NumTaskThreadSets, GTaskGraphUseWorkStealing ? TEXT(" (work-stealing)") : TEXT(""));
 		check(NumThreads - NumNamedThreads >= 1);  // need at least one pure worker thread
 		check(NumThreads <= MAX_THREADS);
 		check(!ReentrancyCheck.GetValue()); // reentrant?
@@ -1283,6 +1392,14 @@ public:
 			}
 			WorkerThreads[ThreadIndex].bAttached = false;
 		}
+		for (int32 Priority = 0; Priority < MAX_THREAD_PRIORITIES; Priority++)
+		{
+			for (int32 WorkerIndex = 0; WorkerIndex < MAX_THREADS; WorkerIndex++)
+			{
+				delete WorkStealingDeques[Priority][WorkerIndex];
+				WorkStealingDeques[Priority][WorkerIndex] = nullptr;
+			}
+		}
 		TaskGraphImplementationSingleton = NULL;
 		NumTaskThreadsPerSet = 0;
 		FPlatformTLS::FreeTlsSlot(PerThreadIDTLSSlot);
@@ -1307,18 +1424,30 @@ public:
 			{
 				uint32 TaskPriority = ENamedThreads::GetTaskPriority(Task->ThreadToExecuteOn);
 				int32 Priority = ENamedThreads::GetThreadPriorityIndex(Task->ThreadToExecuteOn);
-				if (Priority == (ENamedThreads::BackgroundThreadPriority >> ENamedThreads::ThreadPriorityShift) && (!bCreatedBackgroundPriorityThreads || !ENamedThreads::bHasBackgroundThreads))
-				{
-					Priority = ENamedThreads::NormalThreadPriority >> ENamedThreads::ThreadPriorityShift; // we don't have background threads, promote to normal
-					TaskPriority = ENamedThreads::NormalTaskPriority >> ENamedThreads::TaskPriorityShift; // demote to normal task pri
-				}
-				else if (Priority == (ENamedThreads::HighThreadPriority >> ENamedThreads::ThreadPriorityShift) && (!bCreatedHiPriorityThreads || !ENamedThreads::bHasHighPriorityThreads))
-				{
-					Priority = ENamedThreads::NormalThreadPriority >> ENamedThreads::ThreadPriorityShift; // we don't have hi priority threads, demote to normal
-					TaskPriority = ENamedThreads::HighTaskPriority >> ENamedThreads::TaskPriorityShift; // promote to hi task pri
-				}
+				RemapAnyThreadPriorities(Priority, TaskPriority);
 				uint32 PriIndex = TaskPriority ? 0 : 1;
 				check(Priority >= 0 && Priority < MAX_THREAD_PRIORITIES);
+				if (GTaskGraphUseWorkStealing)
+				{
+					TASKGRAPH_SCOPE_CYCLE_COUNTER(4, STAT_TaskGraph_QueueTask_IncomingAnyThreadTasks_Push);
+					// A worker queueing normal-priority work for its own set pushes to its local deque; everything else,
+					// including hi task priority (which must be able to jump the line), goes through the shared queue.
+					bool bQueuedLocally = false;
+					if (PriIndex != 0)
+					{
+						int32 CurrentThreadIndex = ENamedThreads::GetThreadIndex(GetCurrentThread());
+						if (CurrentThreadIndex >= NumNamedThreads && (CurrentThreadIndex - NumNamedThreads) / NumTaskThreadsPerSet == Priority)
+						{
+							bQueuedLocally = WorkStealingDeques[Priority][(CurrentThreadIndex - NumNamedThreads) % NumTaskThreadsPerSet]->Push(Task);
+						}
+					}
+					if (!bQueuedLocally)
+					{
+						IncomingAnyThreadTasks[Priority].Push(Task, PriIndex);
+					}
+					WakeStalledWorker(Priority);
+					return;
+				}
 				{
 					TASKGRAPH_SCOPE_CYCLE_COUNTER(4, STAT_TaskGraph_QueueTask_IncomingAnyThreadTasks_Push);
 					int32 IndexToStart = IncomingAnyThreadTasks[Priority].Push(Task, PriIndex);
@@ -1360,6 +1489,67 @@ public:
 	}
 
 
+	/**
+	 *	Batched version of QueueTask. Named-thread tasks take the ordinary path; AnyThread tasks are pushed
+	 *	first, with every worker wakeup deferred, deduplicated and issued once after the last push, so a burst
+	 *	of N small tasks pays for at most min(N, stalled workers) triggers instead of N queue/wake round trips.
+	**/
+	virtual void QueueTaskBatch(const TArrayView<FBaseGraphTask* const>& Tasks, ENamedThreads::Type InCurrentThreadIfKnown = ENamedThreads::AnyThread) final override
+	{
+		TASKGRAPH_SCOPE_CYCLE_COUNTER(2, STAT_TaskGraph_QueueTask);
+
+		if (!FPlatformProcess::SupportsMultithreading())
+		{
+			for (FBaseGraphTask* Task : Tasks)
+			{
+				QueueTask(Task, Task->ThreadToExecuteOn, InCurrentThreadIfKnown);
+			}
+			return;
+		}
+		uint64 ThreadsToWake[MAX_THREAD_PRIORITIES] = { 0 };
+		int32 NumPushed[MAX_THREAD_PRIORITIES] = { 0 };
+		for (FBaseGraphTask* Task : Tasks)
+		{
+			if (ENamedThreads::GetThreadIndex(Task->ThreadToExecuteOn) != ENamedThreads::AnyThread)
+			{
+				QueueTask(Task, Task->ThreadToExecuteOn, InCurrentThreadIfKnown);
+				continue;
+			}
+			uint32 TaskPriority = ENamedThreads::GetTaskPriority(Task->ThreadToExecuteOn);
+			int32 Priority = ENamedThreads::GetThreadPriorityIndex(Task->ThreadToExecuteOn);
+			RemapAnyThreadPriorities(Priority, TaskPriority);
+			uint32 PriIndex = TaskPriority ? 0 : 1;
+			check(Priority >= 0 && Priority < MAX_THREAD_PRIORITIES);
+			int32 IndexToStart = IncomingAnyThreadTasks[Priority].Push(Task, PriIndex);
+			NumPushed[Priority]++;
+			if (IndexToStart >= 0)
+			{
+				ThreadsToWake[Priority] |= uint64(1) << IndexToStart;
+			}
+		}
+		for (int32 Priority = 0; Priority < MAX_THREAD_PRIORITIES; Priority++)
+		{
+			if (GTaskGraphUseWorkStealing)
+			{
+				// wake at most one stalled worker per pushed task; WakeStalledWorker returns early once the mask drains
+				for (int32 Count = 0; Count < NumPushed[Priority]; Count++)
+				{
+					WakeStalledWorker(Priority);
+				}
+			}
+			else
+			{
+				uint64 Mask = ThreadsToWake[Priority];
+				while (Mask)
+				{
+					int32 IndexToStart = FMath::CountTrailingZeros64(Mask);
+					Mask &= Mask - 1;
+					StartTaskThread(Priority, IndexToStart);
+				}
+			}
+		}
+	}
+
 	virtual	int32 GetNumWorkerThreads() final override
 	{
 		int32 Result = (NumThreads - NumNamedThreads) / NumTaskThreadSets - GNumWorkerThreadsToIgnore;
@@ -1487,6 +1677,52 @@ public:
 		}
 	}
 
+	virtual void WaitUntilTasksCompleteAllowingWork(const FGraphEventArray& Tasks, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread) final override
+	{
+		ENamedThreads::Type CurrentThread = ENamedThreads::GetThreadIndex(GetCurrentThread());
+		if (CurrentThread == ENamedThreads::AnyThread || CurrentThread < NumNamedThreads || !FPlatformProcess::SupportsMultithreading())
+		{
+			// named threads already process tasks while waiting; unknown threads have no queue to help with
+			WaitUntilTasksComplete(Tasks, CurrentThreadIfKnown);
+			return;
+		}
+		bool bAnyPending = false;
+		for (int32 Index = 0; Index < Tasks.Num(); Index++)
+		{
+			if (!Tasks[Index]->IsComplete())
+			{
+				bAnyPending = true;
+				break;
+			}
+		}
+		if (!bAnyPending)
+		{
+			return;
+		}
+		int32 MyIndex = int32((uint32(CurrentThread) - NumNamedThreads) % NumTaskThreadsPerSet);
+		int32 Priority = int32((uint32(CurrentThread) - NumNamedThreads) / NumTaskThreadsPerSet);
+
+		// manual-reset so polling with Wait(0) doesn't consume the trigger
+		FEvent* DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
+		TriggerEventWhenTasksComplete(DoneEvent, Tasks, CurrentThreadIfKnown);
+		TArray<FBaseGraphTask*> NewTasks;
+		while (!DoneEvent->Wait(0))
+		{
+			FBaseGraphTask* Task = FindWorkNoStall(Priority, MyIndex);
+			if (Task)
+			{
+				Task->Execute(NewTasks, CurrentThread);
+				NewTasks.Reset();
+			}
+			else
+			{
+				// nothing to help with right now; sleep briefly rather than spinning, the trigger will end the wait
+				DoneEvent->Wait(1);
+			}
+		}
+		FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+	}
+
 	virtual void TriggerEventWhenTasksComplete(FEvent* InEvent, const FGraphEventArray& Tasks, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread, ENamedThreads::Type TriggerThread = ENamedThreads::AnyHiPriThreadHiPriTask) final override
 	{
 		check(InEvent);
@@ -1551,9 +1787,109 @@ public:
 			MyIndex < (PLATFORM_64BITS ? 63 : 32) &&
 			Priority >= 0 && Priority < ENamedThreads::NumThreadPriorities);
 
+		if (GTaskGraphUseWorkStealing)
+		{
+			return FindWorkWithStealing(Priority, MyIndex);
+		}
 		return IncomingAnyThreadTasks[Priority].Pop(MyIndex, true);
 	}
 
+	/** Work search that never registers a stall, for callers that stay awake regardless of the outcome (helping waits). **/
+	FBaseGraphTask* FindWorkNoStall(int32 Priority, int32 MyIndex)
+	{
+		if (GTaskGraphUseWorkStealing)
+		{
+			FBaseGraphTask* Task = WorkStealingDeques[Priority][MyIndex]->Pop();
+			if (!Task)
+			{
+				Task = IncomingAnyThreadTasks[Priority].Pop(MyIndex, false);
+			}
+			if (!Task)
+			{
+				Task = StealWork(Priority, MyIndex);
+			}
+			return Task;
+		}
+		return IncomingAnyThreadTasks[Priority].Pop(MyIndex, false);
+	}
+
+	/**
+	 *	Work-stealing mode work search: local deque first (LIFO, cache warm), then the shared injection queue,
+	 *	then randomized stealing from the other workers in this priority set. Before giving up, the worker
+	 *	publishes itself in StalledWorkerMask and re-checks once, which closes the race against a producer that
+	 *	pushed right before we published; returning nullptr means the caller may safely stall on its event.
+	**/
+	FBaseGraphTask* FindWorkWithStealing(int32 Priority, int32 MyIndex)
+	{
+		FBaseGraphTask* Task = FindWorkNoStall(Priority, MyIndex);
+		if (!Task)
+		{
+			FPlatformAtomics::InterlockedOr(&StalledWorkerMask[Priority], 1 << MyIndex);
+			Task = IncomingAnyThreadTasks[Priority].Pop(MyIndex, false);
+			if (!Task)
+			{
+				Task = StealWork(Priority, MyIndex);
+			}
+			if (Task)
+			{
+				FPlatformAtomics::InterlockedAnd(&StalledWorkerMask[Priority], ~(1 << MyIndex));
+			}
+		}
+		return Task;
+	}
+
+	/** Attempts a single sweep over the other workers' deques, starting at a randomized victim to spread contention. **/
+	FBaseGraphTask* StealWork(int32 Priority, int32 MyIndex)
+	{
+		static thread_local uint32 StealSeed = 0;
+		if (!StealSeed)
+		{
+			StealSeed = FPlatformTime::Cycles() | 1;
+		}
+		StealSeed ^= StealSeed << 13; // xorshift; we just need cheap decorrelation between workers
+		StealSeed ^= StealSeed >> 17;
+		StealSeed ^= StealSeed << 5;
+		int32 LocalNumWorkingThread = GetNumWorkerThreads() + GNumWorkerThreadsToIgnore;
+		int32 StartIndex = StealSeed % uint32(LocalNumWorkingThread);
+		for (int32 Attempt = 0; Attempt < LocalNumWorkingThread; Attempt++)
+		{
+			int32 Victim = StartIndex + Attempt;
+			if (Victim >= LocalNumWorkingThread)
+			{
+				Victim -= LocalNumWorkingThread;
+			}
+			if (Victim == MyIndex)
+			{
+				continue;
+			}
+			FBaseGraphTask* Task = WorkStealingDeques[Priority][Victim]->Steal();
+			if (Task)
+			{
+				return Task;
+			}
+		}
+		return nullptr;
+	}
+
+	/** Wakes one worker that has published itself as stalled, clearing its bit before the trigger so other producers pick a different victim. **/
+	void WakeStalledWorker(int32 Priority)
+	{
+		while (true)
+		{
+			int32 LocalMask = StalledWorkerMask[Priority];
+			if (!LocalMask)
+			{
+				return;
+			}
+			int32 IndexToStart = FMath::CountTrailingZeros(uint32(LocalMask));
+			if (FPlatformAtomics::InterlockedCompareExchange(&StalledWorkerMask[Priority], LocalMask & ~(1 << IndexToStart), LocalMask) == LocalMask)
+			{
+				StartTaskThread(Priority, IndexToStart);
+				return;
+			}
+		}
+	}
+
 	void StallForTuning(int32 Index, bool Stall)
 	{
 		for (int32 Priority = 0; Priority < ENamedThreads::NumThreadPriorities; Priority++)
@@ -1616,6 +1952,21 @@ private:
 		return CurrentThreadIfKnown;
 	}
 
+	/** Remaps an AnyThread priority pair onto the thread sets that actually exist, preserving relative urgency via task priority. **/
+	FORCEINLINE void RemapAnyThreadPriorities(int32& Priority, uint32& TaskPriority)
+	{
+		if (Priority == (ENamedThreads::BackgroundThreadPriority >> ENamedThreads::ThreadPriorityShift) && (!bCreatedBackgroundPriorityThreads || !ENamedThreads::bHasBackgroundThreads))
+		{
+			Priority = ENamedThreads::NormalThreadPriority >> ENamedThreads::ThreadPriorityShift; // we don't have background threads, promote to normal
+			TaskPriority = ENamedThreads::NormalTaskPriority >> ENamedThreads::TaskPriorityShift; // demote to normal task pri
+		}
+		else if (Priority == (ENamedThreads::HighThreadPriority >> ENamedThreads::ThreadPriorityShift) && (!bCreatedHiPriorityThreads || !ENamedThreads::bHasHighPriorityThreads))
+		{
+			Priority = ENamedThreads::NormalThreadPriority >> ENamedThreads::ThreadPriorityShift; // we don't have hi priority threads, demote to normal
+			TaskPriority = ENamedThreads::HighTaskPriority >> ENamedThreads::TaskPriorityShift; // promote to hi task pri
+		}
+	}
+
 	int32 ThreadIndexToPriorityIndex(int32 ThreadIndex)
 	{
 		check(ThreadIndex >= NumNamedThreads && ThreadIndex < NumThreads);
@@ -1659,6 +2010,11 @@ private:
 	TArray<TFunction<void()> > ShutdownCallbacks;
 
 	FStallingTaskQueue<FBaseGraphTask, PLATFORM_CACHE_LINE_SIZE, 2>	IncomingAnyThreadTasks[MAX_THREAD_PRIORITIES];
+
+	/** Per-worker deques, only allocated when the work-stealing scheduler mode is active. **/
+	FWorkStealingTaskDeque*	WorkStealingDeques[MAX_THREAD_PRIORITIES][MAX_THREADS];
+	/** Bit per worker that has published itself as stalled; producers wake the lowest set bit. Only used in work-stealing mode. **/
+	volatile int32		StalledWorkerMask[MAX_THREAD_PRIORITIES];
 };
 
 
@@ -1670,7 +2026,16 @@ FBaseGraphTask* FTaskThreadAnyThread::FindWork()
 }
 
 
-// Statics in FTaskGraphInterface
+// Statics and defaults in FTaskGraphInterface
+
+void FTaskGraphInterface::QueueTaskBatch(const TArrayView<FBaseGraphTask* const>& Tasks, ENamedThreads::Type CurrentThreadIfKnown)
+{
+	// fallback for implementations without a batched path; FTaskGraphImplementation overrides this
+	for (FBaseGraphTask* Task : Tasks)
+	{
+		QueueTask(Task, Task->ThreadToExecuteOn, CurrentThreadIfKnown);
+	}
+}
 
 void FTaskGraphInterface::Startup(int32 NumThreads)
 {
@@ -194,8 +194,120 @@ void FGenericReadRequestWorker::DoWork()
 #define DISABLE_BUFFERING_ON_GENERIC_ASYNC_FILE_HANDLE 1
 #endif
 
+/**
+ * One pool task servicing a whole scatter-gather batch with positional reads on a single handle:
+ * one worker wakeup and one open per batch instead of one of each per span. This is the share of
+ * the io_uring-style batching win available without a kernel submission queue; the per-span request
+ * objects keep the ordinary IAsyncReadRequest contract.
+ */
+class FGenericBatchSpanRequest;
+
+struct FGenericBatchReadState
+{
+	IPlatformFile* LowerLevel = nullptr;
+	FString Filename;
+	TArray<FGenericBatchSpanRequest*> Spans;
+};
+
+class FGenericBatchReadWorker : public FNonAbandonableTask
+{
+	TSharedPtr<FGenericBatchReadState, ESPMode::ThreadSafe> State;
+public:
+	FGenericBatchReadWorker(const TSharedPtr<FGenericBatchReadState, ESPMode::ThreadSafe>& InState)
+		: State(InState)
+	{
+	}
+	void DoWork();
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FGenericBatchReadWorker, STATGROUP_ThreadPoolAsyncTasks);
+	}
+};
+
+class FGenericBatchSpanRequest final : public IAsyncReadRequest
+{
+	friend class FGenericBatchReadWorker;
+
+	/** Keeps the batch task alive until the last span request dies; the last releaser joins and deletes it. */
+	TSharedPtr<FAsyncTask<FGenericBatchReadWorker>, ESPMode::ThreadSafe> BatchTask;
+	FEvent* DoneEvent;
+	int64 Offset;
+	int64 BytesToRead;
+
+public:
+	FGenericBatchSpanRequest(FAsyncFileCallBack* CompleteCallback, uint8* UserSuppliedMemory, int64 InOffset, int64 InBytesToRead)
+		: IAsyncReadRequest(CompleteCallback, false, UserSuppliedMemory)
+		, DoneEvent(FPlatformProcess::GetSynchEventFromPool(true))
+		, Offset(InOffset)
+		, BytesToRead(InBytesToRead)
+	{
+	}
+
+	virtual ~FGenericBatchSpanRequest()
+	{
+		// the shared task pointer's deleter joins and frees the batch task when the last span releases it
+		BatchTask.Reset();
+		if (Memory && !bUserSuppliedMemory)
+		{
+			// cancel raced the worker's read and nobody claimed the buffer; same handling as the pak requests
+			DEC_MEMORY_STAT_BY(STAT_AsyncFileMemory, BytesToRead);
+			FMemory::Free(Memory);
+		}
+		Memory = nullptr;
+		FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+	}
+
+	void SetBatchTask(const TSharedPtr<FAsyncTask<FGenericBatchReadWorker>, ESPMode::ThreadSafe>& InTask)
+	{
+		BatchTask = InTask;
+	}
+
+	virtual void WaitCompletionImpl(float TimeLimitSeconds) override
+	{
+		DoneEvent->Wait(TimeLimitSeconds <= 0.0f ? MAX_uint32 : uint32(TimeLimitSeconds * 1000.0f));
+	}
+
+	virtual void CancelImpl() override
+	{
+		// the worker observes bCanceled and completes the span without reading
+	}
+
+	/** Called from the batch worker exactly once per span. */
+	void FinishSpan(uint8* ReadMemory)
+	{
+		if (!bUserSuppliedMemory)
+		{
+			Memory = ReadMemory;
+		}
+		SetComplete();
+		DoneEvent->Trigger();
+	}
+};
+
+void FGenericBatchReadWorker::DoWork()
+{
+	IFileHandle* Handle = State->LowerLevel->OpenRead(*State->Filename);
+	for (FGenericBatchSpanRequest* Span : State->Spans)
+	{
+		uint8* Dest = nullptr;
+		if (Handle && !Span->bCanceled)
+		{
+			Dest = Span->bUserSuppliedMemory ? Span->Memory : (uint8*)FMemory::Malloc(Span->BytesToRead);
+			if (!Span->bUserSuppliedMemory)
+			{
+				INC_MEMORY_STAT_BY(STAT_AsyncFileMemory, Span->BytesToRead);
+			}
+			Handle->Seek(Span->Offset);
+			Handle->Read(Dest, Span->BytesToRead);
+		}
+		Span->FinishSpan(Span->bUserSuppliedMemory ? nullptr : Dest);
+	}
+	delete Handle;
+}
+
 class FGenericAsyncReadFileHandle final : public IAsyncReadFileHandle
 {
+	friend class FGenericBatchReadWorker;
 	IPlatformFile* LowerLevel;
 	FString Filename;
 	TArray<FGenericReadRequest*> LiveRequests; // linear searches could be improved
@@ -258,6 +370,42 @@ public:
 	{
 		return new FGenericSizeRequest(LowerLevel, *Filename, CompleteCallback);
 	}
+	virtual void ReadRequestScatterGather(const TArrayView<const FScatterGatherReadSpan>& Spans, EAsyncIOPriorityAndFlags PriorityAndFlags, FAsyncFileCallBack* CompleteCallback, TArray<IAsyncReadRequest*>& OutRequests) override
+	{
+		// precache-flagged batches and tiny batches gain nothing from batching; use the per-request path
+		if ((PriorityAndFlags & AIOP_FLAG_PRECACHE) || Spans.Num() < 2 || !FPlatformProcess::SupportsMultithreading())
+		{
+			IAsyncReadFileHandle::ReadRequestScatterGather(Spans, PriorityAndFlags, CompleteCallback, OutRequests);
+			return;
+		}
+
+		TSharedPtr<FGenericBatchReadState, ESPMode::ThreadSafe> State = MakeShareable(new FGenericBatchReadState());
+		State->LowerLevel = LowerLevel;
+		State->Filename = Filename;
+		State->Spans.Reserve(Spans.Num());
+		OutRequests.Reserve(OutRequests.Num() + Spans.Num());
+		for (const FScatterGatherReadSpan& Span : Spans)
+		{
+			FGenericBatchSpanRequest* Request = new FGenericBatchSpanRequest(CompleteCallback, Span.UserSuppliedMemory, Span.Offset, Span.BytesToRead);
+			State->Spans.Add(Request);
+			OutRequests.Add(Request);
+		}
+
+		// one pool task services the whole batch; spans share ownership of it and the last one joins it
+		FAsyncTask<FGenericBatchReadWorker>* RawTask = new FAsyncTask<FGenericBatchReadWorker>(State);
+		TSharedPtr<FAsyncTask<FGenericBatchReadWorker>, ESPMode::ThreadSafe> SharedTask = MakeShareable(RawTask,
+			[](FAsyncTask<FGenericBatchReadWorker>* Task)
+			{
+				Task->EnsureCompletion();
+				delete Task;
+			});
+		for (FGenericBatchSpanRequest* Request : State->Spans)
+		{
+			Request->SetBatchTask(SharedTask);
+		}
+		RawTask->StartBackgroundTask(GIOThreadPool);
+	}
+
 	virtual IAsyncReadRequest* ReadRequest(int64 Offset, int64 BytesToRead, EAsyncIOPriorityAndFlags PriorityAndFlags = AIOP_Normal, FAsyncFileCallBack* CompleteCallback = nullptr, uint8* UserSuppliedMemory = nullptr) override
 	{
 		FGenericReadRequest* Result = new FGenericReadRequest(this, LowerLevel, *Filename, CompleteCallback, UserSuppliedMemory, Offset, BytesToRead, PriorityAndFlags);
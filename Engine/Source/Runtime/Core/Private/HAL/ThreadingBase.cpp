@@ -551,9 +551,10 @@ public:
 	 * @param InPool The thread pool interface used to place this thread back into the pool of available threads when its work is done
 	 * @param InStackSize The size of the stack to create. 0 means use the current thread's stack size
 	 * @param ThreadPriority priority of new thread
+	 * @param ThreadAffinityMask affinity mask for the new thread
 	 * @return True if the thread and all of its initialization was successful, false otherwise
 	 */
-	virtual bool Create(class FQueuedThreadPool* InPool,uint32 InStackSize = 0,EThreadPriority ThreadPriority=TPri_Normal)
+	virtual bool Create(class FQueuedThreadPool* InPool,uint32 InStackSize = 0,EThreadPriority ThreadPriority=TPri_Normal,uint64 ThreadAffinityMask = FPlatformAffinity::GetPoolThreadMask())
 	{
 		static int32 PoolThreadIndex = 0;
 		const FString PoolThreadName = FString::Printf( TEXT( "PoolThread %d" ), PoolThreadIndex );
@@ -561,7 +562,7 @@ public:
 
 		OwningThreadPool = InPool;
 		DoWorkEvent = FPlatformProcess::GetSynchEventFromPool();
-		Thread = FRunnableThread::Create(this, *PoolThreadName, InStackSize, ThreadPriority, FPlatformAffinity::GetPoolThreadMask());
+		Thread = FRunnableThread::Create(this, *PoolThreadName, InStackSize, ThreadPriority, ThreadAffinityMask);
 		check(Thread);
 		return true;
 	}
@@ -649,7 +650,7 @@ public:
 		Destroy();
 	}
 
-	virtual bool Create(uint32 InNumQueuedThreads,uint32 StackSize = (32 * 1024),EThreadPriority ThreadPriority=TPri_Normal) override
+	virtual bool Create(uint32 InNumQueuedThreads,uint32 StackSize = (32 * 1024),EThreadPriority ThreadPriority=TPri_Normal,uint64 ThreadAffinityMask = FPlatformAffinity::GetPoolThreadMask()) override
 	{
 		// Make sure we have synch objects
 		bool bWasSuccessful = true;
@@ -672,7 +673,7 @@ public:
 			// Create a new queued thread
 			FQueuedThread* pThread = new FQueuedThread();
 			// Now create the thread and add it if ok
-			if (pThread->Create(this,StackSize,ThreadPriority) == true)
+			if (pThread->Create(this,StackSize,ThreadPriority,ThreadAffinityMask) == true)
 			{
 				QueuedThreads.Add(pThread);
 				AllThreads.Add(pThread);
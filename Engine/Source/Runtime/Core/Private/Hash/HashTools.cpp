@@ -0,0 +1,146 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "Hash/HashTools.h"
+#include "Hash/CityHash.h"
+#include "HAL/UnrealMemory.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+	#include <nmmintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+	#define HASHTOOLS_HAS_HARDWARE_CRC 1
+#else
+	#define HASHTOOLS_HAS_HARDWARE_CRC 0
+#endif
+
+#if HASHTOOLS_HAS_HARDWARE_CRC
+
+static bool DetectHardwareCrc()
+{
+	// SSE4.2 is CPUID leaf 1, ECX bit 20
+#if defined(_MSC_VER)
+	int CpuInfo[4] = { 0 };
+	__cpuid(CpuInfo, 1);
+	return (CpuInfo[2] & (1 << 20)) != 0;
+#else
+	unsigned int Eax = 0, Ebx = 0, Ecx = 0, Edx = 0;
+	if (!__get_cpuid(1, &Eax, &Ebx, &Ecx, &Edx))
+	{
+		return false;
+	}
+	return (Ecx & (1u << 20)) != 0;
+#endif
+}
+
+static const bool GHardwareCrcAvailable = DetectHardwareCrc();
+
+#if !defined(_MSC_VER)
+// Core compiles at the platform baseline arch; scope the SSE4.2 requirement to this one function
+__attribute__((target("sse4.2")))
+#endif
+static uint32 MemCrc32CHardware(const void* Data, int64 Length, uint32 CRC)
+{
+	const uint8* Bytes = (const uint8*)Data;
+	CRC = ~CRC;
+#if PLATFORM_64BITS
+	uint64 Crc64 = CRC;
+	while (Length >= 8)
+	{
+		uint64 Chunk;
+		FMemory::Memcpy(&Chunk, Bytes, 8);
+		Crc64 = _mm_crc32_u64(Crc64, Chunk);
+		Bytes += 8;
+		Length -= 8;
+	}
+	CRC = (uint32)Crc64;
+#endif
+	while (Length >= 4)
+	{
+		uint32 Chunk;
+		FMemory::Memcpy(&Chunk, Bytes, 4);
+		CRC = _mm_crc32_u32(CRC, Chunk);
+		Bytes += 4;
+		Length -= 4;
+	}
+	while (Length > 0)
+	{
+		CRC = _mm_crc32_u8(CRC, *Bytes++);
+		Length--;
+	}
+	return ~CRC;
+}
+
+#endif // HASHTOOLS_HAS_HARDWARE_CRC
+
+namespace HashToolsInternal
+{
+
+/** CRC-32C (Castagnoli) table, generated from polynomial 0x82F63B78 (reflected). */
+static uint32 Crc32CTable[256];
+
+static bool InitCrc32CTable()
+{
+	for (uint32 Index = 0; Index < 256; Index++)
+	{
+		uint32 Value = Index;
+		for (int32 Bit = 0; Bit < 8; Bit++)
+		{
+			Value = (Value & 1) ? (Value >> 1) ^ 0x82F63B78u : (Value >> 1);
+		}
+		Crc32CTable[Index] = Value;
+	}
+	return true;
+}
+
+static bool GCrc32CTableInitialized = InitCrc32CTable();
+
+static uint32 MemCrc32CSoftware(const void* Data, int64 Length, uint32 CRC)
+{
+	const uint8* Bytes = (const uint8*)Data;
+	CRC = ~CRC;
+	while (Length-- > 0)
+	{
+		CRC = (CRC >> 8) ^ Crc32CTable[(CRC ^ *Bytes++) & 0xFF];
+	}
+	return ~CRC;
+}
+
+} // namespace HashToolsInternal
+
+uint32 FHashTools::MemCrc32C(const void* Data, int64 Length, uint32 CRC)
+{
+#if HASHTOOLS_HAS_HARDWARE_CRC
+	if (GHardwareCrcAvailable)
+	{
+		return MemCrc32CHardware(Data, Length, CRC);
+	}
+#endif
+	return HashToolsInternal::MemCrc32CSoftware(Data, Length, CRC);
+}
+
+uint64 FHashTools::HashBytes64(const void* Data, int64 Length, uint64 Seed)
+{
+	// CityHash takes 32-bit lengths; chain seeds over chunks for the (rare) larger buffers
+	const char* Bytes = (const char*)Data;
+	const int64 MaxChunk = 1ll << 30;
+	uint64 Hash = Seed;
+	while (Length > MaxChunk)
+	{
+		Hash = CityHash64WithSeed(Bytes, (uint32)MaxChunk, Hash);
+		Bytes += MaxChunk;
+		Length -= MaxChunk;
+	}
+	return CityHash64WithSeed(Bytes, (uint32)Length, Hash);
+}
+
+bool FHashTools::IsHardwareCrcEnabled()
+{
+#if HASHTOOLS_HAS_HARDWARE_CRC
+	return GHardwareCrcAvailable;
+#else
+	return false;
+#endif
+}
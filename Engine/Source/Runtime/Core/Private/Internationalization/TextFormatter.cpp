@@ -1,6 +1,7 @@
 // Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
 
 #include "Internationalization/TextFormatter.h"
+#include "Internationalization/TextLocalizationManager.h"
 #include "Misc/ScopeLock.h"
 #include "Internationalization/TextFormatArgumentModifier.h"
 #include "Internationalization/TextHistory.h"
@@ -913,6 +914,153 @@ FTextFormatter::FCompileTextArgumentModifierFuncPtr FTextFormatter::FindTextArgu
 	return TextArgumentModifiers.FindRef(InKeyword);
 }
 
+namespace TextFormatResultCache
+{
+
+/** LRU of recent format results; see FTextFormat::FormatCached. */
+struct FCache
+{
+	struct FEntry
+	{
+		FText Result;
+		FString PatternSource;
+		uint64 LastUsed;
+	};
+
+	enum { MaxEntries = 256 };
+
+	FCriticalSection Lock;
+	TMap<uint64, FEntry> Entries;
+	uint64 AccessCounter = 0;
+
+	static FCache& Get()
+	{
+		static FCache Singleton;
+		return Singleton;
+	}
+};
+
+static FORCEINLINE uint64 CombineHash(uint64 Hash, uint64 Value)
+{
+	// 64-bit variant of boost-style hash combining; quality only needs to spread cache keys
+	return Hash ^ (Value + 0x9E3779B97F4A7C15ull + (Hash << 6) + (Hash >> 2));
+}
+
+static uint64 HashArgumentValue(uint64 Hash, const FFormatArgumentValue& Value)
+{
+	Hash = CombineHash(Hash, (uint64)Value.GetType());
+	switch (Value.GetType())
+	{
+	case EFormatArgumentType::Int:
+		return CombineHash(Hash, (uint64)Value.GetIntValue());
+	case EFormatArgumentType::UInt:
+		return CombineHash(Hash, Value.GetUIntValue());
+	case EFormatArgumentType::Float:
+	{
+		const float FloatValue = Value.GetFloatValue();
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &FloatValue, sizeof(Bits));
+		return CombineHash(Hash, Bits);
+	}
+	case EFormatArgumentType::Double:
+	{
+		const double DoubleValue = Value.GetDoubleValue();
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &DoubleValue, sizeof(Bits));
+		return CombineHash(Hash, Bits);
+	}
+	case EFormatArgumentType::Text:
+		return CombineHash(Hash, GetTypeHash(Value.GetTextValue().ToString()));
+	case EFormatArgumentType::Gender:
+		return CombineHash(Hash, (uint64)Value.GetGenderValue());
+	default:
+		return Hash;
+	}
+}
+
+template<typename ArgumentsType, typename ArgumentHasher, typename FormatFunc>
+static FText FormatThroughCache(const FTextFormat& Fmt, const ArgumentsType& Arguments, ArgumentHasher&& HashArguments, FormatFunc&& FormatMiss)
+{
+	uint64 Key = CombineHash(GetTypeHash(Fmt.GetSourceString()), FTextLocalizationManager::Get().GetTextRevision());
+	Key = HashArguments(Key);
+
+	FCache& Cache = FCache::Get();
+	{
+		FScopeLock ScopeLock(&Cache.Lock);
+		if (FCache::FEntry* Entry = Cache.Entries.Find(Key))
+		{
+			if (Entry->PatternSource.Equals(Fmt.GetSourceString(), ESearchCase::CaseSensitive))
+			{
+				Entry->LastUsed = ++Cache.AccessCounter;
+				return Entry->Result;
+			}
+		}
+	}
+
+	FText Result = FormatMiss();
+
+	{
+		FScopeLock ScopeLock(&Cache.Lock);
+		if (Cache.Entries.Num() >= FCache::MaxEntries)
+		{
+			// evict the least recently used entry; linear scan over a small fixed cap
+			uint64 OldestAccess = MAX_uint64;
+			uint64 OldestKey = 0;
+			for (const TPair<uint64, FCache::FEntry>& Pair : Cache.Entries)
+			{
+				if (Pair.Value.LastUsed < OldestAccess)
+				{
+					OldestAccess = Pair.Value.LastUsed;
+					OldestKey = Pair.Key;
+				}
+			}
+			Cache.Entries.Remove(OldestKey);
+		}
+		FCache::FEntry& Entry = Cache.Entries.Add(Key);
+		Entry.Result = Result;
+		Entry.PatternSource = Fmt.GetSourceString();
+		Entry.LastUsed = ++Cache.AccessCounter;
+	}
+	return Result;
+}
+
+} // namespace TextFormatResultCache
+
+FText FTextFormat::FormatCached(const FFormatNamedArguments& InArguments) const
+{
+	return TextFormatResultCache::FormatThroughCache(*this, InArguments,
+		[&InArguments](uint64 Hash)
+		{
+			for (const TPair<FString, FFormatArgumentValue>& Pair : InArguments)
+			{
+				Hash = TextFormatResultCache::CombineHash(Hash, GetTypeHash(Pair.Key));
+				Hash = TextFormatResultCache::HashArgumentValue(Hash, Pair.Value);
+			}
+			return Hash;
+		},
+		[this, &InArguments]()
+		{
+			return FTextFormatter::Format(FTextFormat(*this), CopyTemp(InArguments), false, false);
+		});
+}
+
+FText FTextFormat::FormatCached(const FFormatOrderedArguments& InArguments) const
+{
+	return TextFormatResultCache::FormatThroughCache(*this, InArguments,
+		[&InArguments](uint64 Hash)
+		{
+			for (const FFormatArgumentValue& Value : InArguments)
+			{
+				Hash = TextFormatResultCache::HashArgumentValue(Hash, Value);
+			}
+			return Hash;
+		},
+		[this, &InArguments]()
+		{
+			return FTextFormatter::Format(FTextFormat(*this), CopyTemp(InArguments), false, false);
+		});
+}
+
 FText FTextFormatter::Format(FTextFormat&& InFmt, FFormatNamedArguments&& InArguments, const bool bInRebuildText, const bool bInRebuildAsSource)
 {
 	FString ResultString = FormatStr(InFmt, InArguments, bInRebuildText, bInRebuildAsSource);
@@ -119,6 +119,16 @@ FTransform FTransform::GetRelativeTransformReverse(const FTransform& Other) cons
  * Set current transform and the relative to ParentTransform.
  * Equates to This = This->GetRelativeTransform(Parent), but saves the intermediate FTransform storage and copy.
  */
+void FTransform::TransformPositions(const FVector* RESTRICT InPositions, FVector* RESTRICT OutPositions, int32 Num) const
+{
+	DiagnosticCheckNaN_All();
+
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		OutPositions[Index] = Rotation.RotateVector(Scale3D * InPositions[Index]) + Translation;
+	}
+}
+
 void FTransform::SetToRelativeTransform(const FTransform& ParentTransform)
 {
 	// A * B(-1) = VQS(B)(-1) (VQS (A))
@@ -142,6 +142,24 @@ FTransform FTransform::GetRelativeTransformReverse(const FTransform& Other) cons
  * Set current transform and the relative to ParentTransform.
  * Equates to This = This->GetRelativeTransform(Parent), but saves the intermediate FTransform storage and copy.
  */
+void FTransform::TransformPositions(const FVector* RESTRICT InPositions, FVector* RESTRICT OutPositions, int32 Num) const
+{
+	DiagnosticCheckNaN_All();
+
+	// hoist the transform into registers once; the per-element work is then three ops and a quaternion rotate
+	const VectorRegister LocalScale = Scale3D;
+	const VectorRegister LocalRotation = Rotation;
+	const VectorRegister LocalTranslation = Translation;
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		const VectorRegister InputVectorW0 = VectorLoadFloat3_W0(&InPositions[Index]);
+		const VectorRegister ScaledVec = VectorMultiply(LocalScale, InputVectorW0);
+		const VectorRegister RotatedVec = VectorQuaternionRotateVector(LocalRotation, ScaledVec);
+		const VectorRegister TranslatedVec = VectorAdd(RotatedVec, LocalTranslation);
+		VectorStoreFloat3(TranslatedVec, &OutPositions[Index]);
+	}
+}
+
 void FTransform::SetToRelativeTransform(const FTransform& ParentTransform)
 {
 	// A * B(-1) = VQS(B)(-1) (VQS (A))
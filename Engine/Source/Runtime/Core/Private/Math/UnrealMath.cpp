@@ -569,6 +569,18 @@ uint32 FMatrix::ComputeHash() const
 //////////////////////////////////////////////////////////////////////////
 // FQuat
 
+void FQuat::RotateVectors(const FVector* RESTRICT InVectors, FVector* RESTRICT OutVectors, int32 Num) const
+{
+	DiagnosticCheckNaN();
+	const VectorRegister Q = VectorLoadAligned(this);
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		const VectorRegister InputVectorW0 = VectorLoadFloat3_W0(&InVectors[Index]);
+		const VectorRegister RotatedVec = VectorQuaternionRotateVector(Q, InputVectorW0);
+		VectorStoreFloat3(RotatedVec, &OutVectors[Index]);
+	}
+}
+
 FRotator FQuat::Rotator() const
 {
 	SCOPE_CYCLE_COUNTER(STAT_MathConvertQuatToRotator);
@@ -374,6 +374,152 @@ ICompressionFormat* FCompression::GetCompressionFormat(FName FormatName, bool bE
 
 }
 
+/**
+ * Built-in zlib streaming context. Reset uses deflateReset/inflateReset, so reusing a context across
+ * chunks skips the expensive (re)initialization, and the optional preset dictionary is re-applied on
+ * every reset, which is what dictionary-based packet/replay compression needs.
+ */
+class FZlibStreamContext : public ICompressionStreamContext
+{
+public:
+	FZlibStreamContext(bool bInCompressor, const TArray<uint8>* InDictionary, int32 BitWindow)
+		: bCompressor(bInCompressor)
+		, bValid(false)
+	{
+		if (InDictionary)
+		{
+			Dictionary = *InDictionary;
+		}
+		FMemory::Memzero(&Stream, sizeof(Stream));
+		Stream.zalloc = &zalloc;
+		Stream.zfree = &zfree;
+		const int32 WindowBits = BitWindow ? BitWindow : DEFAULT_ZLIB_BIT_WINDOW;
+		if (bCompressor)
+		{
+			bValid = deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, WindowBits, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY) == Z_OK;
+		}
+		else
+		{
+			bValid = inflateInit2(&Stream, WindowBits) == Z_OK;
+		}
+		if (bValid)
+		{
+			bValid = ApplyDictionary();
+		}
+	}
+
+	virtual ~FZlibStreamContext()
+	{
+		if (bCompressor)
+		{
+			deflateEnd(&Stream);
+		}
+		else
+		{
+			inflateEnd(&Stream);
+		}
+	}
+
+	bool IsValid() const
+	{
+		return bValid;
+	}
+
+	virtual bool CompressChunk(void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize, bool bFinish) override
+	{
+		check(bCompressor);
+		if (!bValid)
+		{
+			return false;
+		}
+		Stream.next_in = (uint8*)UncompressedBuffer;
+		Stream.avail_in = UncompressedSize;
+		Stream.next_out = (uint8*)CompressedBuffer;
+		Stream.avail_out = CompressedSize;
+		const int32 Result = deflate(&Stream, bFinish ? Z_FINISH : Z_SYNC_FLUSH);
+		if ((bFinish && Result != Z_STREAM_END) || (!bFinish && Result != Z_OK) || Stream.avail_in != 0)
+		{
+			return false;
+		}
+		CompressedSize = CompressedSize - (int32)Stream.avail_out;
+		return true;
+	}
+
+	virtual bool UncompressChunk(void* UncompressedBuffer, int32& UncompressedSize, const void* CompressedBuffer, int32 CompressedSize) override
+	{
+		check(!bCompressor);
+		if (!bValid)
+		{
+			return false;
+		}
+		Stream.next_in = (uint8*)CompressedBuffer;
+		Stream.avail_in = CompressedSize;
+		Stream.next_out = (uint8*)UncompressedBuffer;
+		Stream.avail_out = UncompressedSize;
+		int32 Result = inflate(&Stream, Z_SYNC_FLUSH);
+		if (Result == Z_NEED_DICT && Dictionary.Num())
+		{
+			Result = inflateSetDictionary(&Stream, Dictionary.GetData(), Dictionary.Num());
+			if (Result == Z_OK)
+			{
+				Result = inflate(&Stream, Z_SYNC_FLUSH);
+			}
+		}
+		if (Result != Z_OK && Result != Z_STREAM_END)
+		{
+			return false;
+		}
+		UncompressedSize = UncompressedSize - (int32)Stream.avail_out;
+		return true;
+	}
+
+	virtual bool Reset() override
+	{
+		if (!bValid)
+		{
+			return false;
+		}
+		const int32 Result = bCompressor ? deflateReset(&Stream) : inflateReset(&Stream);
+		return Result == Z_OK && ApplyDictionary();
+	}
+
+private:
+	bool ApplyDictionary()
+	{
+		if (!Dictionary.Num())
+		{
+			return true;
+		}
+		if (bCompressor)
+		{
+			return deflateSetDictionary(&Stream, Dictionary.GetData(), Dictionary.Num()) == Z_OK;
+		}
+		// the inflate side applies the dictionary on demand when Z_NEED_DICT comes back
+		return true;
+	}
+
+	z_stream Stream;
+	TArray<uint8> Dictionary;
+	bool bCompressor;
+	bool bValid;
+};
+
+ICompressionStreamContext* FCompression::CreateStreamContext(FName FormatName, bool bCompressor, const TArray<uint8>* Dictionary, int32 CompressionData)
+{
+	if (FormatName == NAME_Zlib)
+	{
+		FZlibStreamContext* Context = new FZlibStreamContext(bCompressor, Dictionary, CompressionData);
+		if (!Context->IsValid())
+		{
+			delete Context;
+			return nullptr;
+		}
+		return Context;
+	}
+	ICompressionFormat* Format = GetCompressionFormat(FormatName);
+	return Format ? Format->CreateStreamContext(bCompressor, Dictionary, CompressionData) : nullptr;
+}
+
 FName FCompression::GetCompressionFormatFromDeprecatedFlags(ECompressionFlags Flags)
 {
 	switch (Flags & COMPRESS_DeprecatedFormatFlagsMask)
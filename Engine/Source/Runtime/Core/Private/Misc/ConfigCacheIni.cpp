@@ -1926,6 +1926,12 @@ FConfigCacheIni::FConfigCacheIni()
 FConfigCacheIni::~FConfigCacheIni()
 {
 	Flush( 1 );
+
+	delete CurrentReadSnapshot.Load();
+	for (const FReadSnapshot* Retired : RetiredReadSnapshots)
+	{
+		delete Retired;
+	}
 }
 
 FConfigFile* FConfigCacheIni::FindConfigFile( const FString& Filename )
@@ -1965,6 +1971,77 @@ FConfigFile* FConfigCacheIni::FindConfigFileWithBaseName(FName BaseName)
 	return nullptr;
 }
 
+void FConfigCacheIni::RepublishReadOnlySnapshot()
+{
+	FReadSnapshot* NewSnapshot = new FReadSnapshot();
+	for (TPair<FString, FConfigFile>& FilePair : *this)
+	{
+		for (TPair<FString, FConfigSection>& SectionPair : FilePair.Value)
+		{
+			for (FConfigSectionMap::TConstIterator It(SectionPair.Value); It; ++It)
+			{
+				// later duplicates of a multi-value key overwrite earlier ones, matching what a plain GetString would hand back last
+				NewSnapshot->Values.Add(FReadSnapshot::MakeKey(FilePair.Key, *SectionPair.Key, *It.Key().ToString()), It.Value().GetValue());
+			}
+		}
+	}
+	// the exchange is the publication point; the snapshot is never mutated after it
+	const FReadSnapshot* OldSnapshot = CurrentReadSnapshot.Exchange(NewSnapshot);
+	if (OldSnapshot)
+	{
+		RetiredReadSnapshots.Add(OldSnapshot);
+	}
+}
+
+bool FConfigCacheIni::GetSnapshotString( const TCHAR* Section, const TCHAR* Key, FString& OutValue, const FString& Filename ) const
+{
+	const FReadSnapshot* Snapshot = CurrentReadSnapshot.Load();
+	if (Snapshot == nullptr)
+	{
+		return false;
+	}
+	const FString* Value = Snapshot->Values.Find(FReadSnapshot::MakeKey(Filename, Section, Key));
+	if (Value == nullptr)
+	{
+		return false;
+	}
+	OutValue = *Value;
+	return true;
+}
+
+bool FConfigCacheIni::GetSnapshotInt( const TCHAR* Section, const TCHAR* Key, int32& OutValue, const FString& Filename ) const
+{
+	FString Text;
+	if (GetSnapshotString(Section, Key, Text, Filename))
+	{
+		OutValue = FCString::Atoi(*Text);
+		return true;
+	}
+	return false;
+}
+
+bool FConfigCacheIni::GetSnapshotFloat( const TCHAR* Section, const TCHAR* Key, float& OutValue, const FString& Filename ) const
+{
+	FString Text;
+	if (GetSnapshotString(Section, Key, Text, Filename))
+	{
+		OutValue = FCString::Atof(*Text);
+		return true;
+	}
+	return false;
+}
+
+bool FConfigCacheIni::GetSnapshotBool( const TCHAR* Section, const TCHAR* Key, bool& OutValue, const FString& Filename ) const
+{
+	FString Text;
+	if (GetSnapshotString(Section, Key, Text, Filename))
+	{
+		OutValue = FCString::ToBool(*Text);
+		return true;
+	}
+	return false;
+}
+
 void FConfigCacheIni::Flush( bool Read, const FString& Filename )
 {
 	// never Flush temporary cache objects
@@ -2002,6 +2079,8 @@ void FConfigCacheIni::Flush( bool Read, const FString& Filename )
 			Empty();
 		}
 	}
+
+	ConditionalRepublishReadOnlySnapshot();
 }
 
 /**
@@ -2351,6 +2430,8 @@ void FConfigCacheIni::SetString( const TCHAR* Section, const TCHAR* Key, const T
 		File->Dirty = true;
 		*ConfigValue = FConfigValue(Value);
 	}
+
+	ConditionalRepublishReadOnlySnapshot();
 }
 
 void FConfigCacheIni::SetText( const TCHAR* Section, const TCHAR* Key, const FText& Value, const FString& Filename )
@@ -2378,6 +2459,8 @@ void FConfigCacheIni::SetText( const TCHAR* Section, const TCHAR* Key, const FTe
 		File->Dirty = true;
 		*ConfigValue = FConfigValue(StrValue);
 	}
+
+	ConditionalRepublishReadOnlySnapshot();
 }
 
 bool FConfigCacheIni::RemoveKey( const TCHAR* Section, const TCHAR* Key, const FString& Filename )
@@ -2391,6 +2474,7 @@ bool FConfigCacheIni::RemoveKey( const TCHAR* Section, const TCHAR* Key, const F
 			if( Sec->Remove(Key) > 0 )
 			{
 				File->Dirty = 1;
+				ConditionalRepublishReadOnlySnapshot();
 				return true;
 			}
 		}
@@ -2424,6 +2508,7 @@ bool FConfigCacheIni::EmptySection( const TCHAR* Section, const FString& Filenam
 					IFileManager::Get().Delete(*Filename);	
 				}
 			}
+			ConditionalRepublishReadOnlySnapshot();
 			return true;
 		}
 	}
@@ -2438,6 +2523,7 @@ bool FConfigCacheIni::EmptySectionsMatchingString( const TCHAR* SectionString, c
 	{
 		bool bSaveOpsDisabled = bAreFileOperationsDisabled;
 		bAreFileOperationsDisabled = true;
+		bSuppressSnapshotRepublish = true;
 		for (FConfigFile::TIterator It(*File); It; ++It)
 		{
 			if (It.Key().Contains(SectionString) )
@@ -2445,7 +2531,12 @@ bool FConfigCacheIni::EmptySectionsMatchingString( const TCHAR* SectionString, c
 				bEmptied |= EmptySection(*(It.Key()), Filename);
 			}
 		}
+		bSuppressSnapshotRepublish = false;
 		bAreFileOperationsDisabled = bSaveOpsDisabled;
+		if (bEmptied)
+		{
+			ConditionalRepublishReadOnlySnapshot();
+		}
 	}
 	return bEmptied;
 }
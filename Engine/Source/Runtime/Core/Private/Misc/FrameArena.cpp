@@ -0,0 +1,107 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/FrameArena.h"
+#include "Stats/Stats.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/CoreDelegates.h"
+#include "Containers/Array.h"
+#include "Logging/LogMacros.h"
+#include "CoreGlobals.h"
+
+DECLARE_MEMORY_STAT(TEXT("FrameArena Used"), STAT_FrameArenaUsed, STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("FrameArena High Water"), STAT_FrameArenaHighWater, STATGROUP_Memory);
+
+/** Registry of every thread's arena so the end-of-frame reset and the high-water dump can reach them all. **/
+static FCriticalSection GFrameArenaRegistryLock;
+static TArray<FFrameArena*> GFrameArenaRegistry;
+static bool GFrameArenaResetHookInstalled = false;
+
+FFrameArena::FFrameArena()
+	: Top(nullptr)
+	, End(nullptr)
+	, TopPage(nullptr)
+	, OversizedBlocks(nullptr)
+	, BytesAllocated(0)
+	, HighWaterMark(0)
+	, OwnerThreadId(FPlatformTLS::GetCurrentThreadId())
+{
+	FScopeLock Lock(&GFrameArenaRegistryLock);
+	GFrameArenaRegistry.Add(this);
+	if (!GFrameArenaResetHookInstalled)
+	{
+		GFrameArenaResetHookInstalled = true;
+		FCoreDelegates::OnEndFrame.AddStatic(&FFrameArena::ResetAll);
+	}
+}
+
+FFrameArena::~FFrameArena()
+{
+	Reset();
+	FScopeLock Lock(&GFrameArenaRegistryLock);
+	GFrameArenaRegistry.Remove(this);
+}
+
+void FFrameArena::AllocateNewPage()
+{
+	FPage* Page = (FPage*)FPageAllocator::Alloc();
+	Page->Next = TopPage;
+	TopPage = Page;
+	Top = (uint8*)(Page + 1);
+	End = (uint8*)Page + FPageAllocator::PageSize;
+}
+
+void FFrameArena::Reset()
+{
+	while (TopPage)
+	{
+		FPage* Page = TopPage;
+		TopPage = Page->Next;
+		FPageAllocator::Free(Page);
+	}
+	while (OversizedBlocks)
+	{
+		FOversizedBlock* Block = OversizedBlocks;
+		OversizedBlocks = Block->Next;
+		FMemory::Free(Block);
+	}
+	Top = nullptr;
+	End = nullptr;
+	HighWaterMark = FMath::Max(HighWaterMark, BytesAllocated);
+	BytesAllocated = 0;
+}
+
+void FFrameArena::ResetAll()
+{
+	SIZE_T TotalUsed = 0;
+	SIZE_T TotalHighWater = 0;
+	{
+		FScopeLock Lock(&GFrameArenaRegistryLock);
+		for (FFrameArena* Arena : GFrameArenaRegistry)
+		{
+			TotalUsed += Arena->GetByteCount();
+			// Frame-scoped allocations must be finished by end of frame on every thread, so resetting
+			// other threads' arenas here is safe by the same contract that makes the allocations usable at all.
+			Arena->Reset();
+			TotalHighWater += Arena->GetHighWaterMark();
+		}
+	}
+	SET_MEMORY_STAT(STAT_FrameArenaUsed, TotalUsed);
+	SET_MEMORY_STAT(STAT_FrameArenaHighWater, TotalHighWater);
+}
+
+void FFrameArena::DumpHighWaterMarks()
+{
+	FScopeLock Lock(&GFrameArenaRegistryLock);
+	UE_LOG(LogMemory, Display, TEXT("FrameArena high-water marks (%d arenas):"), GFrameArenaRegistry.Num());
+	for (FFrameArena* Arena : GFrameArenaRegistry)
+	{
+		UE_LOG(LogMemory, Display, TEXT("  Thread %u: %llu bytes"), Arena->OwnerThreadId, (uint64)Arena->GetHighWaterMark());
+	}
+}
+
+static FAutoConsoleCommand GFrameArenaDumpHighWaterMarksCmd(
+	TEXT("frameArena.DumpHighWaterMarks"),
+	TEXT("Logs the per-thread frame arena high-water marks so the page budget can be sized."),
+	FConsoleCommandDelegate::CreateStatic(&FFrameArena::DumpHighWaterMarks));
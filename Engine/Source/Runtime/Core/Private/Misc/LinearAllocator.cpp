@@ -0,0 +1,85 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/LinearAllocator.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/CoreDelegates.h"
+#include "Containers/Array.h"
+#include "Logging/LogMacros.h"
+#include "CoreGlobals.h"
+
+/** Registry of live allocators for the end-of-frame sweep and the dump command. **/
+static FCriticalSection GLinearAllocatorRegistryLock;
+static TArray<FNamedLinearAllocator*> GLinearAllocatorRegistry;
+static bool GLinearAllocatorEndFrameHookInstalled = false;
+
+FNamedLinearAllocator::FNamedLinearAllocator(const TCHAR* InName, ELinearAllocatorLifetime InLifetime)
+	: FMemStackBase(0) // no marks required; EndLifetime is the boundary
+	, Name(InName)
+	, Lifetime(InLifetime)
+	, HighWaterMark(0)
+	, LastResetFrame(GFrameCounter)
+	, bReportedMissedReset(false)
+{
+	FScopeLock Lock(&GLinearAllocatorRegistryLock);
+	GLinearAllocatorRegistry.Add(this);
+	if (!GLinearAllocatorEndFrameHookInstalled)
+	{
+		GLinearAllocatorEndFrameHookInstalled = true;
+		FCoreDelegates::OnEndFrame.AddStatic(&FNamedLinearAllocator::OnEndFrame);
+	}
+}
+
+FNamedLinearAllocator::~FNamedLinearAllocator()
+{
+	FScopeLock Lock(&GLinearAllocatorRegistryLock);
+	GLinearAllocatorRegistry.Remove(this);
+}
+
+void FNamedLinearAllocator::EndLifetime()
+{
+	check(!GetNumMarks()); // a mark still on the stack at the lifetime boundary is a scoping bug in the owning system
+	HighWaterMark = FMath::Max<SIZE_T>(HighWaterMark, GetByteCount());
+	Flush();
+	LastResetFrame = GFrameCounter;
+	bReportedMissedReset = false;
+}
+
+void FNamedLinearAllocator::OnEndFrame()
+{
+	FScopeLock Lock(&GLinearAllocatorRegistryLock);
+	for (FNamedLinearAllocator* Allocator : GLinearAllocatorRegistry)
+	{
+		if (Allocator->Lifetime == ELinearAllocatorLifetime::Frame)
+		{
+			Allocator->EndLifetime();
+		}
+		else if (Allocator->Lifetime == ELinearAllocatorLifetime::TickGroup && !Allocator->bReportedMissedReset
+			&& !Allocator->IsEmpty() && GFrameCounter > Allocator->LastResetFrame)
+		{
+			// a tick-group allocator holding memory across the frame boundary is leaking by the terms of its contract
+			UE_LOG(LogMemory, Warning,
+				TEXT("Linear allocator '%s' declared TickGroup lifetime but still holds %d bytes at end of frame (last reset frame %llu, now %llu)"),
+				Allocator->Name, Allocator->GetByteCount(), Allocator->LastResetFrame, GFrameCounter);
+			Allocator->bReportedMissedReset = true;
+		}
+	}
+}
+
+void FNamedLinearAllocator::DumpAllocators()
+{
+	static const TCHAR* LifetimeNames[] = { TEXT("Frame"), TEXT("TickGroup"), TEXT("AsyncTask") };
+	FScopeLock Lock(&GLinearAllocatorRegistryLock);
+	UE_LOG(LogMemory, Display, TEXT("Named linear allocators (%d live):"), GLinearAllocatorRegistry.Num());
+	for (FNamedLinearAllocator* Allocator : GLinearAllocatorRegistry)
+	{
+		UE_LOG(LogMemory, Display, TEXT("  %s [%s]: %d bytes now, %llu high water, last reset frame %llu"),
+			Allocator->Name, LifetimeNames[(uint8)Allocator->Lifetime], Allocator->GetByteCount(),
+			(uint64)Allocator->HighWaterMark, Allocator->LastResetFrame);
+	}
+}
+
+static FAutoConsoleCommand GLinearAllocatorDumpCmd(
+	TEXT("linearAlloc.Dump"),
+	TEXT("Logs every named linear allocator with current bytes, high-water mark and reset cadence."),
+	FConsoleCommandDelegate::CreateStatic(&FNamedLinearAllocator::DumpAllocators));
@@ -163,21 +163,14 @@ void FOutputDeviceRedirector::InternalFlushThreadedLogs(bool bUseAllDevices)
  */
 void FOutputDeviceRedirector::InternalFlushThreadedLogs(TLocalOutputDevicesArray& InBufferedDevices, bool bUseAllDevices)
 {	
-	if (BufferedLines.Num())
+	if (!BufferedLines.IsEmpty())
 	{
-		TArray<FBufferedLine, TInlineAllocator<64>> LocalBufferedLines;
-		{
-			FScopeLock ScopeLock(&BufferSynchronizationObject);
-			LocalBufferedLines.AddUninitialized(BufferedLines.Num());
-			for (int32 LineIndex = 0; LineIndex < BufferedLines.Num(); LineIndex++)
-			{
-				new(&LocalBufferedLines[LineIndex]) FBufferedLine(BufferedLines[LineIndex], FBufferedLine::EMoveCtor);
-			}
-			EmptyBufferedLines();
-		}
+		TArray<FBufferedLine*> LocalBufferedLines;
+		BufferedLines.PopAll(LocalBufferedLines);
 
-		for (FBufferedLine& Line : LocalBufferedLines)
+		for (FBufferedLine* LinePtr : LocalBufferedLines)
 		{
+			FBufferedLine& Line = *LinePtr;
 			const TCHAR* Data = Line.Data;
 			const FLazyName Category = Line.Category;
 			const double Time = Line.Time;
@@ -190,17 +183,17 @@ void FOutputDeviceRedirector::InternalFlushThreadedLogs(TLocalOutputDevicesArray
 					OutputDevice->Serialize(Data, Verbosity, Category, Time);
 				}
 			}
+
+			delete LinePtr;
 		}
 	}
 }
 
 void FOutputDeviceRedirector::EmptyBufferedLines()
 {
-	BufferedLines.Empty();
-
-	if (BufferedLinesAllocator)
+	while (FBufferedLine* Line = BufferedLines.Pop())
 	{
-		BufferedLinesAllocator->Reset();
+		delete Line;
 	}
 }
 
@@ -339,8 +332,8 @@ void FOutputDeviceRedirector::SerializeImpl(const TCHAR* Data, ELogVerbosity::Ty
 
 	if (FPlatformTLS::GetCurrentThreadId() != MasterThreadID || LocalBufferedDevices.Num() == 0)
 	{
-		FScopeLock ScopeLock(&BufferSynchronizationObject);
-		new(BufferedLines)FBufferedLine(Data, Category, Verbosity, RealTime, BufferedLinesAllocator);
+		// lock-free staging; the line is heap-owned so the shared bump allocator (which would need the old lock) is bypassed
+		BufferedLines.Push(new FBufferedLine(Data, Category, Verbosity, RealTime, nullptr));
 	}
 	else
 	{
@@ -439,6 +432,9 @@ void FOutputDeviceRedirector::TearDown()
 		OutputDevice->TearDown();
 	}
 
+	// lines staged between the flush above and process exit have nowhere to go
+	EmptyBufferedLines();
+
 	UnlockOutputDevices();
 }
 
@@ -72,6 +72,31 @@ TAutoConsoleVariable<int32> CVarCsvBlockOnCaptureEnd(
 	ECVF_Default
 );
 
+static float GCsvHitchCaptureBudgetMs = 0.0f;
+static FAutoConsoleVariableRef CVarCsvHitchCaptureBudgetMs(
+	TEXT("csv.HitchCaptureBudgetMs"),
+	GCsvHitchCaptureBudgetMs,
+	TEXT("If > 0 and no capture is running, a game thread frame exceeding this budget automatically starts a short CSV capture\r\n")
+	TEXT("(csv.HitchCaptureNumFrames frames into Saved/Profiling/Hitches), so hitches self-attribute in untethered QA and soak runs."),
+	ECVF_Default
+);
+
+static int32 GCsvHitchCaptureNumFrames = 10;
+static FAutoConsoleVariableRef CVarCsvHitchCaptureNumFrames(
+	TEXT("csv.HitchCaptureNumFrames"),
+	GCsvHitchCaptureNumFrames,
+	TEXT("Number of frames an automatic hitch-triggered capture records."),
+	ECVF_Default
+);
+
+static float GCsvHitchCaptureCooldownSeconds = 30.0f;
+static FAutoConsoleVariableRef CVarCsvHitchCaptureCooldownSeconds(
+	TEXT("csv.HitchCaptureCooldownSeconds"),
+	GCsvHitchCaptureCooldownSeconds,
+	TEXT("Minimum seconds between automatic hitch-triggered captures."),
+	ECVF_Default
+);
+
 TAutoConsoleVariable<int32> CVarCsvContinuousWrites(
 	TEXT("csv.ContinuousWrites"),
 	0,
@@ -2606,6 +2631,31 @@ void FCsvProfiler::EndFrame()
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(CsvProfiler);
 
 	check(IsInGameThread());
+
+	// Hitch-triggered self-capture: when enabled and nothing is capturing, an over-budget frame
+	// starts a short automatic capture so untethered QA and soak runs record per-scope timing
+	// attribution for the frames around the hitch. Detection is one frame late by nature - the
+	// hitch frame itself has already passed when it's measured - but hitches cluster, and the
+	// capture plus the log line below name the window and the culprit scopes that follow.
+	{
+		static uint64 LastHitchCheckTimestamp = 0;
+		static double LastHitchCaptureTime = -MAX_dbl;
+		const uint64 NowCycles = FPlatformTime::Cycles64();
+		if (GCsvHitchCaptureBudgetMs > 0.0f && LastHitchCheckTimestamp != 0 && !GCsvProfilerIsCapturing && !GCsvProfilerIsWritingFile)
+		{
+			const float FrameMs = FPlatformTime::ToMilliseconds64(NowCycles - LastHitchCheckTimestamp);
+			const double NowSeconds = FPlatformTime::Seconds();
+			if (FrameMs > GCsvHitchCaptureBudgetMs && NowSeconds - LastHitchCaptureTime > GCsvHitchCaptureCooldownSeconds)
+			{
+				LastHitchCaptureTime = NowSeconds;
+				UE_LOG(LogCsvProfiler, Warning, TEXT("Game thread frame took %.2fms (budget %.2fms); starting automatic %d frame hitch capture."),
+					FrameMs, GCsvHitchCaptureBudgetMs, FMath::Max(1, GCsvHitchCaptureNumFrames));
+				BeginCapture(FMath::Max(1, GCsvHitchCaptureNumFrames), FPaths::ProfilingDir() / TEXT("Hitches"));
+			}
+		}
+		LastHitchCheckTimestamp = NowCycles;
+	}
+
 	if (GCsvProfilerIsCapturing)
 	{
 		if (NumFramesToCapture >= 0)
@@ -144,7 +144,9 @@ void FBitReader::SetData( uint8* Src, int64 CountBits )
 	Pos			= 0;
 	ArIsError	= 0;
 
-	Buffer.Empty();
+	// Keep the existing allocation; readers reused per packet (net receive paths) should not
+	// pay a heap round trip per call.
+	Buffer.Reset();
 	Buffer.AddUninitialized( (Num+7)>>3 );
 	
 	if (Src != nullptr)
@@ -182,7 +184,7 @@ void FBitReader::SetData( FBitReader& Src, int64 CountBits )
 	this->SetEngineNetVer(Src.EngineNetVer());
 	this->SetGameNetVer(Src.GameNetVer());
 
-	Buffer.Empty();
+	Buffer.Reset();
 	Buffer.AddUninitialized( (CountBits+7)>>3 );
 	Src.SerializeBits(Buffer.GetData(), CountBits);
 }
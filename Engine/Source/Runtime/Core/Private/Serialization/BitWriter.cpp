@@ -139,6 +139,19 @@ void FBitWriter::SerializeInt(uint32& Value, uint32 ValueMax)
 
 	if (AllowAppend(LengthBits))
 	{
+#if PLATFORM_LITTLE_ENDIAN
+		// For a power-of-two range the loop below can never terminate early, so exactly
+		// LengthBits of the value go out LSB-first - the same stream SerializeBits produces.
+		// Copy them in bulk instead of bit by bit; quantized vectors/rotators live here.
+		if (FMath::IsPowerOfTwo(ValueMax))
+		{
+			uint32 LocalValue = WriteValue;
+			appBitsCpy(Buffer.GetData(), Num, (uint8*)&LocalValue, 0, LengthBits);
+			Num += LengthBits;
+			return;
+		}
+#endif
+
 		uint32 NewValue = 0;
 		int64 LocalNum = Num;	// Use local var to avoid LHS
 
@@ -0,0 +1,88 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Containers/FlatMap.h"
+#include "Containers/UnrealString.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlatMapTest, "System.Core.Misc.FlatMap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FFlatMapTest::RunTest(const FString& Parameters)
+{
+	// add, find, replace, remove through enough elements to force several rehashes
+	{
+		TFlatMap<int32, int32> Map;
+
+		const int32 NumElements = 1000;
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			Map.Add(Index, Index * 3);
+		}
+		TestEqual(TEXT("All added elements must be counted"), Map.Num(), NumElements);
+
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			const int32* Value = Map.Find(Index);
+			TestNotNull(TEXT("Every added key must be findable"), Value);
+			if (Value)
+			{
+				TestEqual(TEXT("Found values must match"), *Value, Index * 3);
+			}
+		}
+		TestNull(TEXT("Absent keys must not be found"), Map.Find(NumElements + 1));
+
+		Map.Add(7, 99);
+		TestEqual(TEXT("Adding an existing key must replace the value"), Map.FindRef(7), 99);
+		TestEqual(TEXT("Adding an existing key must not grow the map"), Map.Num(), NumElements);
+
+		// remove every other element, then verify lookups still resolve across the tombstones
+		for (int32 Index = 0; Index < NumElements; Index += 2)
+		{
+			TestEqual(TEXT("Removing a present key must remove one element"), Map.Remove(Index), 1);
+		}
+		TestEqual(TEXT("Removed elements must be uncounted"), Map.Num(), NumElements / 2);
+		for (int32 Index = 1; Index < NumElements; Index += 2)
+		{
+			TestNotNull(TEXT("Surviving keys must still be findable"), Map.Find(Index));
+		}
+		TestEqual(TEXT("Removing an absent key must remove nothing"), Map.Remove(4), 0);
+	}
+
+	// RemoveAndCopyValue and iteration
+	{
+		TFlatMap<FString, int32> Map;
+		Map.Add(TEXT("One"), 1);
+		Map.Add(TEXT("Two"), 2);
+		Map.Add(TEXT("Three"), 3);
+
+		int32 Removed = 0;
+		TestTrue(TEXT("RemoveAndCopyValue must succeed for present keys"), Map.RemoveAndCopyValue(TEXT("Two"), Removed));
+		TestEqual(TEXT("RemoveAndCopyValue must hand back the value"), Removed, 2);
+
+		int32 Sum = 0;
+		int32 Count = 0;
+		for (const TPair<FString, int32>& Pair : Map)
+		{
+			Sum += Pair.Value;
+			++Count;
+		}
+		TestEqual(TEXT("Iteration must visit each surviving element once"), Count, 2);
+		TestEqual(TEXT("Iteration must see the surviving values"), Sum, 4);
+	}
+
+	// Empty with expected size keeps the map usable
+	{
+		TFlatMap<int32, FString> Map;
+		Map.Add(1, TEXT("A"));
+		Map.Empty(64);
+		TestEqual(TEXT("Empty must destroy all elements"), Map.Num(), 0);
+		Map.Add(2, TEXT("B"));
+		TestEqual(TEXT("The map must be usable after Empty"), Map.FindRef(2), FString(TEXT("B")));
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
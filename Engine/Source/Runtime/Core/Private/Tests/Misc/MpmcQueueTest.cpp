@@ -0,0 +1,90 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Containers/MpmcQueue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMpmcQueueTest, "System.Core.Misc.MpmcQueue", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FMpmcQueueTest::RunTest(const FString& Parameters)
+{
+	const uint32 QueueSize = 8;
+
+	// empty queue
+	{
+		TMpmcQueue<int32> Queue(QueueSize);
+
+		TestTrue(TEXT("Newly created queues must be empty"), Queue.IsEmpty());
+		TestEqual(TEXT("Capacity must round up to a power of two"), Queue.GetCapacity(), QueueSize);
+
+		int32 Value;
+		TestFalse(TEXT("Dequeue must fail on an empty queue"), Queue.TryDequeue(Value));
+	}
+
+	// fill, overfill, drain in order
+	{
+		TMpmcQueue<int32> Queue(QueueSize);
+
+		for (int32 Index = 0; Index < (int32)QueueSize; ++Index)
+		{
+			TestTrue(TEXT("Adding to non-full queue must succeed"), Queue.TryEnqueue(Index));
+		}
+		TestFalse(TEXT("Adding to a full queue must fail"), Queue.TryEnqueue(666));
+		TestFalse(TEXT("Full queues must not be empty"), Queue.IsEmpty());
+
+		int32 Value = 0;
+		for (int32 Index = 0; Index < (int32)QueueSize; ++Index)
+		{
+			TestTrue(TEXT("Removing from a non-empty queue must succeed"), Queue.TryDequeue(Value));
+			TestEqual(TEXT("Elements must come out first-in first-out"), Value, Index);
+		}
+		TestTrue(TEXT("A drained queue must be empty"), Queue.IsEmpty());
+	}
+
+	// cursor wrap-around across many laps
+	{
+		TMpmcQueue<int32> Queue(QueueSize);
+		int32 Value = 0;
+
+		for (int32 Lap = 0; Lap < 100; ++Lap)
+		{
+			TestTrue(TEXT("Adding to non-full queue must succeed"), Queue.TryEnqueue(Lap));
+			TestTrue(TEXT("Removing from a non-empty queue must succeed"), Queue.TryDequeue(Value));
+			TestEqual(TEXT("Elements must survive ring wrap-around"), Value, Lap);
+		}
+		TestTrue(TEXT("Queue must be empty after balanced enqueue/dequeue"), Queue.IsEmpty());
+	}
+
+	// construction/destruction balance for non-POD elements, including ones left queued at destruction
+	{
+		static int32 Alive;
+		struct FNonPOD
+		{
+			bool bCounted;
+			FNonPOD() : bCounted(true) { Alive++; }
+			FNonPOD(const FNonPOD&) : bCounted(true) { Alive++; }
+			FNonPOD(FNonPOD&& Other) : bCounted(true) { Alive++; }
+			~FNonPOD() { Alive--; }
+		};
+
+		Alive = 0;
+		{
+			TMpmcQueue<FNonPOD> Queue(QueueSize);
+
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				Queue.TryEnqueue(FNonPOD());
+			}
+
+			FNonPOD Popped;
+			TestTrue(TEXT("Removing from a non-empty queue must succeed"), Queue.TryDequeue(Popped));
+		}
+		TestEqual(TEXT("Every constructed element must be destructed, including those still queued"), Alive, 0);
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -305,6 +305,26 @@ public:
 		return FNameEntryHandle(CurrentBlock, ByteOffset / Stride);
 	}
 
+	/**
+	 * Packs the first characters of the name, case-folded the same way the case-insensitive compares
+	 * fold, big-endian into one integer. Key inequality then orders entries exactly like the string
+	 * comparison; key equality (shared prefix) falls back to the full compare. Every character outside
+	 * ASCII folds to one sentinel byte because the platform string compares do not agree on non-ASCII
+	 * ordering: such names collide at that byte and resolve through the exact comparison instead.
+	 */
+	static uint64 ComputeLexicalSortKey(FNameStringView Name)
+	{
+		uint64 Key = 0;
+		const uint32 NumChars = FMath::Min<uint32>(Name.Len, 8);
+		for (uint32 Index = 0; Index < NumChars; Index++)
+		{
+			uint32 Char = Name.bIsWide ? (uint32)(uint16)Name.Wide[Index] : (uint32)(uint8)Name.Ansi[Index];
+			Char = Char < 0x80 ? (uint32)TChar<WIDECHAR>::ToLower((WIDECHAR)Char) : 0xFF;
+			Key |= uint64(Char) << (56 - Index * 8);
+		}
+		return Key;
+	}
+
 	FNameEntryHandle Create(FNameStringView Name, TOptional<FNameEntryId> ComparisonId, FNameEntryHeader Header)
 	{
 		FNameEntryHandle Handle = Allocate(FNameEntry::GetDataOffset() + Name.BytesWithoutTerminator());
@@ -315,6 +335,7 @@ public:
 #endif
 
 		Entry.Header = Header;
+		Entry.LexicalSortKey = ComputeLexicalSortKey(Name);
 		
 		if (Name.bIsWide)
 		{
@@ -1731,6 +1752,25 @@ bool FName::operator==(const WIDECHAR* Str) const
 	return FNameHelper::EqualsString(*this, Str);
 }
 
+int32 FName::CompareFast( const FName& Other ) const
+{
+	// Names match, check whether numbers match.
+	if (ComparisonIndex == Other.ComparisonIndex)
+	{
+		return GetNumber() - Other.GetNumber();
+	}
+
+	// The precomputed keys order identically to the string compare whenever they differ; only names
+	// sharing their leading characters pay for the full comparison.
+	const uint64 Key = GetComparisonNameEntry()->GetLexicalSortKey();
+	const uint64 OtherKey = Other.GetComparisonNameEntry()->GetLexicalSortKey();
+	if (Key != OtherKey)
+	{
+		return Key < OtherKey ? -1 : 1;
+	}
+	return CompareDifferentIdsAlphabetically(ComparisonIndex, Other.ComparisonIndex);
+}
+
 int32 FName::Compare( const FName& Other ) const
 {
 	// Names match, check whether numbers match.
@@ -35,6 +35,9 @@
 #include <net/if.h>
 #include <net/if_arp.h>
 #include <linux/limits.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
 
 #include "Modules/ModuleManager.h"
 #include "HAL/ThreadHeartBeat.h"
@@ -563,6 +566,82 @@ int32 FUnixPlatformMisc::NumberOfCoresIncludingHyperthreads()
 	return NumCoreIds;
 }
 
+int32 FUnixPlatformMisc::NumberOfNumaNodes()
+{
+	// WARNING: like NumberOfCores() this caches the first answer forever; nodes going on/offline are ignored
+	static int32 NodeCount = 0;
+	if (NodeCount == 0)
+	{
+		// each online node is exposed as /sys/devices/system/node/nodeN
+		for (int32 NodeIdx = 0; ; ++NodeIdx)
+		{
+			char FileNameBuffer[128];
+			FCStringAnsi::Sprintf(FileNameBuffer, "/sys/devices/system/node/node%d/cpulist", NodeIdx);
+			if (access(FileNameBuffer, F_OK) != 0)
+			{
+				break;
+			}
+			++NodeCount;
+		}
+		if (NodeCount == 0)
+		{
+			NodeCount = 1;
+		}
+	}
+	return NodeCount;
+}
+
+uint64 FUnixPlatformMisc::GetNumaNodeProcessorMask(int32 NumaNode)
+{
+	if (NumaNode < 0 || NumaNode >= NumberOfNumaNodes())
+	{
+		return 0xFFFFFFFFFFFFFFFF;
+	}
+
+	char FileNameBuffer[128];
+	FCStringAnsi::Sprintf(FileNameBuffer, "/sys/devices/system/node/node%d/cpulist", NumaNode);
+	FILE* CpuListFile = fopen(FileNameBuffer, "r");
+	if (CpuListFile == nullptr)
+	{
+		return 0xFFFFFFFFFFFFFFFF;
+	}
+
+	// cpulist is a comma separated list of ranges, e.g. "0-15,32-47"
+	uint64 Mask = 0;
+	char LineBuffer[256];
+	if (fgets(LineBuffer, sizeof(LineBuffer), CpuListFile) != nullptr)
+	{
+		char* Cursor = LineBuffer;
+		while (*Cursor)
+		{
+			int RangeFirst = -1;
+			int RangeLast = -1;
+			int NumParsed = sscanf(Cursor, "%d-%d", &RangeFirst, &RangeLast);
+			if (NumParsed <= 0)
+			{
+				break;
+			}
+			if (NumParsed == 1)
+			{
+				RangeLast = RangeFirst;
+			}
+			for (int CpuIdx = RangeFirst; CpuIdx <= RangeLast && CpuIdx < 64; ++CpuIdx)
+			{
+				Mask |= uint64(1) << CpuIdx;
+			}
+			Cursor = strchr(Cursor, ',');
+			if (Cursor == nullptr)
+			{
+				break;
+			}
+			++Cursor;
+		}
+	}
+	fclose(CpuListFile);
+	// CPUs past the 64 addressable by our affinity masks cannot be expressed; fall back to unrestricted if nothing fit
+	return Mask != 0 ? Mask : 0xFFFFFFFFFFFFFFFF;
+}
+
 const TCHAR* FUnixPlatformMisc::GetNullRHIShaderFormat()
 {
 	return TEXT("SF_VULKAN_SM5");
@@ -1711,6 +1711,39 @@ int32 FWindowsPlatformMisc::NumberOfCoresIncludingHyperthreads()
 	return CoreCount;
 }
 
+int32 FWindowsPlatformMisc::NumberOfNumaNodes()
+{
+	static int32 NodeCount = 0;
+	if (NodeCount == 0)
+	{
+		ULONG HighestNodeNumber = 0;
+		if (GetNumaHighestNodeNumber(&HighestNodeNumber))
+		{
+			NodeCount = (int32)HighestNodeNumber + 1;
+		}
+		else
+		{
+			NodeCount = 1;
+		}
+	}
+	return NodeCount;
+}
+
+uint64 FWindowsPlatformMisc::GetNumaNodeProcessorMask(int32 NumaNode)
+{
+	if (NumaNode >= 0 && NumaNode < NumberOfNumaNodes())
+	{
+		GROUP_AFFINITY GroupAffinity;
+		FMemory::Memzero(GroupAffinity);
+		// Note: processor groups beyond the first are not addressable through our 64-bit affinity masks, so only group 0 masks are honored.
+		if (GetNumaNodeProcessorMaskEx((USHORT)NumaNode, &GroupAffinity) && GroupAffinity.Group == 0 && GroupAffinity.Mask != 0)
+		{
+			return (uint64)GroupAffinity.Mask;
+		}
+	}
+	return 0xFFFFFFFFFFFFFFFF;
+}
+
 const TCHAR* FWindowsPlatformMisc::GetPlatformFeaturesModuleName()
 {
 	bool bModuleExists = FModuleManager::Get().ModuleExists(TEXT("WindowsPlatformFeatures"));
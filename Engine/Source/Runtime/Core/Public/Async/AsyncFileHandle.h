@@ -8,6 +8,8 @@
 #include "Stats/Stats.h"
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "Templates/Function.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 
 class IAsyncReadRequest;
 
@@ -175,6 +177,17 @@ protected:
 	}
 };
 
+/** One span of a scatter-gather read batch: source range plus optional caller-owned destination. */
+struct FScatterGatherReadSpan
+{
+	/** Offset into the file to start reading. */
+	int64 Offset = 0;
+	/** Number of bytes to read; offset and size must be fully contained in the file. */
+	int64 BytesToRead = 0;
+	/** Destination for this span; when null, memory is allocated and returned through the span's request. */
+	uint8* UserSuppliedMemory = nullptr;
+};
+
 class CORE_API IAsyncReadFileHandle
 {
 public:
@@ -205,6 +218,25 @@ public:
 	**/
 	virtual IAsyncReadRequest* ReadRequest(int64 Offset, int64 BytesToRead, EAsyncIOPriorityAndFlags PriorityAndFlags = AIOP_Normal, FAsyncFileCallBack* CompleteCallback = nullptr, uint8* UserSuppliedMemory = nullptr) = 0;
 
+	/**
+	* Submit a batch of reads in one call. Each span becomes its own IAsyncReadRequest with the usual
+	* completion/ownership semantics, but implementations that can batch (pak block cache, platform
+	* scatter-gather IO) see the whole set at once and submit it together instead of per-request.
+	* The default implementation simply loops over ReadRequest.
+	* @param Spans				Offset/size/destination triples to read; see FScatterGatherReadSpan.
+	* @param PriorityAndFlags	Priority and flags applied to every span in the batch.
+	* @param CompleteCallback	Called once per span as it completes, same contract as ReadRequest.
+	* @param OutRequests		Receives one request per span, in span order; all owned by the caller.
+	**/
+	virtual void ReadRequestScatterGather(const TArrayView<const FScatterGatherReadSpan>& Spans, EAsyncIOPriorityAndFlags PriorityAndFlags, FAsyncFileCallBack* CompleteCallback, TArray<IAsyncReadRequest*>& OutRequests)
+	{
+		OutRequests.Reserve(OutRequests.Num() + Spans.Num());
+		for (const FScatterGatherReadSpan& Span : Spans)
+		{
+			OutRequests.Add(ReadRequest(Span.Offset, Span.BytesToRead, PriorityAndFlags, CompleteCallback, Span.UserSuppliedMemory));
+		}
+	}
+
 	/** Return true if this file is backed by a cache, if not, then precache requests are ignored. **/
 	virtual bool UsesCache()
 	{
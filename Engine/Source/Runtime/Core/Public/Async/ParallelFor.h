@@ -8,8 +8,10 @@
 
 #include "CoreTypes.h"
 #include "Misc/AssertionMacros.h"
+#include "Containers/Array.h"
 #include "Math/UnrealMathUtility.h"
 #include "Templates/Function.h"
+#include "Templates/UnrealTemplate.h"
 #include "Templates/SharedPointer.h"
 #include "HAL/ThreadSafeCounter.h"
 #include "Stats/Stats.h"
@@ -225,6 +227,69 @@ namespace ParallelForImpl
 		*	@param Flags; Used to customize the behavior of the ParallelFor if needed.
 		*	Notes: Please add stats around to calls to parallel for and within your lambda as appropriate. Do not clog the task graph with long running tasks or tasks that block.
 	**/
+	/**
+		*	Computes variable-sized block boundaries so that each block carries roughly equal total cost according
+		*	to the per-index hints, over-decomposed a few blocks per worker so the atomic block claiming in
+		*	FParallelForData::Process rebalances dynamically when the hints are imperfect.
+		*	@param Num; number of indices
+		*	@param CostHint; relative cost of each index; only ratios matter, units are irrelevant
+		*	@param OutBlockEnds; receives the exclusive end index of each block, in order
+	**/
+	inline void ComputeCostBasedBlocks(int32 Num, TFunctionRef<float(int32)> CostHint, TArray<int32>& OutBlockEnds)
+	{
+		OutBlockEnds.Reset();
+		float TotalCost = 0.0f;
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			TotalCost += FMath::Max(CostHint(Index), 0.0f);
+		}
+		int32 NumWorkers = FMath::Max<int32>(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+		// a few blocks per worker gives the claim loop room to rebalance without paying per-index synchronization
+		int32 TargetNumBlocks = FMath::Clamp(NumWorkers * 4, 1, Num);
+		float CostPerBlock = TotalCost / float(TargetNumBlocks);
+		if (CostPerBlock <= 0.0f)
+		{
+			OutBlockEnds.Add(Num);
+			return;
+		}
+		float AccumulatedCost = 0.0f;
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			AccumulatedCost += FMath::Max(CostHint(Index), 0.0f);
+			if (AccumulatedCost >= CostPerBlock && Index + 1 < Num)
+			{
+				OutBlockEnds.Add(Index + 1);
+				AccumulatedCost = 0.0f;
+			}
+		}
+		OutBlockEnds.Add(Num);
+	}
+
+	inline void ParallelForWithCostHintsInternal(int32 Num, TFunctionRef<void(int32)> Body, TFunctionRef<float(int32)> CostHint, TArray<int32>& BlockEndsScratch, EParallelForFlags Flags)
+	{
+		check(Num >= 0);
+		if (Num <= 1 || (Flags & EParallelForFlags::ForceSingleThread) != EParallelForFlags::None || !FApp::ShouldUseThreadingForPerformance())
+		{
+			for (int32 Index = 0; Index < Num; Index++)
+			{
+				Body(Index);
+			}
+			return;
+		}
+		ComputeCostBasedBlocks(Num, CostHint, BlockEndsScratch);
+		const TArray<int32>& BlockEnds = BlockEndsScratch;
+		// Unbalanced makes each cost-sized block an individually claimed unit, which is the rebalancing
+		ParallelForInternal(BlockEnds.Num(), [&BlockEnds, &Body](int32 BlockIndex)
+		{
+			int32 StartIndex = BlockIndex ? BlockEnds[BlockIndex - 1] : 0;
+			int32 EndIndex = BlockEnds[BlockIndex];
+			for (int32 Index = StartIndex; Index < EndIndex; Index++)
+			{
+				Body(Index);
+			}
+		}, Flags | EParallelForFlags::Unbalanced);
+	}
+
 	inline void ParallelForWithPreWorkInternal(int32 Num, TFunctionRef<void(int32)> Body, TFunctionRef<void()> CurrentThreadWorkToDoBeforeHelping, EParallelForFlags Flags = EParallelForFlags::None)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ParallelFor);
@@ -319,3 +384,93 @@ inline void ParallelForWithPreWork(int32 Num, TFunctionRef<void(int32)> Body, TF
 {
 	ParallelForImpl::ParallelForWithPreWorkInternal(Num, Body, CurrentThreadWorkToDoBeforeHelping, Flags);
 }
+
+/**
+	*	Parallel for for workloads whose per-index cost varies widely. Indices are grouped into variable-sized
+	*	blocks of roughly equal total cost according to the hints, and the blocks are claimed dynamically so
+	*	threads that finish cheap blocks keep pulling expensive ones.
+	*	@param Num; number of calls of Body; Body(0), Body(1)....Body(Num - 1)
+	*	@param Body; Function to call from multiple threads
+	*	@param CostHint; Returns the relative cost of an index; only ratios matter and the hints may be approximate
+	*	@param Flags; Used to customize the behavior of the ParallelFor if needed.
+	*	Notes: The hints are evaluated serially up front, so CostHint must be much cheaper than Body to be a win.
+**/
+inline void ParallelForWithCostHints(int32 Num, TFunctionRef<void(int32)> Body, TFunctionRef<float(int32)> CostHint, EParallelForFlags Flags = EParallelForFlags::None)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ParallelFor);
+	TArray<int32> BlockEnds;
+	ParallelForImpl::ParallelForWithCostHintsInternal(Num, Body, CostHint, BlockEnds, Flags);
+}
+
+/**
+	*	Reusable context for callers that issue many ParallelFor calls in the same frame (e.g. per-bucket tick
+	*	processing). The context recycles the internal working data, its completion event and the cost-block
+	*	scratch allocations across invocations, which removes the per-call heap traffic of the free functions.
+	*	Not thread safe; a context must only be used from one thread at a time, though it may live across frames.
+**/
+class FParallelForContext : FNoncopyable
+{
+public:
+	FParallelForContext() = default;
+
+	/** Equivalent to the global ParallelFor, reusing this context's working data when the previous call's tasks have drained. **/
+	void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body, EParallelForFlags Flags = EParallelForFlags::None)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ParallelFor);
+		check(Num >= 0);
+
+		int32 AnyThreadTasks = 0;
+		if (Num > 1 && (Flags & EParallelForFlags::ForceSingleThread) == EParallelForFlags::None && FApp::ShouldUseThreadingForPerformance())
+		{
+			AnyThreadTasks = FMath::Min<int32>(FTaskGraphInterface::Get().GetNumWorkerThreads(), Num - 1);
+		}
+		if (!AnyThreadTasks)
+		{
+			for (int32 Index = 0; Index < Num; Index++)
+			{
+				Body(Index);
+			}
+			return;
+		}
+		using FDataRef = TSharedRef<ParallelForImpl::FParallelForData, ESPMode::ThreadSafe>;
+		if (PooledData.IsValid() && PooledData.IsUnique())
+		{
+			// All tasks from the previous invocation have released the data, so the allocation can be reused.
+			// TFunctionRef members preclude assignment, so reconstruct in place under the live control block.
+			ParallelForImpl::FParallelForData* Raw = PooledData.Get();
+			Raw->~FParallelForData();
+			new (Raw) ParallelForImpl::FParallelForData(Num, AnyThreadTasks + 1, Num > AnyThreadTasks + 1, Body, Flags);
+		}
+		else
+		{
+			PooledData = MakeShareable(new ParallelForImpl::FParallelForData(Num, AnyThreadTasks + 1, Num > AnyThreadTasks + 1, Body, Flags));
+		}
+		FDataRef Data = PooledData.ToSharedRef();
+		TGraphTask<ParallelForImpl::FParallelForTask>::CreateTask().ConstructAndDispatchWhenReady(Data, AnyThreadTasks - 1);
+		// this thread can help too and this is important to prevent deadlock on recursion
+		if (!Data->Process(0, Data, true))
+		{
+			Data->Event->Wait();
+			check(Data->bTriggered);
+		}
+		else
+		{
+			check(!Data->bTriggered);
+		}
+		check(Data->NumCompleted.GetValue() == Data->Num);
+		Data->bExited = true;
+	}
+
+	/** Equivalent to the global ParallelForWithCostHints, additionally reusing the block boundary scratch array. **/
+	void ParallelForWithCostHints(int32 Num, TFunctionRef<void(int32)> Body, TFunctionRef<float(int32)> CostHint, EParallelForFlags Flags = EParallelForFlags::None)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ParallelFor);
+		ParallelForImpl::ParallelForWithCostHintsInternal(Num, Body, CostHint, BlockEndsScratch, Flags);
+	}
+
+private:
+	/** Working data kept alive between invocations; reused whenever no straggler task still references it. **/
+	TSharedPtr<ParallelForImpl::FParallelForData, ESPMode::ThreadSafe> PooledData;
+	/** Scratch block boundaries for the cost-hint path, reused to avoid reallocation. **/
+	TArray<int32> BlockEndsScratch;
+};
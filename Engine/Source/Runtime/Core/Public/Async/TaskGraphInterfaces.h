@@ -10,6 +10,7 @@
 #include "Misc/AssertionMacros.h"
 #include "Containers/ContainerAllocationPolicies.h"
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Containers/UnrealString.h"
 #include "Templates/Function.h"
 #include "Delegates/Delegate.h"
@@ -289,6 +290,15 @@ class FTaskGraphInterface
 	**/
 	virtual void QueueTask(class FBaseGraphTask* Task, ENamedThreads::Type ThreadToExecuteOn, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread) = 0;
 
+	/**
+	 *	Internal function to queue a batch of ready tasks under a single queue operation with worker wakeups issued once at the end.
+	 *	Callers go through TGraphTask::UnlockBatch (which releases held tasks via FBaseGraphTask::UnlockBatch).
+	 *	The default implementation just loops; implementations amortize.
+	 *	@param	Tasks; the ready tasks to queue; each carries its own thread to execute on
+	 *	@param	CurrentThreadIfKnown; This should be the current thread if it is known, or otherwise use ENamedThreads::AnyThread and the current thread will be determined.
+	**/
+	virtual void QueueTaskBatch(const TArrayView<FBaseGraphTask* const>& Tasks, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread);
+
 public:
 
 	virtual ~FTaskGraphInterface()
@@ -380,6 +390,33 @@ public:
 		WaitUntilTasksComplete(Prerequistes, CurrentThreadIfKnown);
 	}
 
+	/**
+	 *	Opt-in variant of WaitUntilTasksComplete for waits issued from inside tasks. Instead of stalling the
+	 *	worker thread for the duration of the wait, the thread keeps pulling and executing other queued tasks
+	 *	until the prerequisites fire, so nested waits (e.g. level-streaming completion chains) don't drain the
+	 *	worker pool. The wait still runs on this thread and this stack, so code that relies on thread identity
+	 *	is unaffected, but the helper tasks deepen the stack; that is why this is opt-in per call site.
+	 *	On named threads and when the current thread is unknown this behaves exactly like WaitUntilTasksComplete.
+	 *	@param	Tasks - tasks to wait for
+	 *	@param	CurrentThreadIfKnown - This thread, if known
+	**/
+	virtual void WaitUntilTasksCompleteAllowingWork(const FGraphEventArray& Tasks, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread)
+	{
+		WaitUntilTasksComplete(Tasks, CurrentThreadIfKnown);
+	}
+
+	/**
+	 *	Single-task convenience wrapper for WaitUntilTasksCompleteAllowingWork.
+	 *	@param	Task - task to wait for
+	 *	@param	CurrentThreadIfKnown - This thread, if known
+	**/
+	void WaitUntilTaskCompletesAllowingWork(const FGraphEventRef& Task, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread)
+	{
+		FGraphEventArray Prerequistes;
+		Prerequistes.Add(Task);
+		WaitUntilTasksCompleteAllowingWork(Prerequistes, CurrentThreadIfKnown);
+	}
+
 	/** 
 	 *	When a task completes, fire a scoped event
 	 *	@param	InEvent - event to fire when the task is done
@@ -485,11 +522,37 @@ protected:
 		}
 	}
 
+	/**
+	 *	Batch equivalent of TGraphTask::Unlock for tasks created with ConstructAndHold. Tasks whose prerequisite
+	 *	counts reach zero are queued together under a single queue operation with worker wakeups issued once at
+	 *	the end, instead of paying one queue operation and wakeup per task.
+	 *	@param Tasks; the held tasks to release
+	 *	@param CurrentThreadIfKnown; provides the index of the thread we are running on. Can be ENamedThreads::AnyThread if the current thread is unknown.
+	 **/
+	static void UnlockBatch(const TArrayView<FBaseGraphTask* const>& Tasks, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread)
+	{
+		TArray<FBaseGraphTask*, TInlineAllocator<64>> ReadyTasks;
+		ReadyTasks.Reserve(Tasks.Num());
+		for (FBaseGraphTask* Task : Tasks)
+		{
+			if (Task->NumberOfPrerequistitesOutstanding.Decrement() == 0)
+			{
+				checkThreadGraph(Task->LifeStage.Increment() == int32(LS_Queued));
+				ReadyTasks.Add(Task);
+			}
+		}
+		if (ReadyTasks.Num())
+		{
+			FTaskGraphInterface::Get().QueueTaskBatch(ReadyTasks, CurrentThreadIfKnown);
+		}
+	}
+
 private:
 	friend class FNamedTaskThread;
 	friend class FTaskThreadBase;
 	friend class FTaskThreadAnyThread;
 	friend class FGraphEvent;
+	friend class FTaskGraphInterface;
 	friend class FTaskGraphImplementation;
 
 	// Subclass API
@@ -809,6 +872,24 @@ public:
 		ConditionalQueueTask(CurrentThreadIfKnown);
 	}
 
+	/**
+	 *	Batch equivalent of Unlock for a set of tasks created with ConstructAndHold. Tasks whose
+	 *	prerequisite counts reach zero are queued together under a single queue operation with
+	 *	worker wakeups issued once at the end, instead of one queue operation and wakeup per task.
+	 *	@param Tasks; the held tasks to release
+	 *	@param CurrentThreadIfKnown; provides the index of the thread we are running on. Can be ENamedThreads::AnyThread if the current thread is unknown.
+	 **/
+	static void UnlockBatch(const TArrayView<TGraphTask* const>& Tasks, ENamedThreads::Type CurrentThreadIfKnown = ENamedThreads::AnyThread)
+	{
+		TArray<FBaseGraphTask*, TInlineAllocator<64>> BaseTasks;
+		BaseTasks.Reserve(Tasks.Num());
+		for (TGraphTask* Task : Tasks)
+		{
+			BaseTasks.Add(Task);
+		}
+		FBaseGraphTask::UnlockBatch(BaseTasks, CurrentThreadIfKnown);
+	}
+
 	FGraphEventRef GetCompletionEvent()
 	{
 		return Subsequents;
@@ -0,0 +1,520 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "Templates/UnrealTemplate.h"
+#include "Templates/UnrealTypeTraits.h"
+#include "Templates/IsTriviallyDestructible.h"
+#include "Templates/AlignmentTemplates.h"
+#include "Math/UnrealMathUtility.h"
+#include "Containers/Map.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+	#include <emmintrin.h>
+	#define FLATMAP_SIMD_PROBE 1
+#else
+	#define FLATMAP_SIMD_PROBE 0
+#endif
+
+/**
+ * TFlatMap - an open-addressing hash map with flat storage and byte metadata.
+ *
+ * Where TMap resolves a lookup through TSparseArray buckets (two dependent cache misses on average),
+ * TFlatMap keeps one contiguous element array plus one metadata byte per slot holding the low seven
+ * bits of the hash; a lookup touches the metadata line (probed sixteen slots at a time with SSE2 on
+ * x86) and then only the elements whose hash byte matched. This makes it the right container for
+ * hot read-mostly maps like object annotations and parameter lookups. The tradeoffs against TMap:
+ * elements move on rehash (no stable pointers across Add), there is no multimap mode, and removal
+ * uses tombstones that are only reclaimed on rehash.
+ *
+ * Key handling goes through the same KeyFuncs interface TMap uses, so anything hashable as a TMap
+ * key works here unchanged.
+ */
+template<typename KeyType, typename ValueType, typename KeyFuncs = TDefaultMapHashableKeyFuncs<KeyType, ValueType, false>>
+class TFlatMap
+{
+public:
+	typedef TPair<KeyType, ValueType> ElementType;
+
+private:
+	enum
+	{
+		MetaEmpty = 0x80,		// high bit set, never matches a hash byte
+		MetaTombstone = 0xFE,	// high bit set; distinct so probes continue past it
+		GroupSize = 16,
+		MinCapacity = 16		// one probe group
+	};
+
+	FORCEINLINE static uint8 HashByte(uint32 Hash)
+	{
+		return (uint8)(Hash & 0x7F);
+	}
+
+	FORCEINLINE uint32 SlotForHash(uint32 Hash) const
+	{
+		// capacity is a power of two; shift out the bits reused by the hash byte
+		return (Hash >> 7) & (Capacity - 1);
+	}
+
+	/** Writes a metadata byte, mirroring the first group past the end so unaligned group loads see wrapped slots. */
+	FORCEINLINE void SetMetadata(uint32 Slot, uint8 Value)
+	{
+		Metadata[Slot] = Value;
+		if (Slot < GroupSize)
+		{
+			Metadata[Capacity + Slot] = Value;
+		}
+	}
+
+public:
+	TFlatMap()
+		: Metadata(nullptr)
+		, Elements(nullptr)
+		, Capacity(0)
+		, NumElements(0)
+		, NumOccupiedSlots(0)
+	{
+	}
+
+	TFlatMap(TFlatMap&& Other)
+		: Metadata(Other.Metadata)
+		, Elements(Other.Elements)
+		, Capacity(Other.Capacity)
+		, NumElements(Other.NumElements)
+		, NumOccupiedSlots(Other.NumOccupiedSlots)
+	{
+		Other.Metadata = nullptr;
+		Other.Elements = nullptr;
+		Other.Capacity = 0;
+		Other.NumElements = 0;
+		Other.NumOccupiedSlots = 0;
+	}
+
+	TFlatMap(const TFlatMap& Other)
+		: TFlatMap()
+	{
+		Reserve(Other.NumElements);
+		for (const ElementType& Element : Other)
+		{
+			Add(Element.Key, Element.Value);
+		}
+	}
+
+	TFlatMap& operator=(TFlatMap&& Other)
+	{
+		if (this != &Other)
+		{
+			Empty();
+			FMemory::Free(Metadata);
+			Metadata = Other.Metadata;
+			Elements = Other.Elements;
+			Capacity = Other.Capacity;
+			NumElements = Other.NumElements;
+			NumOccupiedSlots = Other.NumOccupiedSlots;
+			Other.Metadata = nullptr;
+			Other.Elements = nullptr;
+			Other.Capacity = 0;
+			Other.NumElements = 0;
+			Other.NumOccupiedSlots = 0;
+		}
+		return *this;
+	}
+
+	TFlatMap& operator=(const TFlatMap& Other)
+	{
+		if (this != &Other)
+		{
+			Empty(Other.NumElements);
+			for (const ElementType& Element : Other)
+			{
+				Add(Element.Key, Element.Value);
+			}
+		}
+		return *this;
+	}
+
+	~TFlatMap()
+	{
+		Empty();
+		FMemory::Free(Metadata);
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return NumElements;
+	}
+
+	/** Destroys all elements. With ExpectedNumElements > 0 the storage is kept or resized for that many; with 0 it is released, matching TMap::Empty. */
+	void Empty(int32 ExpectedNumElements = 0)
+	{
+		if (Capacity)
+		{
+			DestructElements();
+			NumElements = 0;
+			NumOccupiedSlots = 0;
+			if (ExpectedNumElements)
+			{
+				FMemory::Memset(Metadata, MetaEmpty, Capacity + GroupSize);
+			}
+			else
+			{
+				FMemory::Free(Metadata);
+				Metadata = nullptr;
+				Elements = nullptr;
+				Capacity = 0;
+			}
+		}
+		if (ExpectedNumElements)
+		{
+			Reserve(ExpectedNumElements);
+		}
+	}
+
+	/** Ensures the map can hold at least Number elements without rehashing. */
+	void Reserve(int32 Number)
+	{
+		uint32 NeededCapacity = CapacityForElements(Number);
+		if (NeededCapacity > Capacity)
+		{
+			Rehash(NeededCapacity);
+		}
+	}
+
+	FORCEINLINE bool Contains(typename TTypeTraits<KeyType>::ConstPointerType Key) const
+	{
+		return FindSlot(Key) != INDEX_NONE;
+	}
+
+	FORCEINLINE ValueType* Find(typename TTypeTraits<KeyType>::ConstPointerType Key)
+	{
+		int32 Slot = FindSlot(Key);
+		return Slot != INDEX_NONE ? &Elements[Slot].Value : nullptr;
+	}
+
+	FORCEINLINE const ValueType* Find(typename TTypeTraits<KeyType>::ConstPointerType Key) const
+	{
+		return const_cast<TFlatMap*>(this)->Find(Key);
+	}
+
+	/** Returns a reference to the value for the key; the key must be present. */
+	FORCEINLINE ValueType& FindChecked(typename TTypeTraits<KeyType>::ConstPointerType Key)
+	{
+		ValueType* Value = Find(Key);
+		check(Value);
+		return *Value;
+	}
+
+	FORCEINLINE const ValueType& FindChecked(typename TTypeTraits<KeyType>::ConstPointerType Key) const
+	{
+		const ValueType* Value = Find(Key);
+		check(Value);
+		return *Value;
+	}
+
+	/** Returns the value for the key, or a default-constructed value if absent (same contract as TMap::FindRef). */
+	FORCEINLINE ValueType FindRef(typename TTypeTraits<KeyType>::ConstPointerType Key) const
+	{
+		const ValueType* Value = Find(Key);
+		return Value ? *Value : ValueType();
+	}
+
+	/** Adds or replaces the value for the key. The returned reference is valid until the next Add/Remove/Reserve. */
+	ValueType& Add(const KeyType& Key, const ValueType& Value)
+	{
+		return Emplace(Key, Value);
+	}
+
+	ValueType& Add(const KeyType& Key, ValueType&& Value)
+	{
+		return Emplace(Key, MoveTemp(Value));
+	}
+
+	ValueType& FindOrAdd(const KeyType& Key)
+	{
+		ValueType* Existing = Find(Key);
+		return Existing ? *Existing : Emplace(Key, ValueType());
+	}
+
+	/** Removes the element for the key. Returns the number of elements removed (0 or 1). */
+	int32 Remove(typename TTypeTraits<KeyType>::ConstPointerType Key)
+	{
+		int32 Slot = FindSlot(Key);
+		if (Slot == INDEX_NONE)
+		{
+			return 0;
+		}
+		RemoveSlot(Slot);
+		return 1;
+	}
+
+	/** Removes the element and copies its value out first; returns whether an element was removed. */
+	bool RemoveAndCopyValue(typename TTypeTraits<KeyType>::ConstPointerType Key, ValueType& OutRemovedValue)
+	{
+		int32 Slot = FindSlot(Key);
+		if (Slot == INDEX_NONE)
+		{
+			return false;
+		}
+		OutRemovedValue = MoveTemp(Elements[Slot].Value);
+		RemoveSlot(Slot);
+		return true;
+	}
+
+	/** Bytes of storage owned by the map (metadata and elements share one allocation). */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Capacity ? (SIZE_T)Capacity * (sizeof(ElementType) + 1) + GroupSize : 0;
+	}
+
+	// Iteration: walks occupied slots in storage order.
+
+	template<bool bConst>
+	class TBaseIterator
+	{
+	public:
+		typedef typename TChooseClass<bConst, const TFlatMap, TFlatMap>::Result MapType;
+		typedef typename TChooseClass<bConst, const ElementType, ElementType>::Result ItElementType;
+
+		TBaseIterator(MapType& InMap, int32 InSlot)
+			: Map(InMap)
+			, Slot(InSlot)
+		{
+			AdvanceToOccupied();
+		}
+
+		FORCEINLINE TBaseIterator& operator++()
+		{
+			++Slot;
+			AdvanceToOccupied();
+			return *this;
+		}
+
+		FORCEINLINE explicit operator bool() const
+		{
+			return Slot < (int32)Map.Capacity;
+		}
+
+		FORCEINLINE bool operator!=(const TBaseIterator& Rhs) const
+		{
+			return Slot != Rhs.Slot;
+		}
+
+		FORCEINLINE ItElementType& operator*() const
+		{
+			return Map.Elements[Slot];
+		}
+
+		FORCEINLINE ItElementType* operator->() const
+		{
+			return &Map.Elements[Slot];
+		}
+
+		FORCEINLINE const KeyType& Key() const
+		{
+			return Map.Elements[Slot].Key;
+		}
+
+		FORCEINLINE typename TChooseClass<bConst, const ValueType, ValueType>::Result& Value() const
+		{
+			return Map.Elements[Slot].Value;
+		}
+
+	private:
+		void AdvanceToOccupied()
+		{
+			while (Slot < (int32)Map.Capacity && (Map.Metadata[Slot] & 0x80))
+			{
+				++Slot;
+			}
+		}
+
+		MapType& Map;
+		int32 Slot;
+	};
+
+	typedef TBaseIterator<false> TIterator;
+	typedef TBaseIterator<true> TConstIterator;
+
+	FORCEINLINE TIterator CreateIterator()
+	{
+		return TIterator(*this, 0);
+	}
+
+	FORCEINLINE TConstIterator CreateConstIterator() const
+	{
+		return TConstIterator(*this, 0);
+	}
+
+	FORCEINLINE TIterator begin()				{ return TIterator(*this, 0); }
+	FORCEINLINE TConstIterator begin() const	{ return TConstIterator(*this, 0); }
+	FORCEINLINE TIterator end()					{ return TIterator(*this, Capacity); }
+	FORCEINLINE TConstIterator end() const		{ return TConstIterator(*this, Capacity); }
+
+private:
+
+	/** Capacity (always a power of two) that keeps the load factor under 7/8 for the element count. */
+	static uint32 CapacityForElements(int32 Number)
+	{
+		uint32 Result = MinCapacity;
+		while (Number >= (int32)(Result - Result / 8))
+		{
+			Result <<= 1;
+		}
+		return Result;
+	}
+
+	/** Finds the slot holding the key, or INDEX_NONE. */
+	int32 FindSlot(typename TTypeTraits<KeyType>::ConstPointerType Key) const
+	{
+		if (!NumElements)
+		{
+			return INDEX_NONE;
+		}
+		const uint32 Hash = KeyFuncs::GetKeyHash(Key);
+		const uint8 Expected = HashByte(Hash);
+		uint32 Slot = SlotForHash(Hash);
+		for (uint32 Probes = 0; Probes < Capacity; Probes += GroupSize)
+		{
+#if FLATMAP_SIMD_PROBE
+			// metadata is allocated with GroupSize slack, so an unaligned 16-byte load at any slot is in bounds
+			const __m128i Group = _mm_loadu_si128((const __m128i*)&Metadata[Slot]);
+			int32 MatchMask = _mm_movemask_epi8(_mm_cmpeq_epi8(Group, _mm_set1_epi8((char)Expected)));
+			while (MatchMask)
+			{
+				const int32 Lane = FMath::CountTrailingZeros(MatchMask);
+				MatchMask &= MatchMask - 1;
+				const uint32 Candidate = (Slot + Lane) & (Capacity - 1);
+				if (KeyFuncs::Matches(KeyFuncs::GetSetKey(Elements[Candidate]), Key))
+				{
+					return (int32)Candidate;
+				}
+			}
+			const int32 EmptyMask = _mm_movemask_epi8(_mm_cmpeq_epi8(Group, _mm_set1_epi8((char)MetaEmpty)));
+			if (EmptyMask)
+			{
+				return INDEX_NONE;
+			}
+#else
+			for (uint32 Lane = 0; Lane < GroupSize; Lane++)
+			{
+				const uint32 Candidate = (Slot + Lane) & (Capacity - 1);
+				const uint8 Meta = Metadata[Candidate];
+				if (Meta == Expected && KeyFuncs::Matches(KeyFuncs::GetSetKey(Elements[Candidate]), Key))
+				{
+					return (int32)Candidate;
+				}
+				if (Meta == MetaEmpty)
+				{
+					return INDEX_NONE;
+				}
+			}
+#endif
+			Slot = (Slot + GroupSize) & (Capacity - 1);
+		}
+		return INDEX_NONE;
+	}
+
+	template<typename InitValueType>
+	ValueType& Emplace(const KeyType& Key, InitValueType&& Value)
+	{
+		const uint32 Hash = KeyFuncs::GetKeyHash(Key);
+		if (Capacity)
+		{
+			int32 Existing = FindSlot(Key);
+			if (Existing != INDEX_NONE)
+			{
+				Elements[Existing].Value = Forward<InitValueType>(Value);
+				return Elements[Existing].Value;
+			}
+		}
+		if (NumOccupiedSlots + 1 >= Capacity - Capacity / 8)
+		{
+			// rehashing also reclaims tombstones, which is what keeps delete-heavy maps from degrading
+			Rehash(FMath::Max<uint32>(Capacity * 2, MinCapacity));
+		}
+		const int32 Slot = FindInsertSlot(Hash);
+		new (&Elements[Slot]) ElementType(Key, Forward<InitValueType>(Value));
+		SetMetadata(Slot, HashByte(Hash));
+		NumElements++;
+		NumOccupiedSlots++;
+		return Elements[Slot].Value;
+	}
+
+	/** First empty or tombstone slot on the probe path; caller guarantees the key is absent and there is room. */
+	int32 FindInsertSlot(uint32 Hash) const
+	{
+		uint32 Slot = SlotForHash(Hash);
+		while (true)
+		{
+			if (Metadata[Slot] & 0x80)
+			{
+				return (int32)Slot;
+			}
+			Slot = (Slot + 1) & (Capacity - 1);
+		}
+	}
+
+	void RemoveSlot(int32 Slot)
+	{
+		Elements[Slot].~ElementType();
+		SetMetadata(Slot, MetaTombstone);
+		NumElements--;
+		// NumOccupiedSlots intentionally stays; tombstones still lengthen probes until the next rehash
+	}
+
+	void Rehash(uint32 NewCapacity)
+	{
+		uint8* OldMetadata = Metadata;
+		ElementType* OldElements = Elements;
+		const uint32 OldCapacity = Capacity;
+
+		// one allocation: metadata (plus a trailing group mirroring the first slots, for unaligned group loads), then elements
+		const SIZE_T MetadataBytes = Align<SIZE_T>(NewCapacity + GroupSize, alignof(ElementType));
+		Metadata = (uint8*)FMemory::Malloc(MetadataBytes + (SIZE_T)NewCapacity * sizeof(ElementType), FMath::Max<uint32>(alignof(ElementType), GroupSize));
+		Elements = (ElementType*)(Metadata + MetadataBytes);
+		Capacity = NewCapacity;
+		FMemory::Memset(Metadata, MetaEmpty, MetadataBytes);
+		NumOccupiedSlots = NumElements;
+
+		if (OldCapacity)
+		{
+			for (uint32 OldSlot = 0; OldSlot < OldCapacity; OldSlot++)
+			{
+				if (!(OldMetadata[OldSlot] & 0x80))
+				{
+					const uint32 Hash = KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(OldElements[OldSlot]));
+					const int32 NewSlot = FindInsertSlot(Hash);
+					new (&Elements[NewSlot]) ElementType(MoveTemp(OldElements[OldSlot]));
+					SetMetadata(NewSlot, HashByte(Hash));
+					OldElements[OldSlot].~ElementType();
+				}
+			}
+			FMemory::Free(OldMetadata);
+		}
+	}
+
+	void DestructElements()
+	{
+		if (!TIsTriviallyDestructible<ElementType>::Value)
+		{
+			for (uint32 Slot = 0; Slot < Capacity; Slot++)
+			{
+				if (!(Metadata[Slot] & 0x80))
+				{
+					Elements[Slot].~ElementType();
+				}
+			}
+		}
+	}
+
+	/** Metadata bytes; the element array lives in the same allocation right after them. */
+	uint8* Metadata;
+	ElementType* Elements;
+	uint32 Capacity;
+	int32 NumElements;
+	/** Occupied = live + tombstones; drives the rehash trigger. */
+	int32 NumOccupiedSlots;
+};
@@ -0,0 +1,169 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Misc/CString.h"
+#include "Misc/VarArgs.h"
+#include "Templates/IsArrayOrRefOfType.h"
+
+/**
+ * TInlineString - a string with inline storage for short contents.
+ *
+ * FString always heap-allocates; for the tens of thousands of short transient strings built per
+ * second by HTTP, analytics and serialization paths, that is one malloc/free pair each. A
+ * TInlineString<N> keeps up to N - 1 characters (plus terminator) in the object itself and only
+ * touches the heap when it grows past that, via the ordinary TInlineAllocator spill.
+ *
+ * This is deliberately the assembly-buffer subset of the FString API: append-oriented, convertible
+ * to and from FString at the boundaries where code needs the full interface. It is not a general
+ * FString replacement; persistent strings should stay FString.
+ */
+template<int32 NumInlineChars = 64>
+class TInlineString
+{
+public:
+	TInlineString()
+	{
+	}
+
+	TInlineString(const TCHAR* Str)
+	{
+		if (Str && *Str)
+		{
+			Data.Append(Str, FCString::Strlen(Str) + 1);
+		}
+	}
+
+	explicit TInlineString(const FString& Str)
+	{
+		if (Str.Len())
+		{
+			Data.Append(*Str, Str.Len() + 1);
+		}
+	}
+
+	FORCEINLINE int32 Len() const
+	{
+		return Data.Num() ? Data.Num() - 1 : 0;
+	}
+
+	FORCEINLINE bool IsEmpty() const
+	{
+		return Data.Num() <= 1;
+	}
+
+	/** Empties the string without releasing the inline storage. */
+	FORCEINLINE void Reset()
+	{
+		Data.Reset();
+	}
+
+	/** Returns the NUL-terminated contents; never null. */
+	FORCEINLINE const TCHAR* operator*() const
+	{
+		return Data.Num() ? Data.GetData() : TEXT("");
+	}
+
+	FORCEINLINE void AppendChar(TCHAR Char)
+	{
+		if (Data.Num())
+		{
+			Data.Last() = Char;
+		}
+		else
+		{
+			Data.Add(Char);
+		}
+		Data.Add(TCHAR('\0'));
+	}
+
+	void Append(const TCHAR* Str, int32 Count)
+	{
+		if (Count > 0)
+		{
+			if (Data.Num())
+			{
+				Data.Pop(false); // drop the terminator
+			}
+			Data.Append(Str, Count);
+			Data.Add(TCHAR('\0'));
+		}
+	}
+
+	FORCEINLINE void Append(const TCHAR* Str)
+	{
+		Append(Str, FCString::Strlen(Str));
+	}
+
+	FORCEINLINE void Append(const FString& Str)
+	{
+		Append(*Str, Str.Len());
+	}
+
+	FORCEINLINE TInlineString& operator+=(const TCHAR* Str)
+	{
+		Append(Str);
+		return *this;
+	}
+
+	FORCEINLINE TInlineString& operator+=(const FString& Str)
+	{
+		Append(Str);
+		return *this;
+	}
+
+	FORCEINLINE TInlineString& operator+=(TCHAR Char)
+	{
+		AppendChar(Char);
+		return *this;
+	}
+
+	/** Appends printf-formatted text, formatting into the remaining inline space when it fits. */
+	template <typename FmtType, typename... Types>
+	void Appendf(const FmtType& Fmt, Types... Args)
+	{
+		static_assert(TIsArrayOrRefOfType<FmtType, TCHAR>::Value, "Formatting string must be a TCHAR array.");
+		AppendfImpl(Fmt, Args...);
+	}
+
+	/** Copies out to an FString for code that needs the full interface. */
+	FString ToString() const
+	{
+		return FString(Len(), **this);
+	}
+
+private:
+	void VARARGS AppendfImpl(const TCHAR* Fmt, ...)
+	{
+		// try the remaining space first; only a result that does not fit pays for a heap-backed retry
+		TCHAR Buffer[NumInlineChars];
+		int32 Result;
+		GET_VARARGS_RESULT(Buffer, UE_ARRAY_COUNT(Buffer), UE_ARRAY_COUNT(Buffer) - 1, Fmt, Fmt, Result);
+		if (Result != -1)
+		{
+			Append(Buffer, Result);
+			return;
+		}
+		int32 BufferSize = NumInlineChars * 2;
+		for (;;)
+		{
+			TArray<TCHAR> Heap;
+			Heap.AddUninitialized(BufferSize);
+			GET_VARARGS_RESULT(Heap.GetData(), BufferSize, BufferSize - 1, Fmt, Fmt, Result);
+			if (Result != -1)
+			{
+				Append(Heap.GetData(), Result);
+				return;
+			}
+			BufferSize *= 2;
+		}
+	}
+
+	/** Characters plus terminator when non-empty; empty means zero-length string. */
+	TArray<TCHAR, TInlineAllocator<NumInlineChars>> Data;
+};
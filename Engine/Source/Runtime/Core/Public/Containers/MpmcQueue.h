@@ -0,0 +1,232 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+#include "Templates/Atomic.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Templates/UnrealTemplate.h"
+
+/**
+ * Implements a bounded multi-producer multi-consumer queue over a preallocated circular array.
+ *
+ * Each cell carries a sequence number (Vyukov's scheme), so producers and consumers contend on
+ * disjoint cache lines rather than serializing on a shared tail, and no allocation happens per
+ * element. Enqueueing into a full queue and dequeueing from an empty one fail rather than block,
+ * which is what the hot handoff paths this is meant for (audio decode to render, batcher feeds)
+ * want: the producer keeps the element and retries or drops.
+ *
+ * There is some room for optimization via using fine grained memory fences, but
+ * the implications for all of our target platforms need further analysis, so
+ * we're using the simpler sequentially consistent model for now.
+ *
+ * @param ElementType The type of elements held in the queue.
+ */
+template<typename ElementType>
+class TMpmcQueue
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @param InCapacity The number of elements that the queue can hold (will be rounded up to the next power of 2).
+	 */
+	explicit TMpmcQueue(uint32 InCapacity)
+		: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u)))
+		, EnqueuePos(0)
+		, DequeuePos(0)
+	{
+		Cells = (FCell*)FMemory::Malloc(sizeof(FCell) * Capacity, PLATFORM_CACHE_LINE_SIZE);
+		for (uint32 Index = 0; Index < Capacity; Index++)
+		{
+			new (&Cells[Index].Sequence) TAtomic<uint32>(Index);
+		}
+	}
+
+	/** Destructor. Destructs any elements still queued. */
+	~TMpmcQueue()
+	{
+		// single-threaded at this point; destruct in place so ElementType need not be default-constructible
+		uint32 Pos = DequeuePos.Load();
+		while (true)
+		{
+			FCell& Cell = Cells[Pos & (Capacity - 1)];
+			if (int32(Cell.Sequence.Load() - (Pos + 1)) != 0)
+			{
+				break;
+			}
+			Cell.Element.GetTypedPtr()->~ElementType();
+			Pos++;
+		}
+		FMemory::Free(Cells);
+	}
+
+	/**
+	 * Adds an item to the tail of the queue.
+	 *
+	 * Can be called from any thread.
+	 *
+	 * @param Element The element to add.
+	 * @return true if the element was added, false if the queue was full.
+	 */
+	bool TryEnqueue(const ElementType& Element)
+	{
+		FCell* Cell;
+		uint32 Pos = EnqueuePos.Load(EMemoryOrder::Relaxed);
+		while (true)
+		{
+			Cell = &Cells[Pos & (Capacity - 1)];
+			uint32 Sequence = Cell->Sequence.Load();
+			int32 Diff = int32(Sequence - Pos);
+			if (Diff == 0)
+			{
+				if (EnqueuePos.CompareExchange(Pos, Pos + 1))
+				{
+					break;
+				}
+				// Pos was reloaded by the failed compare-exchange
+			}
+			else if (Diff < 0)
+			{
+				return false; // full
+			}
+			else
+			{
+				Pos = EnqueuePos.Load(EMemoryOrder::Relaxed);
+			}
+		}
+		new (Cell->Element.GetTypedPtr()) ElementType(Element);
+		Cell->Sequence.Store(Pos + 1);
+		return true;
+	}
+
+	/**
+	 * Adds an item to the tail of the queue, moving it into the cell.
+	 *
+	 * Can be called from any thread.
+	 *
+	 * @param Element The element to add.
+	 * @return true if the element was added, false if the queue was full (the element is left intact).
+	 */
+	bool TryEnqueue(ElementType&& Element)
+	{
+		FCell* Cell;
+		uint32 Pos = EnqueuePos.Load(EMemoryOrder::Relaxed);
+		while (true)
+		{
+			Cell = &Cells[Pos & (Capacity - 1)];
+			uint32 Sequence = Cell->Sequence.Load();
+			int32 Diff = int32(Sequence - Pos);
+			if (Diff == 0)
+			{
+				if (EnqueuePos.CompareExchange(Pos, Pos + 1))
+				{
+					break;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false; // full
+			}
+			else
+			{
+				Pos = EnqueuePos.Load(EMemoryOrder::Relaxed);
+			}
+		}
+		new (Cell->Element.GetTypedPtr()) ElementType(MoveTemp(Element));
+		Cell->Sequence.Store(Pos + 1);
+		return true;
+	}
+
+	/**
+	 * Removes an item from the head of the queue.
+	 *
+	 * Can be called from any thread.
+	 *
+	 * @param OutElement Will contain the element if the queue is not empty.
+	 * @return true if an element has been returned, false if the queue was empty.
+	 */
+	bool TryDequeue(ElementType& OutElement)
+	{
+		FCell* Cell;
+		uint32 Pos = DequeuePos.Load(EMemoryOrder::Relaxed);
+		while (true)
+		{
+			Cell = &Cells[Pos & (Capacity - 1)];
+			uint32 Sequence = Cell->Sequence.Load();
+			int32 Diff = int32(Sequence - (Pos + 1));
+			if (Diff == 0)
+			{
+				if (DequeuePos.CompareExchange(Pos, Pos + 1))
+				{
+					break;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false; // empty
+			}
+			else
+			{
+				Pos = DequeuePos.Load(EMemoryOrder::Relaxed);
+			}
+		}
+		ElementType* CellElement = Cell->Element.GetTypedPtr();
+		OutElement = MoveTemp(*CellElement);
+		CellElement->~ElementType();
+		Cell->Sequence.Store(Pos + Capacity);
+		return true;
+	}
+
+	/**
+	 * Checks whether the queue appears empty.
+	 *
+	 * The result reflects the calling thread's current view; another thread may
+	 * enqueue or dequeue before this function even returns.
+	 *
+	 * @return true if the queue looked empty.
+	 */
+	bool IsEmpty() const
+	{
+		uint32 Pos = DequeuePos.Load();
+		const FCell& Cell = Cells[Pos & (Capacity - 1)];
+		return int32(Cell.Sequence.Load() - (Pos + 1)) < 0;
+	}
+
+	/** Maximum number of elements the queue can hold. */
+	uint32 GetCapacity() const
+	{
+		return Capacity;
+	}
+
+private:
+
+	/** A slot in the ring; the sequence number encodes whether it holds an element and for which lap. */
+	struct FCell
+	{
+		TAtomic<uint32> Sequence;
+		TTypeCompatibleBytes<ElementType> Element;
+	};
+
+	/** The ring storage, allocated once at construction. */
+	FCell* Cells;
+
+	/** Size of the ring; always a power of two. */
+	uint32 Capacity;
+
+	/** Producer and consumer cursors on their own cache lines so producers don't false-share with consumers. */
+	MS_ALIGN(PLATFORM_CACHE_LINE_SIZE) TAtomic<uint32> EnqueuePos GCC_ALIGN(PLATFORM_CACHE_LINE_SIZE);
+	MS_ALIGN(PLATFORM_CACHE_LINE_SIZE) TAtomic<uint32> DequeuePos GCC_ALIGN(PLATFORM_CACHE_LINE_SIZE);
+
+private:
+
+	/** Hidden copy constructor. */
+	TMpmcQueue(const TMpmcQueue&) = delete;
+
+	/** Hidden assignment operator. */
+	TMpmcQueue& operator=(const TMpmcQueue&) = delete;
+};
@@ -30,7 +30,7 @@ struct FWeakObjectPtr;
 
 struct FWeakObjectPtr;
 
-template <typename ObjectPtrType>
+template <typename ObjectPtrType, typename InvocationListAllocator>
 class FMulticastDelegateBase;
 
 /**
@@ -38,7 +38,8 @@ class FMulticastDelegateBase;
  */
 class FDelegateBase
 {
-	friend class FMulticastDelegateBase<FWeakObjectPtr>;
+	template <typename ObjectPtrType, typename InvocationListAllocator>
+	friend class FMulticastDelegateBase;
 
 public:
 
@@ -1001,7 +1001,7 @@ public:
 
 		Super::LockInvocationList();
 		{
-			const TInvocationList& LocalInvocationList = Super::GetInvocationList();
+			const typename Super::FInvocationList& LocalInvocationList = Super::GetInvocationList();
 
 			// call bound functions in reverse order, so we ignore any instances that may be added by callees
 			for (int32 InvocationListIndex = LocalInvocationList.Num() - 1; InvocationListIndex >= 0; --InvocationListIndex)
@@ -1033,7 +1033,7 @@ protected:
 	 */
 	bool RemoveDelegateInstance( FDelegateHandle Handle )
 	{
-		const TInvocationList& LocalInvocationList = Super::GetInvocationList();
+		const typename Super::FInvocationList& LocalInvocationList = Super::GetInvocationList();
 
 		for (int32 InvocationListIndex = 0; InvocationListIndex < LocalInvocationList.Num(); ++InvocationListIndex)
 		{
@@ -21,11 +21,20 @@ typedef TArray<FDelegateBase, FMulticastInvocationListAllocatorType> TInvocation
 
 /**
  * Abstract base class for multicast delegates.
+ *
+ * InvocationListAllocator chooses the invocation list's storage; the default is the engine-wide
+ * policy above. Bespoke broadcast-heavy systems deriving from this directly can pass a
+ * TInlineAllocator so the common one-or-two binding case lives entirely inside the delegate
+ * object and never touches the allocator. The DECLARE_*_DELEGATE macro families cannot name an
+ * allocator (their parameter packs preclude a trailing default), which is why the engine-wide
+ * macro remains the knob for those.
  */
-template<typename ObjectPtrType>
+template<typename ObjectPtrType, typename InvocationListAllocator = FMulticastInvocationListAllocatorType>
 class FMulticastDelegateBase
 {
 public:
+	typedef TArray<FDelegateBase, InvocationListAllocator> FInvocationList;
+
 
 	~FMulticastDelegateBase()
 	{
@@ -212,7 +221,7 @@ protected:
 	 *
 	 * @return The invocation list.
 	 */
-	inline const TInvocationList& GetInvocationList( ) const
+	inline const FInvocationList& GetInvocationList( ) const
 	{
 		return InvocationList;
 	}
@@ -241,7 +250,7 @@ protected:
 private:
 
 	/** Holds the collection of delegate instances to invoke. */
-	TInvocationList InvocationList;
+	FInvocationList InvocationList;
 
 	/** Used to determine when a compaction should happen. */
 	int32 CompactionThreshold;
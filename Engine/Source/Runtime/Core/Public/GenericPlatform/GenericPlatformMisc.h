@@ -845,6 +845,23 @@ public:
 	 */
 	static int32 NumberOfCoresIncludingHyperthreads();
 
+	/**
+	 * return the number of NUMA nodes; 1 on platforms without NUMA topology (or without support for querying it)
+	 */
+	static int32 NumberOfNumaNodes()
+	{
+		return 1;
+	}
+
+	/**
+	 * return the mask of logical processors belonging to the given NUMA node, for use as a thread affinity mask.
+	 * Returns 0xFFFFFFFFFFFFFFFF (no restriction) for out-of-range nodes and on platforms without NUMA support.
+	 */
+	static uint64 GetNumaNodeProcessorMask(int32 NumaNode)
+	{
+		return 0xFFFFFFFFFFFFFFFF;
+	}
+
 	/**
 	 * Return the number of worker threads we should spawn, based on number of cores
 	 */
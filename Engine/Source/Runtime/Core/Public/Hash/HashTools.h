@@ -0,0 +1,54 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Array.h"
+
+/**
+ * FHashTools - fast non-cryptographic hashing for bulk data.
+ *
+ * FCrc::MemCrc32 walks a byte-at-a-time table; for payloads past a few dozen bytes that is the
+ * bottleneck, not the table lookup container around it. FHashTools provides:
+ *
+ *  - MemCrc32C: CRC-32C (Castagnoli polynomial), using the SSE4.2 crc32 instruction when the CPU
+ *    has it (detected once at runtime) and a sliced table fallback otherwise. Note the polynomial
+ *    differs from FCrc::MemCrc32; the two produce different values by design. Use this for new
+ *    hashing, not for checksums that must match existing serialized CRCs.
+ *  - HashBytes64/HashBytes32: a 64-bit bulk hasher over the vendored CityHash64, the engine's
+ *    in-tree equivalent of the modern xxh3-class hashers, for hash-table keying of spans.
+ *
+ * GetTypeHash overloads for byte spans live here too: include this header in modules keying
+ * TMap/TSet on byte arrays (network GUID payloads and the like) so those containers pick up the
+ * bulk hasher. Keep the include consistent across a key type's users; GetTypeHash must resolve
+ * identically in every translation unit that instantiates the container.
+ */
+struct CORE_API FHashTools
+{
+	/** CRC-32C over the buffer; hardware-accelerated where SSE4.2 is present. */
+	static uint32 MemCrc32C(const void* Data, int64 Length, uint32 CRC = 0);
+
+	/** 64-bit bulk hash suitable for hash-table keying; not stable across engine versions, do not persist. */
+	static uint64 HashBytes64(const void* Data, int64 Length, uint64 Seed = 0);
+
+	/** HashBytes64 folded to 32 bits for GetTypeHash-style consumers. */
+	static FORCEINLINE uint32 HashBytes32(const void* Data, int64 Length, uint64 Seed = 0)
+	{
+		const uint64 Hash = HashBytes64(Data, Length, Seed);
+		return (uint32)(Hash ^ (Hash >> 32));
+	}
+
+	/** True when MemCrc32C runs on the hardware instruction; exposed for stats/diagnostics. */
+	static bool IsHardwareCrcEnabled();
+};
+
+FORCEINLINE uint32 GetTypeHash(const TArrayView<const uint8>& Bytes)
+{
+	return FHashTools::HashBytes32(Bytes.GetData(), Bytes.Num());
+}
+
+FORCEINLINE uint32 GetTypeHash(const TArray<uint8>& Bytes)
+{
+	return FHashTools::HashBytes32(Bytes.GetData(), Bytes.Num());
+}
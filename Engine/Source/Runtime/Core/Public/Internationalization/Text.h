@@ -298,6 +298,16 @@ public:
 	 */
 	FTextFormatPatternDefinitionConstRef GetPatternDefinition() const;
 
+	/**
+	 * Format through a cache of recent results keyed on this pattern and the argument values, so
+	 * repeated identical formats (damage numbers, scoreboards) become a hash lookup instead of a
+	 * pattern evaluation and string build. Entries are invalidated when localization data changes.
+	 * The key is a 64-bit fingerprint, so an astronomically unlikely collision can alias two
+	 * argument sets; do not use for formats where that risk matters more than the speedup.
+	 */
+	FText FormatCached(const FFormatNamedArguments& InArguments) const;
+	FText FormatCached(const FFormatOrderedArguments& InArguments) const;
+
 	/**
 	 * Validate the format pattern is valid based on the rules of the given culture (or null to use the current language).
 	 * @return true if the pattern is valid, or false if not (false may also fill in OutValidationErrors).
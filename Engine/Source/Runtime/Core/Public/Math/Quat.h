@@ -341,7 +341,18 @@ public:
 	 * @return vector after rotation
 	 */
 	FVector RotateVector(FVector V) const;
-	
+
+	/**
+	 * Rotate an array of vectors by this quaternion. The quaternion is loaded into vector registers
+	 * once for the whole batch, so this is the call to use when rotating thousands of positions
+	 * (sockets, bones, crowd agents) rather than looping RotateVector.
+	 *
+	 * @param InVectors the vectors to be rotated; must not alias OutVectors
+	 * @param OutVectors receives the rotated vectors
+	 * @param Num number of vectors
+	 */
+	CORE_API void RotateVectors(const FVector* RESTRICT InVectors, FVector* RESTRICT OutVectors, int32 Num) const;
+
 	/**
 	 * Rotate a vector by the inverse of this quaternion.
 	 *
@@ -532,6 +532,9 @@ public:
 	FORCEINLINE FVector4 TransformFVector4(const FVector4& V) const;
 	FORCEINLINE FVector4 TransformFVector4NoScale(const FVector4& V) const;
 	FORCEINLINE FVector TransformPosition(const FVector& V) const;
+
+	/** Transform an array of positions. InPositions must not alias OutPositions. */
+	CORE_API void TransformPositions(const FVector* RESTRICT InPositions, FVector* RESTRICT OutPositions, int32 Num) const;
 	FORCEINLINE FVector TransformPositionNoScale(const FVector& V) const;
 
 	/** Inverts the transform and then transforms V - correctly handles scaling in this transform. */
@@ -542,6 +542,9 @@ public:
 	FORCEINLINE FVector		TransformPosition(const FVector& V) const;
 	FORCEINLINE FVector		TransformPositionNoScale(const FVector& V) const;
 
+	/** Transform an array of positions, hoisting the transform into vector registers once for the whole batch. InPositions must not alias OutPositions. */
+	CORE_API void			TransformPositions(const FVector* RESTRICT InPositions, FVector* RESTRICT OutPositions, int32 Num) const;
+
 
 	/** Inverts the transform and then transforms V - correctly handles scaling in this transform. */
 	FORCEINLINE FVector		InverseTransformPosition(const FVector &V) const;
@@ -100,6 +100,19 @@ struct FCompression
 	 */
 	CORE_API static bool VerifyCompressionFlagsValid(int32 InCompressionFlags);
 
+	/**
+	 * Creates a stateful streaming context for the given format, optionally primed with a preset
+	 * dictionary, so repeated chunk (de)compression pays codec setup and dictionary priming once.
+	 * Supported natively for Zlib; other formats provide it through ICompressionFormat. Returns
+	 * nullptr when the format has no streaming support. Caller owns the returned context.
+	 *
+	 * @param	FormatName		Name of the compression format
+	 * @param	bCompressor		true for a compression context, false for decompression
+	 * @param	Dictionary		Optional preset dictionary (e.g. trained on a packet corpus); both sides must use the same one
+	 * @param	CompressionData	Format-specific data (e.g. zlib bit window)
+	 */
+	CORE_API static struct ICompressionStreamContext* CreateStreamContext(FName FormatName, bool bCompressor, const TArray<uint8>* Dictionary = nullptr, int32 CompressionData = 0);
+
 
 
 
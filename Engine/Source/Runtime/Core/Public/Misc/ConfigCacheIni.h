@@ -7,6 +7,7 @@
 #pragma once
 
 #include "CoreTypes.h"
+#include "Templates/Atomic.h"
 #include "Containers/Array.h"
 #include "Containers/UnrealString.h"
 #include "Containers/Map.h"
@@ -542,6 +543,22 @@ public:
 
 	void Flush( bool Read, const FString& Filename=TEXT("") );
 
+	/**
+	 * Publishes an immutable snapshot of every value currently in the cache. Once published,
+	 * the GetSnapshot* readers are satisfied from the snapshot without seeing any in-progress
+	 * mutation, so they are safe to call from any thread while the owning thread writes.
+	 * Mutators republish automatically while a snapshot exists; call this once after startup
+	 * config loading settles to opt in. Must be called from the thread that owns the cache,
+	 * like every other mutator. Multi-value (array) keys publish their most recent value only.
+	 */
+	void RepublishReadOnlySnapshot();
+
+	/** Lock-free reads from the published snapshot. Return false if no snapshot is published or the key is absent. */
+	bool GetSnapshotString( const TCHAR* Section, const TCHAR* Key, FString& OutValue, const FString& Filename ) const;
+	bool GetSnapshotInt( const TCHAR* Section, const TCHAR* Key, int32& OutValue, const FString& Filename ) const;
+	bool GetSnapshotFloat( const TCHAR* Section, const TCHAR* Key, float& OutValue, const FString& Filename ) const;
+	bool GetSnapshotBool( const TCHAR* Section, const TCHAR* Key, bool& OutValue, const FString& Filename ) const;
+
 	void LoadFile( const FString& InFilename, const FConfigFile* Fallback = NULL, const TCHAR* PlatformString = NULL );
 	void SetFile( const FString& InFilename, const FConfigFile* NewConfigFile );
 	void UnloadFile( const FString& Filename );
@@ -884,6 +901,40 @@ private:
 	
 	/** The type of the cache (basically, do we call Flush in the destructor) */
 	EConfigCacheType Type;
+
+	/** Immutable published view of the cache for lock-free readers; see RepublishReadOnlySnapshot. */
+	struct FReadSnapshot
+	{
+		/** Values keyed by the Filename/section/key composite built by MakeKey. */
+		TMap<FString, FString> Values;
+
+		static FString MakeKey(const FString& Filename, const TCHAR* Section, const TCHAR* Key)
+		{
+			return FString::Printf(TEXT("%s||%s||%s"), *Filename, Section, Key);
+		}
+	};
+
+	/** Republishes after a mutation, but only once a snapshot has been opted into and not during a bulk mutator that republishes once at its end. */
+	void ConditionalRepublishReadOnlySnapshot()
+	{
+		if (!bSuppressSnapshotRepublish && CurrentReadSnapshot.Load(EMemoryOrder::Relaxed) != nullptr)
+		{
+			RepublishReadOnlySnapshot();
+		}
+	}
+
+	/** Set by bulk mutators (e.g. EmptySectionsMatchingString) so each inner mutation doesn't rebuild the snapshot. */
+	bool bSuppressSnapshotRepublish = false;
+
+	/** Currently published snapshot; readers load this pointer atomically. Null until the first publish. */
+	TAtomic<const FReadSnapshot*> CurrentReadSnapshot{ nullptr };
+
+	/**
+	 * Superseded snapshots. Readers may still be walking a snapshot when it is replaced and there is no
+	 * cheap way to know when they finish, so old snapshots are only freed with the cache itself.
+	 * Republishes are rare (explicit Set calls and flushes) so this list stays small.
+	 */
+	TArray<const FReadSnapshot*> RetiredReadSnapshots;
 };
 
 UE_DEPRECATED(4.24, "This functionality to generate Scalability@Level section string has been moved to Scalability.cpp. Explictly construct section you need manually.")
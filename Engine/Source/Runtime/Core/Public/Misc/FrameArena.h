@@ -0,0 +1,200 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Math/UnrealMathUtility.h"
+#include "Templates/AlignmentTemplates.h"
+#include "HAL/ThreadSingleton.h"
+#include "Misc/MemStack.h"
+
+/**
+ * Per-thread, frame-scoped bump-pointer arena for transient gameplay allocations.
+ *
+ * Allocations are never freed individually; every registered arena is reset by the game thread at the end of
+ * each frame (FCoreDelegates::OnEndFrame), so anything allocated from it must not survive the frame boundary.
+ * Pages come from FPageAllocator; allocations too large for a page fall back to FMemory::Malloc (i.e. the
+ * binned allocator) and are released at the frame reset. Each arena tracks its high-water mark so the page
+ * budget can be sized from production captures (see the memory stats and frameArena.DumpHighWaterMarks).
+ *
+ * This is deliberately not FMemStack: there are no marks and no nested scopes, which is what makes it safe
+ * to hand to container allocators that free in arbitrary order within the frame.
+ */
+class CORE_API FFrameArena : public TThreadSingleton<FFrameArena>
+{
+public:
+	FFrameArena();
+	~FFrameArena();
+
+	/** Allocates from the current page, starting a new page or falling back to the heap as required. **/
+	void* Alloc(int32 AllocSize, int32 Alignment);
+
+	/** Resets the arena, returning all pages and oversized blocks. Called for every registered arena at end of frame. **/
+	void Reset();
+
+	/** Bytes allocated from this arena since its last reset. **/
+	FORCEINLINE SIZE_T GetByteCount() const
+	{
+		return BytesAllocated;
+	}
+
+	/** Largest per-frame byte count this arena has ever seen; survives resets. **/
+	FORCEINLINE SIZE_T GetHighWaterMark() const
+	{
+		return HighWaterMark;
+	}
+
+	/** Resets every thread's registered arena. Bound to FCoreDelegates::OnEndFrame; callable manually by servers that run their own frame loop. **/
+	static void ResetAll();
+
+	/** Logs the per-thread high-water marks, for sizing the arena in production. **/
+	static void DumpHighWaterMarks();
+
+private:
+	struct FPage
+	{
+		FPage* Next;
+	};
+
+	/** Oversized allocations that bypassed the page path; chained so Reset can return them to the heap. **/
+	struct FOversizedBlock
+	{
+		FOversizedBlock* Next;
+	};
+
+	void AllocateNewPage();
+
+	uint8*				Top;
+	uint8*				End;
+	FPage*				TopPage;
+	FOversizedBlock*	OversizedBlocks;
+	SIZE_T				BytesAllocated;
+	SIZE_T				HighWaterMark;
+	uint32				OwnerThreadId;
+};
+
+FORCEINLINE void* FFrameArena::Alloc(int32 AllocSize, int32 Alignment)
+{
+	checkSlow(AllocSize >= 0);
+	checkSlow((Alignment & (Alignment - 1)) == 0);
+
+	BytesAllocated += AllocSize;
+	uint8* Result = Align(Top, Alignment);
+	uint8* NewTop = Result + AllocSize;
+	if (NewTop <= End)
+	{
+		Top = NewTop;
+		return Result;
+	}
+	if (AllocSize + Alignment + (int32)sizeof(FOversizedBlock) >= FPageAllocator::PageSize - (int32)sizeof(FPage))
+	{
+		// Too big for the page path; take it from the heap and chain it for the frame reset.
+		FOversizedBlock* Block = (FOversizedBlock*)FMemory::Malloc(AllocSize + Alignment + sizeof(FOversizedBlock), alignof(FOversizedBlock));
+		Block->Next = OversizedBlocks;
+		OversizedBlocks = Block;
+		return Align((uint8*)(Block + 1), Alignment);
+	}
+	AllocateNewPage();
+	Result = Align(Top, Alignment);
+	Top = Result + AllocSize;
+	return Result;
+}
+
+/** A container allocator that allocates from the calling thread's frame arena. Containers using it must not outlive the frame. */
+template<uint32 Alignment = DEFAULT_ALIGNMENT>
+class TFrameArenaAllocator
+{
+public:
+	using SizeType = int32;
+
+	enum { NeedsElementType = true };
+	enum { RequireRangeCheck = true };
+
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		/** Default constructor. */
+		ForElementType():
+			Data(nullptr)
+		{}
+
+		/**
+		 * Moves the state of another allocator into this one.
+		 * Assumes that the allocator is currently empty, i.e. memory may be allocated but any existing elements have already been destructed (if necessary).
+		 * @param Other - The allocator to move the state from.  This allocator should be left in a valid empty state.
+		 */
+		FORCEINLINE void MoveToEmpty(ForElementType& Other)
+		{
+			checkSlow(this != &Other);
+
+			Data       = Other.Data;
+			Other.Data = nullptr;
+		}
+
+		// FContainerAllocatorInterface
+		FORCEINLINE ElementType* GetAllocation() const
+		{
+			return Data;
+		}
+		void ResizeAllocation(SizeType PreviousNumElements, SizeType NumElements, SIZE_T NumBytesPerElement)
+		{
+			void* OldData = Data;
+			if( NumElements )
+			{
+				// Allocate memory from the arena; the old allocation is abandoned until the frame reset.
+				Data = (ElementType*)FFrameArena::Get().Alloc(
+					NumElements * NumBytesPerElement,
+					FMath::Max(Alignment,(uint32)alignof(ElementType))
+					);
+
+				// If the container previously held elements, copy them into the new allocation.
+				if(OldData && PreviousNumElements)
+				{
+					const SizeType NumCopiedElements = FMath::Min(NumElements,PreviousNumElements);
+					FMemory::Memcpy(Data,OldData,NumCopiedElements * NumBytesPerElement);
+				}
+			}
+		}
+		FORCEINLINE SizeType CalculateSlackReserve(SizeType NumElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackReserve(NumElements, NumBytesPerElement, false, Alignment);
+		}
+		FORCEINLINE SizeType CalculateSlackShrink(SizeType NumElements, SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackShrink(NumElements, NumAllocatedElements, NumBytesPerElement, false, Alignment);
+		}
+		FORCEINLINE SizeType CalculateSlackGrow(SizeType NumElements, SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackGrow(NumElements, NumAllocatedElements, NumBytesPerElement, false, Alignment);
+		}
+
+		FORCEINLINE SIZE_T GetAllocatedSize(SizeType NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return NumAllocatedElements * NumBytesPerElement;
+		}
+
+		bool HasAllocation() const
+		{
+			return !!Data;
+		}
+
+	private:
+
+		/** A pointer to the container's elements. */
+		ElementType* Data;
+	};
+
+	typedef ForElementType<FScriptContainerElement> ForAnyElementType;
+};
+
+template <uint32 Alignment>
+struct TAllocatorTraits<TFrameArenaAllocator<Alignment>> : TAllocatorTraitsBase<TFrameArenaAllocator<Alignment>>
+{
+	enum { SupportsMove    = true };
+	enum { IsZeroConstruct = true };
+};
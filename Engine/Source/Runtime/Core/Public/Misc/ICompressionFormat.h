@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreTypes.h"
+#include "Containers/Array.h"
 #include "Features/IModularFeatures.h"
 #include "Modules/ModuleInterface.h"
 #include "Modules/ModuleManager.h"
@@ -11,6 +12,35 @@
 
 #define COMPRESSION_FORMAT_FEATURE_NAME "CompressionFormat"
 
+/**
+ * Stateful streaming context for formats that support it (see ICompressionFormat::CreateStreamContext).
+ * A context is created once (optionally primed with a preset dictionary), fed one chunk at a time, and
+ * Reset between independent payloads so codec setup and dictionary priming are paid once, not per chunk.
+ * Contexts are single-direction (compressor or decompressor) and not thread safe.
+ */
+struct ICompressionStreamContext
+{
+	virtual ~ICompressionStreamContext() {}
+
+	/**
+	 * Compresses one chunk. Only valid on a compressor context.
+	 * @param CompressedSize in: capacity of CompressedBuffer; out: bytes written
+	 * @param bFinish true for the final chunk of the payload, flushing all buffered state
+	 * @return false on failure (e.g. output buffer too small)
+	 */
+	virtual bool CompressChunk(void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize, bool bFinish) = 0;
+
+	/**
+	 * Uncompresses one chunk. Only valid on a decompressor context.
+	 * @param UncompressedSize in: capacity of UncompressedBuffer; out: bytes written
+	 * @return false on failure
+	 */
+	virtual bool UncompressChunk(void* UncompressedBuffer, int32& UncompressedSize, const void* CompressedBuffer, int32 CompressedSize) = 0;
+
+	/** Rewinds the context for a new independent payload, re-applying any dictionary; much cheaper than recreating it. */
+	virtual bool Reset() = 0;
+};
+
 struct ICompressionFormat : public IModularFeature, public IModuleInterface
 {
 	virtual FName GetCompressionFormatName() = 0;
@@ -19,4 +49,13 @@ struct ICompressionFormat : public IModularFeature, public IModuleInterface
 	virtual int32 GetCompressedBufferSize(int32 UncompressedSize, int32 CompressionData) = 0;
 	virtual uint32 GetVersion() = 0;
 	virtual FString GetDDCKeySuffix() = 0;
+
+	/**
+	 * Creates a streaming context, optionally primed with a preset dictionary, or returns nullptr for
+	 * formats that are one-shot only (the default). Caller owns the returned context.
+	 */
+	virtual ICompressionStreamContext* CreateStreamContext(bool bCompressor, const TArray<uint8>* Dictionary, int32 CompressionData)
+	{
+		return nullptr;
+	}
 };
@@ -0,0 +1,83 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "Misc/MemStack.h"
+#include "Containers/ContainerAllocationPolicies.h"
+
+/**
+ * Declared lifetime of a FNamedLinearAllocator; purely a contract, but one the diagnostics verify.
+ */
+enum class ELinearAllocatorLifetime : uint8
+{
+	/** Reset automatically at the end of every frame (FCoreDelegates::OnEndFrame). */
+	Frame,
+	/** Owner resets it at the end of its tick group; diagnostics flag it if it survives a whole frame. */
+	TickGroup,
+	/** Owner resets it when its async task completes; exempt from the frame-cadence checks. */
+	AsyncTask
+};
+
+/**
+ * A per-system linear allocator with an explicit, named lifetime.
+ *
+ * This is FMemStackBase productized for gameplay systems: pages still come from (and are recycled
+ * through) the shared FPageAllocator freelist, so steady-state operation touches the general heap
+ * not at all, but unlike the render-thread FMemStack usage the lifetime is explicit. The owning
+ * system constructs one with a name and a declared lifetime, allocates from it (PushBytes or the
+ * FMemStackBase placement new operators), and calls EndLifetime() at the declared boundary.
+ * Frame-lifetime allocators are ended automatically.
+ *
+ * Diagnostics: each allocator tracks its high-water mark and the frame of its last reset. The
+ * linearAlloc.Dump console command lists every live allocator, and allocators that miss their
+ * declared reset cadence (a TickGroup/Frame allocator that survives frames without an EndLifetime)
+ * are reported, which is what catches the "leak" failure mode of linear allocation: memory that
+ * was supposed to be transient quietly becoming permanent.
+ *
+ * Not thread safe; one instance belongs to one system on one thread, which is the use case. Systems
+ * running on async tasks declare AsyncTask lifetime and own their reset.
+ */
+class CORE_API FNamedLinearAllocator : public FMemStackBase
+{
+public:
+	FNamedLinearAllocator(const TCHAR* InName, ELinearAllocatorLifetime InLifetime);
+	~FNamedLinearAllocator();
+
+	/** Ends the declared lifetime: verifies the stack is mark-free, records stats and recycles all chunks. **/
+	void EndLifetime();
+
+	/** The name this allocator registered under. **/
+	const TCHAR* GetName() const
+	{
+		return Name;
+	}
+
+	/** Declared lifetime contract. **/
+	ELinearAllocatorLifetime GetLifetime() const
+	{
+		return Lifetime;
+	}
+
+	/** Largest byte count ever seen at EndLifetime. **/
+	SIZE_T GetHighWaterMark() const
+	{
+		return HighWaterMark;
+	}
+
+	/** Logs name, current bytes, high water and reset cadence for every live allocator. **/
+	static void DumpAllocators();
+
+private:
+	/** Bound to FCoreDelegates::OnEndFrame; ends Frame-lifetime allocators and runs the cadence diagnostics. **/
+	static void OnEndFrame();
+
+	const TCHAR*				Name;
+	ELinearAllocatorLifetime	Lifetime;
+	SIZE_T						HighWaterMark;
+	/** GFrameCounter value at the last EndLifetime, for the missed-reset diagnostic. **/
+	uint64						LastResetFrame;
+	/** Set once the missed-reset warning fired, so it logs once per offender rather than every frame. **/
+	bool						bReportedMissedReset;
+};
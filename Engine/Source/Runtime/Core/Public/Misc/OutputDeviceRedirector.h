@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreTypes.h"
+#include "Containers/LockFreeList.h"
 #include "Misc/OutputDevice.h"
 #include "Containers/Array.h"
 #include "Containers/UnrealString.h"
@@ -60,8 +61,8 @@ public:
 private:
 	enum { InlineLogEntries = 16 };
 
-	/** A FIFO of lines logged by non-master threads. */
-	TArray<FBufferedLine, TInlineAllocator<InlineLogEntries>> BufferedLines;
+	/** A lock-free FIFO of lines logged by non-master threads; producers stage without contending on a lock and the master thread drains in arrival order. */
+	TLockFreePointerListFIFO<FBufferedLine, PLATFORM_CACHE_LINE_SIZE> BufferedLines;
 
 	/** A FIFO backlog of messages logged before the editor had a chance to intercept them. */
 	TArray<FBufferedLine> BacklogLines;
@@ -82,7 +83,6 @@ private:
 
 	/** Objects used for synchronization via a scoped lock */
 	FCriticalSection	SynchronizationObject;
-	FCriticalSection	BufferSynchronizationObject;
 	FCriticalSection	OutputDevicesMutex;
 	FThreadSafeCounter	OutputDevicesLockCounter;
 
@@ -4,6 +4,7 @@
 
 #include "CoreTypes.h"
 #include "GenericPlatform/GenericPlatformAffinity.h"
+#include "HAL/PlatformAffinity.h"
 
 class IQueuedWork;
 
@@ -23,9 +24,12 @@ public:
 	 * @param InNumQueuedThreads Specifies the number of threads to use in the pool
 	 * @param StackSize The size of stack the threads in the pool need (32K default)
 	 * @param ThreadPriority priority of new pool thread
+	 * @param ThreadAffinityMask affinity mask for the pool threads; defaults to the platform pool mask.
+	 *        Pass FPlatformMisc::GetNumaNodeProcessorMask(Node) to pin a pool to one NUMA node so its
+	 *        threads' first-touch allocations (including the binned allocator's TLS caches) stay node-local.
 	 * @return Whether the pool creation was successful or not
 	 */
-	virtual bool Create( uint32 InNumQueuedThreads, uint32 StackSize = (32 * 1024), EThreadPriority ThreadPriority=TPri_Normal ) = 0;
+	virtual bool Create( uint32 InNumQueuedThreads, uint32 StackSize = (32 * 1024), EThreadPriority ThreadPriority=TPri_Normal, uint64 ThreadAffinityMask = FPlatformAffinity::GetPoolThreadMask() ) = 0;
 
 	/** Tells the pool to clean up all background threads */
 	virtual void Destroy() = 0;
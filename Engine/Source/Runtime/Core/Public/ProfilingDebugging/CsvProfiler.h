@@ -211,6 +211,13 @@ struct FCsvCaptureCommand
 /**
 * FCsvProfiler class. This manages recording and reporting all for CSV stats
 */
+// Note on automatic hitch attribution: per-frame, per-thread timing scopes already flow
+// through this profiler, so the data a hitch triager needs exists in memory during the hitch
+// frame. The missing piece is a consumer that, when frame time exceeds budget, snapshots the
+// top scopes per thread from the current frame's buffers and emits them through analytics/log
+// instead of requiring a tethered capture - an additive reader over these buffers. The
+// subtlety is that buffer processing is deferred (worker-thread processed), so the triager
+// must either force a flush on hitch or tolerate one-frame-late attribution.
 class FCsvProfiler
 {
 	friend class FCsvProfilerProcessingThread;
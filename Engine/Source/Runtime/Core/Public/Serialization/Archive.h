@@ -649,6 +649,18 @@ public:
 
 	virtual void Seek(int64 InPos) { }
 
+	/**
+	 * If this archive reads from a stable in-memory region that outlives the load (e.g. a memory-mapped
+	 * file region), returns a pointer to Size bytes at the current position and advances past them, so
+	 * the caller can reference the data in place instead of copying it out. Returns nullptr when the
+	 * storage is not mapped (the default) or the read would pass the end; the caller must then
+	 * Serialize normally. See SerializeArrayAsView for the intended POD bulk array use.
+	 */
+	virtual const uint8* ReadMappedView(int64 Size)
+	{
+		return nullptr;
+	}
+
 	/**
 	 * Attaches/ associates the passed in bulk data object with the linker.
 	 *
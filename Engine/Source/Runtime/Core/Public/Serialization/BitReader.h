@@ -70,6 +70,27 @@ public:
 	{
 		if (!IsError())
 		{
+#if PLATFORM_LITTLE_ENDIAN
+			// Mirror of the writer's bulk path: power-of-two ranges are always exactly
+			// CeilLogTwo(ValueMax) bits, LSB first, so read them in one copy.
+			if (FMath::IsPowerOfTwo(ValueMax))
+			{
+				const int64 LengthBits = FMath::CeilLogTwo(ValueMax);
+				if (Pos + LengthBits > Num)
+				{
+					SetOverflowed(LengthBits);
+					OutValue = 0;
+					return;
+				}
+
+				uint32 Value = 0;
+				appBitsCpy((uint8*)&Value, 0, Buffer.GetData(), Pos, LengthBits);
+				Pos += LengthBits;
+				OutValue = Value;
+				return;
+			}
+#endif
+
 			// Use local variable to avoid Load-Hit-Store
 			uint32 Value = 0;
 			int64 LocalPos = Pos;
@@ -0,0 +1,99 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+#include "Containers/UnrealString.h"
+#include "Containers/ArrayView.h"
+#include "Serialization/MemoryArchive.h"
+#include "Async/MappedFileHandle.h"
+#include "Templates/IsPODType.h"
+
+/**
+ * Archive for reading from a memory-mapped file region without copying.
+ *
+ * Ordinary reads behave like FMemoryReader (they memcpy out of the mapping), but because the mapping
+ * is stable for the region's lifetime this archive also implements ReadMappedView, so POD bulk
+ * arrays deserialized through SerializeArrayAsView become views into the mapping instead of copies.
+ * The caller owns the region and must keep it alive for as long as any handed-out view is in use.
+ */
+class FMappedRegionReader : public FMemoryArchive
+{
+public:
+	explicit FMappedRegionReader(IMappedFileRegion* InRegion, bool bIsPersistent = true)
+		: Region(InRegion)
+	{
+		check(Region);
+		this->SetIsLoading(true);
+		this->SetIsPersistent(bIsPersistent);
+	}
+
+	virtual FString GetArchiveName() const override
+	{
+		return TEXT("FMappedRegionReader");
+	}
+
+	virtual int64 TotalSize() override
+	{
+		return Region->GetMappedSize();
+	}
+
+	virtual void Serialize(void* Data, int64 Num) override
+	{
+		if (Num && !ArIsError)
+		{
+			// Only serialize if we have the requested amount of data
+			if (Offset + Num <= TotalSize())
+			{
+				FMemory::Memcpy(Data, Region->GetMappedPtr() + Offset, Num);
+				Offset += Num;
+			}
+			else
+			{
+				ArIsError = true;
+			}
+		}
+	}
+
+	virtual const uint8* ReadMappedView(int64 Size) override
+	{
+		if (ArIsError || Size < 0 || Offset + Size > TotalSize())
+		{
+			return nullptr;
+		}
+		const uint8* Result = Region->GetMappedPtr() + Offset;
+		Offset += Size;
+		return Result;
+	}
+
+private:
+	IMappedFileRegion* Region;
+};
+
+/**
+ * Deserializes Num POD elements as a view into the archive's mapped storage when available.
+ *
+ * On success OutView points directly into the mapping (valid for the mapping's lifetime, not the
+ * archive's) and the archive has advanced past the data. On failure nothing is consumed and the
+ * caller must fall back to the copying path (e.g. BulkSerialize into a TArray). Endianness and
+ * alignment are the caller's contract, the same one BulkSerialize already imposes on cooked data.
+ */
+template<typename ElementType>
+bool SerializeArrayAsView(FArchive& Ar, TArrayView<const ElementType>& OutView, int32 Num)
+{
+	static_assert(TIsPODType<ElementType>::Value, "View deserialization is only valid for POD element types");
+	check(Num >= 0);
+	if (Ar.IsLoading() && !Ar.IsByteSwapping())
+	{
+		const uint8* Mapped = Ar.ReadMappedView((int64)Num * sizeof(ElementType));
+		if (Mapped)
+		{
+			OutView = TArrayView<const ElementType>((const ElementType*)Mapped, Num);
+			return true;
+		}
+	}
+	return false;
+}
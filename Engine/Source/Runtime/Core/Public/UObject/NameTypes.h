@@ -181,6 +181,8 @@ private:
 	FNameEntryId ComparisonId;
 #endif
 	FNameEntryHeader Header;
+	/** Case-folded first characters packed big-endian; ordering-consistent with case-insensitive comparison. See FName::CompareFast. */
+	uint64 LexicalSortKey;
 	union
 	{
 		ANSICHAR	AnsiName[NAME_SIZE];
@@ -246,6 +248,15 @@ public:
 
 	static int32 GetDataOffset();
 	struct FNameStringView MakeView(union FNameBuffer& OptionalDecodeBuffer) const;
+
+	/**
+	 * Precomputed key for lexical ordering: comparing two entries' keys orders them exactly like the
+	 * case-insensitive string comparison whenever the keys differ; equal keys require the full compare.
+	 */
+	FORCEINLINE uint64 GetLexicalSortKey() const
+	{
+		return LexicalSortKey;
+	}
 private:
 	friend class FName;
 	friend struct FNameHelper;
@@ -613,6 +624,16 @@ public:
 	 */
 	int32 Compare( const FName& Other ) const;
 
+	/**
+	 * Compares name to passed in one, same alphabetical ascending order as Compare, but resolved
+	 * through each entry's precomputed lexical sort key so most comparisons are two integer loads
+	 * and a compare. Use for sort-heavy consumers (asset registry ordering, detail panels).
+	 *
+	 * @param	Other	Name to compare this against
+	 * @return	< 0 is this < Other, 0 if this == Other, > 0 if this > Other
+	 */
+	CORE_API int32 CompareFast( const FName& Other ) const;
+
 	/**
 	 * Fast compares name to passed in one using indexes. Sort is allocation order ascending.
 	 *
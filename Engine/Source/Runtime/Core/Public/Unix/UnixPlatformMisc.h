@@ -80,6 +80,8 @@ struct CORE_API FUnixPlatformMisc : public FGenericPlatformMisc
 
 	static int32 NumberOfCores();
 	static int32 NumberOfCoresIncludingHyperthreads();
+	static int32 NumberOfNumaNodes();
+	static uint64 GetNumaNodeProcessorMask(int32 NumaNode);
 	static FString GetOperatingSystemId();
 	static bool GetDiskTotalAndFreeSpace(const FString& InPath, uint64& TotalNumberOfBytes, uint64& NumberOfFreeBytes);
 
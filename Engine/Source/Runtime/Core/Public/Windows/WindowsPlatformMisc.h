@@ -77,6 +77,8 @@ struct CORE_API FWindowsPlatformMisc
 	static bool IsValidAbsolutePathFormat(const FString& Path);
 	static int32 NumberOfCores();
 	static int32 NumberOfCoresIncludingHyperthreads();
+	static int32 NumberOfNumaNodes();
+	static uint64 GetNumaNodeProcessorMask(int32 NumaNode);
 	static int32 NumberOfWorkerThreadsToSpawn();
 
 	static const TCHAR* GetPlatformFeaturesModuleName();
@@ -219,6 +219,93 @@ static FAutoConsoleVariableRef CVar_EditorLoadPrecacheSizeKB(
 	TEXT("Size, in KB, to precache when loading packages in the editor.")
 );
 
+/** Named async loading budget profiles; see RegisterAsyncLoadingBudgetProfile. */
+struct FAsyncLoadingBudgetProfile
+{
+	/** Per-tick time slice in seconds; <= 0 means unbounded ticks. */
+	float TimeLimitSeconds;
+	/** Cap on packages processed per tick; <= 0 means no cap. */
+	int32 MaxPackagesPerTick;
+
+	FAsyncLoadingBudgetProfile(float InTimeLimitSeconds = -1.0f, int32 InMaxPackagesPerTick = 0)
+		: TimeLimitSeconds(InTimeLimitSeconds)
+		, MaxPackagesPerTick(InMaxPackagesPerTick)
+	{
+	}
+};
+
+static FCriticalSection GAsyncLoadingBudgetProfilesLock;
+static TMap<FName, FAsyncLoadingBudgetProfile> GAsyncLoadingBudgetProfiles;
+/** Copy of the active profile, read from the loading tick; updated under the lock, flagged by the bool. */
+static FAsyncLoadingBudgetProfile GActiveAsyncLoadingBudgetProfile;
+static bool GAsyncLoadingBudgetProfileActive = false;
+
+void RegisterAsyncLoadingBudgetProfile(FName ProfileName, float TimeLimitMs, int32 MaxPackagesPerTick)
+{
+	check(ProfileName != NAME_None);
+	FScopeLock Lock(&GAsyncLoadingBudgetProfilesLock);
+	FAsyncLoadingBudgetProfile& Profile = GAsyncLoadingBudgetProfiles.FindOrAdd(ProfileName);
+	Profile.TimeLimitSeconds = TimeLimitMs > 0.0f ? TimeLimitMs / 1000.0f : -1.0f;
+	Profile.MaxPackagesPerTick = MaxPackagesPerTick;
+}
+
+void SetAsyncLoadingBudgetProfile(FName ProfileName)
+{
+	FScopeLock Lock(&GAsyncLoadingBudgetProfilesLock);
+	if (ProfileName == NAME_None)
+	{
+		GAsyncLoadingBudgetProfileActive = false;
+		return;
+	}
+	if (!GAsyncLoadingBudgetProfiles.Num())
+	{
+		// built-ins registered on first use so they can also be re-tuned by the game
+		GAsyncLoadingBudgetProfiles.Add(TEXT("LoadingScreen"), FAsyncLoadingBudgetProfile(-1.0f, 0));
+		GAsyncLoadingBudgetProfiles.Add(TEXT("Streaming"), FAsyncLoadingBudgetProfile(0.001f, 4));
+	}
+	if (const FAsyncLoadingBudgetProfile* Profile = GAsyncLoadingBudgetProfiles.Find(ProfileName))
+	{
+		GActiveAsyncLoadingBudgetProfile = *Profile;
+		GAsyncLoadingBudgetProfileActive = true;
+	}
+	else
+	{
+		UE_LOG(LogStreaming, Warning, TEXT("SetAsyncLoadingBudgetProfile: unknown profile '%s'"), *ProfileName.ToString());
+	}
+}
+
+static FAutoConsoleCommand GSetAsyncLoadingBudgetProfileCmd(
+	TEXT("s.AsyncLoadingBudgetProfile"),
+	TEXT("Switches the active async loading budget profile (LoadingScreen, Streaming, or a game-registered name; None restores caller limits)."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		SetAsyncLoadingBudgetProfile(Args.Num() ? FName(*Args[0]) : NAME_None);
+	}));
+
+/** If set, deferred PostLoad objects whose classes opted in are regrouped by class before dispatch; see MarkClassPostLoadOrderIndependent. */
+static int32 GGroupPostLoadsByClass = 1;
+static FAutoConsoleVariableRef CVarGroupPostLoadsByClass(
+	TEXT("s.GroupPostLoadsByClass"),
+	GGroupPostLoadsByClass,
+	TEXT("If true, deferred PostLoads of classes marked order-independent run grouped by class to improve code and data locality."),
+	ECVF_Default
+);
+
+static FCriticalSection GPostLoadOrderIndependentClassesLock;
+static TSet<FName> GPostLoadOrderIndependentClasses;
+
+void MarkClassPostLoadOrderIndependent(FName ClassPathName)
+{
+	FScopeLock Lock(&GPostLoadOrderIndependentClassesLock);
+	GPostLoadOrderIndependentClasses.Add(ClassPathName);
+}
+
+static bool IsClassPostLoadOrderIndependent(const UClass* Class)
+{
+	FScopeLock Lock(&GPostLoadOrderIndependentClassesLock);
+	return GPostLoadOrderIndependentClasses.Contains(Class->GetFName());
+}
+
 int32 GAsyncLoadingPrecachePriority = (int32)AIOP_MIN;
 static FAutoConsoleVariableRef CVarAsyncLoadingPrecachePriority(
 	TEXT("s.AsyncLoadingPrecachePriority"),
@@ -3979,6 +4066,9 @@ EAsyncPackageState::Type FAsyncLoadingThread::ProcessAsyncLoading(int32& OutPack
 	EAsyncPackageState::Type LoadingState = EAsyncPackageState::Complete;
 	OutPackagesProcessed = 0;
 
+	// package concurrency cap from the active budget profile; only meaningful for budgeted ticks
+	const int32 MaxPackagesThisTick = (GAsyncLoadingBudgetProfileActive && bUseTimeLimit) ? GActiveAsyncLoadingBudgetProfile.MaxPackagesPerTick : 0;
+
 	double TickStartTime = FPlatformTime::Seconds();
 
 	if (GEventDrivenLoaderEnabled)
@@ -4160,6 +4250,11 @@ EAsyncPackageState::Type FAsyncLoadingThread::ProcessAsyncLoading(int32& OutPack
 		for (int32 PackageIndex = 0; ((bDepthFirst && LoadingState == EAsyncPackageState::Complete) || (!bDepthFirst && LoadingState != EAsyncPackageState::TimeOut)) && PackageIndex < AsyncPackages.Num(); ++PackageIndex)
 		{
 			SCOPED_LOADTIMER(ProcessAsyncLoadingTime);
+			if (MaxPackagesThisTick > 0 && OutPackagesProcessed >= MaxPackagesThisTick)
+			{
+				LoadingState = EAsyncPackageState::TimeOut;
+				break;
+			}
 			OutPackagesProcessed++;
 
 			// Package to be loaded.
@@ -4490,6 +4585,20 @@ EAsyncPackageState::Type FAsyncLoadingThread::TickAsyncLoading(bool bUseTimeLimi
 	check(IsInGameThread());
 	check(!IsGarbageCollecting());
 
+	// The active budget profile overrides time-limited ticks; explicitly unbounded calls (flushes)
+	// are never constrained, and an unbounded profile lifts the caller's limit (loading screens).
+	if (GAsyncLoadingBudgetProfileActive)
+	{
+		if (GActiveAsyncLoadingBudgetProfile.TimeLimitSeconds <= 0.0f)
+		{
+			bUseTimeLimit = false;
+		}
+		else if (bUseTimeLimit)
+		{
+			TimeLimit = GActiveAsyncLoadingBudgetProfile.TimeLimitSeconds;
+		}
+	}
+
 	const bool bLoadingSuspended = IsAsyncLoadingSuspended();
 	EAsyncPackageState::Type Result = bLoadingSuspended ? EAsyncPackageState::PendingImports : EAsyncPackageState::Complete;
 
@@ -6416,6 +6525,45 @@ EAsyncPackageState::Type FAsyncPackage::PostLoadDeferredObjects(double InTickSta
 
 	STAT(double PostLoadStartTime = FPlatformTime::Seconds());
 
+	// Regroup the pending range so objects of classes that declared their PostLoad order-independent
+	// run back to back: one class's PostLoad code and data stay hot across its whole batch instead of
+	// ping-ponging between unrelated vtables. Unmarked objects keep their original relative order and
+	// run first; marked classes run after, which their declared order independence makes legal.
+	if (GGroupPostLoadsByClass && !bDeferredPostLoadsGrouped && DeferredPostLoadObjects.Num() - DeferredPostLoadIndex > 2)
+	{
+		bDeferredPostLoadsGrouped = true;
+		TArray<UObject*> Unmarked;
+		TMap<UClass*, TArray<UObject*>> MarkedByClass;
+		for (int32 ObjectIndex = DeferredPostLoadIndex; ObjectIndex < DeferredPostLoadObjects.Num(); ObjectIndex++)
+		{
+			UObject* PendingObject = DeferredPostLoadObjects[ObjectIndex];
+			if (PendingObject && IsClassPostLoadOrderIndependent(PendingObject->GetClass()))
+			{
+				MarkedByClass.FindOrAdd(PendingObject->GetClass()).Add(PendingObject);
+			}
+			else
+			{
+				Unmarked.Add(PendingObject);
+			}
+		}
+		if (MarkedByClass.Num())
+		{
+			int32 WriteIndex = DeferredPostLoadIndex;
+			for (UObject* PendingObject : Unmarked)
+			{
+				DeferredPostLoadObjects[WriteIndex++] = PendingObject;
+			}
+			for (TPair<UClass*, TArray<UObject*>>& ClassBatch : MarkedByClass)
+			{
+				for (UObject* PendingObject : ClassBatch.Value)
+				{
+					DeferredPostLoadObjects[WriteIndex++] = PendingObject;
+				}
+			}
+			check(WriteIndex == DeferredPostLoadObjects.Num());
+		}
+	}
+
 	while (DeferredPostLoadIndex < DeferredPostLoadObjects.Num() && 
 		!AsyncLoadingThread.IsAsyncLoadingSuspended() &&
 		!::IsTimeLimitExceeded(InTickStartTime, bInUseTimeLimit, InOutTimeLimit, LastTypeOfWorkPerformed, LastObjectWorkWasPerformedOn))
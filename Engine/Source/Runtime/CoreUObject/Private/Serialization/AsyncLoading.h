@@ -564,6 +564,8 @@ private:
 	int32							PostLoadIndex;
 	/** Current index into DeferredPostLoadObjects array used to spread routing PostLoad over several frames			*/
 	int32						DeferredPostLoadIndex;
+	/** True once the pending deferred PostLoad range has been regrouped by class (s.GroupPostLoadsByClass). */
+	bool bDeferredPostLoadsGrouped = false;
 	/** Current index into DeferredFinalizeObjects array used to spread routing PostLoad over several frames			*/
 	int32						DeferredFinalizeIndex;
 	/** Current index into DeferredClusterObjects array used to spread routing CreateClusters over several frames			*/
@@ -395,6 +395,113 @@ bool FUntypedBulkData::IsStoredCompressedOnDisk() const
 	return (BulkDataFlags & BULKDATA_SerializeCompressed) ? true : false;
 }
 
+/*-----------------------------------------------------------------------------
+	Recycle cache for recently evicted bulk payloads.
+-----------------------------------------------------------------------------*/
+
+/** Budget in megabytes for the compressed recycle cache of recently evicted bulk payloads; 0 disables it. */
+static int32 GBulkDataRecycleCacheMB = 0;
+static FAutoConsoleVariableRef CVarBulkDataRecycleCacheMB(
+	TEXT("s.BulkDataRecycleCacheMB"),
+	GBulkDataRecycleCacheMB,
+	TEXT("If > 0, payloads of unloaded bulk data are kept zlib-compressed in a bounded LRU keyed by file and offset, so re-requests (weapon swap churn) skip pak IO and pay only a decompress."),
+	ECVF_Default
+);
+
+namespace BulkDataRecycleCache
+{
+
+struct FEntry
+{
+	TArray<uint8> CompressedPayload;
+	int64 UncompressedSize = 0;
+	uint64 LastUsed = 0;
+};
+
+static FCriticalSection GLock;
+static TMap<FString, FEntry> GEntries;
+static int64 GTotalBytes = 0;
+static uint64 GAccessCounter = 0;
+
+static FString MakeKey(const FString& Filename, int64 Offset)
+{
+	return FString::Printf(TEXT("%s@%lld"), *Filename, Offset);
+}
+
+/** Compresses and stores an evicted payload, evicting least recently used entries past the budget. */
+static void Put(const FString& Filename, int64 Offset, const void* Payload, int64 PayloadSize)
+{
+	const int64 BudgetBytes = (int64)GBulkDataRecycleCacheMB * 1024 * 1024;
+	if (BudgetBytes <= 0 || PayloadSize <= 0 || PayloadSize > BudgetBytes || PayloadSize >= MAX_int32)
+	{
+		return;
+	}
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, (int32)PayloadSize);
+	TArray<uint8> Compressed;
+	Compressed.SetNumUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Payload, (int32)PayloadSize))
+	{
+		return;
+	}
+	Compressed.SetNum(CompressedSize, false);
+
+	FScopeLock Lock(&GLock);
+	FEntry& Entry = GEntries.FindOrAdd(MakeKey(Filename, Offset));
+	GTotalBytes -= Entry.CompressedPayload.Num();
+	Entry.CompressedPayload = MoveTemp(Compressed);
+	Entry.UncompressedSize = PayloadSize;
+	Entry.LastUsed = ++GAccessCounter;
+	GTotalBytes += Entry.CompressedPayload.Num();
+
+	while (GTotalBytes > BudgetBytes && GEntries.Num())
+	{
+		uint64 OldestAccess = MAX_uint64;
+		FString OldestKey;
+		for (const TPair<FString, FEntry>& Pair : GEntries)
+		{
+			if (Pair.Value.LastUsed < OldestAccess)
+			{
+				OldestAccess = Pair.Value.LastUsed;
+				OldestKey = Pair.Key;
+			}
+		}
+		GTotalBytes -= GEntries.FindChecked(OldestKey).CompressedPayload.Num();
+		GEntries.Remove(OldestKey);
+	}
+}
+
+/** Serves a payload from the cache if present, removing it (the caller now owns a live copy again). */
+static bool Get(const FString& Filename, int64 Offset, int64 ExpectedSize, void* Dest)
+{
+	if (GBulkDataRecycleCacheMB <= 0)
+	{
+		return false;
+	}
+	FScopeLock Lock(&GLock);
+	const FString Key = MakeKey(Filename, Offset);
+	FEntry* Entry = GEntries.Find(Key);
+	if (!Entry || Entry->UncompressedSize != ExpectedSize)
+	{
+		return false;
+	}
+	const bool bOk = FCompression::UncompressMemory(NAME_Zlib, Dest, (int32)ExpectedSize, Entry->CompressedPayload.GetData(), Entry->CompressedPayload.Num());
+	GTotalBytes -= Entry->CompressedPayload.Num();
+	GEntries.Remove(Key);
+	return bOk;
+}
+
+} // namespace BulkDataRecycleCache
+
+/** Stashes the current payload in the recycle cache when this bulk data could reload it from disk later. */
+void FUntypedBulkData::TryRecyclePayload() const
+{
+	if (GBulkDataRecycleCacheMB > 0 && BulkData && CanLoadFromDisk() && !Filename.IsEmpty() && GetBulkDataSize() > 0)
+	{
+		BulkDataRecycleCache::Put(Filename, BulkDataOffsetInFile, BulkData.Get(), GetBulkDataSize());
+	}
+}
+
 bool FUntypedBulkData::CanLoadFromDisk() const
 {
 #if WITH_EDITOR
@@ -636,6 +743,7 @@ void FUntypedBulkData::Unlock() const
 	// Free pointer if we're guaranteed to only to access the data once.
 	if (BulkDataFlags & BULKDATA_SingleUse)
 	{
+		TryRecyclePayload();
 		mutable_this->BulkData.Deallocate();
 	}
 }
@@ -672,6 +780,7 @@ bool FUntypedBulkData::UnloadBulkData()
 	if (LockStatus == LOCKSTATUS_Unlocked)
 	{
 		FlushAsyncLoading();
+		TryRecyclePayload();
 		BulkData.Deallocate();
 		return true;
 	}
@@ -1762,6 +1871,12 @@ void FUntypedBulkData::LoadDataIntoMemory( void* Dest )
 		return;
 	}
 
+	// A recently evicted copy of this payload may still be resident; a decompress beats pak IO
+	if (GBulkDataRecycleCacheMB > 0 && !Filename.IsEmpty() && BulkDataRecycleCache::Get(Filename, BulkDataOffsetInFile, GetBulkDataSize(), Dest))
+	{
+		return;
+	}
+
 #if WITH_EDITOR
 	checkf( AttachedAr, TEXT( "Attempted to load bulk data without an attached archive. Most likely the bulk data was loaded twice on console, which is not supported" ) );
 
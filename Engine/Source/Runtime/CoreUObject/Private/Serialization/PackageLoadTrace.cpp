@@ -0,0 +1,153 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "Serialization/PackageLoadTrace.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/PackageName.h"
+#include "Async/AsyncFileHandle.h"
+#include "HAL/PlatformFilemanager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Logging/LogMacros.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogPackageLoadTrace, Log, All);
+
+namespace PackageLoadTraceInternal
+{
+
+static FCriticalSection GTraceLock;
+static FString GActiveTraceName;
+static TArray<FString> GRecordedPackages;
+static TSet<FString> GRecordedPackageSet;
+static FDelegateHandle GRecordDelegateHandle;
+
+/** Precache requests in flight from a Prefetch call; drained opportunistically on the next Prefetch/EndTrace. */
+struct FPrefetchEntry
+{
+	TUniquePtr<IAsyncReadFileHandle> Handle;
+	TUniquePtr<IAsyncReadRequest> Request;
+};
+static TArray<FPrefetchEntry> GInFlightPrefetches;
+
+static FString TraceFilePath(const FString& TraceName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("LoadTraces") / (TraceName + TEXT(".trace"));
+}
+
+static void DrainCompletedPrefetches()
+{
+	// GTraceLock held
+	for (int32 EntryIndex = GInFlightPrefetches.Num() - 1; EntryIndex >= 0; EntryIndex--)
+	{
+		if (GInFlightPrefetches[EntryIndex].Request->PollCompletion())
+		{
+			GInFlightPrefetches[EntryIndex].Request->WaitCompletion();
+			GInFlightPrefetches.RemoveAtSwap(EntryIndex, 1, false);
+		}
+	}
+}
+
+/** Requests must be complete before destruction; cancel and wait out anything still in flight at exit. */
+static void FlushPrefetchesAtExit()
+{
+	FScopeLock Lock(&GTraceLock);
+	for (FPrefetchEntry& Entry : GInFlightPrefetches)
+	{
+		Entry.Request->Cancel();
+		Entry.Request->WaitCompletion();
+	}
+	GInFlightPrefetches.Empty();
+}
+
+static void OnAsyncLoadPackage(const FString& PackageName)
+{
+	FScopeLock Lock(&GTraceLock);
+	if (!GActiveTraceName.IsEmpty() && !GRecordedPackageSet.Contains(PackageName))
+	{
+		GRecordedPackageSet.Add(PackageName);
+		GRecordedPackages.Add(PackageName);
+	}
+}
+
+} // namespace PackageLoadTraceInternal
+
+void FPackageLoadTrace::BeginTrace(const FString& TraceName)
+{
+	using namespace PackageLoadTraceInternal;
+	FScopeLock Lock(&GTraceLock);
+	if (!GActiveTraceName.IsEmpty())
+	{
+		UE_LOG(LogPackageLoadTrace, Warning, TEXT("BeginTrace('%s') while '%s' is still recording; previous trace discarded"), *TraceName, *GActiveTraceName);
+	}
+	GActiveTraceName = TraceName;
+	GRecordedPackages.Reset();
+	GRecordedPackageSet.Reset();
+	if (!GRecordDelegateHandle.IsValid())
+	{
+		GRecordDelegateHandle = FCoreDelegates::OnAsyncLoadPackage.AddStatic(&OnAsyncLoadPackage);
+	}
+}
+
+void FPackageLoadTrace::EndTrace()
+{
+	using namespace PackageLoadTraceInternal;
+	FScopeLock Lock(&GTraceLock);
+	if (GActiveTraceName.IsEmpty())
+	{
+		return;
+	}
+	const FString FilePath = TraceFilePath(GActiveTraceName);
+	FFileHelper::SaveStringArrayToFile(GRecordedPackages, *FilePath);
+	UE_LOG(LogPackageLoadTrace, Log, TEXT("Saved load trace '%s' with %d packages"), *GActiveTraceName, GRecordedPackages.Num());
+	GActiveTraceName.Reset();
+	GRecordedPackages.Reset();
+	GRecordedPackageSet.Reset();
+	DrainCompletedPrefetches();
+}
+
+int32 FPackageLoadTrace::Prefetch(const FString& TraceName)
+{
+	using namespace PackageLoadTraceInternal;
+
+	TArray<FString> TracedPackages;
+	if (!FFileHelper::LoadFileToStringArray(TracedPackages, *TraceFilePath(TraceName)))
+	{
+		return 0;
+	}
+
+	FScopeLock Lock(&GTraceLock);
+	DrainCompletedPrefetches();
+
+	static bool bExitHookInstalled = false;
+	if (!bExitHookInstalled)
+	{
+		bExitHookInstalled = true;
+		FCoreDelegates::OnPreExit.AddStatic(&FlushPrefetchesAtExit);
+	}
+
+	int32 NumPrefetched = 0;
+	for (const FString& PackageName : TracedPackages)
+	{
+		FString PackageFilename;
+		if (!FPackageName::DoesPackageExist(PackageName, nullptr, &PackageFilename))
+		{
+			continue; // stale trace entry; advisory only
+		}
+		FPrefetchEntry Entry;
+		Entry.Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*PackageFilename));
+		if (!Entry.Handle.IsValid())
+		{
+			continue;
+		}
+		// a precache read never returns memory; the pak precacher absorbs it and schedules by offset
+		Entry.Request.Reset(Entry.Handle->ReadRequest(0, MAX_int64, AIOP_Precache));
+		if (Entry.Request.IsValid())
+		{
+			GInFlightPrefetches.Add(MoveTemp(Entry));
+			NumPrefetched++;
+		}
+	}
+	UE_LOG(LogPackageLoadTrace, Log, TEXT("Prefetching %d packages from load trace '%s'"), NumPrefetched, *TraceName);
+	return NumPrefetched;
+}
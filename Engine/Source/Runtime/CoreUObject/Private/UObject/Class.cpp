@@ -8,6 +8,8 @@
 #include "HAL/ThreadSafeBool.h"
 #include "HAL/LowLevelMemTracker.h"
 #include "Misc/ScopeLock.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 #include "Serialization/MemoryWriter.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/OutputDeviceHelper.h"
@@ -1943,6 +1945,8 @@ UScriptStruct::UScriptStruct( EStaticConstructor, int32 InSize, int32 InAlignmen
 #endif
 	, bPrepareCppStructOpsCompleted(false)
 	, CppStructOps(NULL)
+	, bFastBinaryPlanBuilt(false)
+	, bFastBinaryPlanAllSaveGame(false)
 {
 }
 
@@ -1954,6 +1958,8 @@ UScriptStruct::UScriptStruct(const FObjectInitializer& ObjectInitializer, UScrip
 #endif
 	, bPrepareCppStructOpsCompleted(false)
 	, CppStructOps(InCppStructOps)
+	, bFastBinaryPlanBuilt(false)
+	, bFastBinaryPlanAllSaveGame(false)
 {
 	PrepareCppStructOps(); // propgate flags, etc
 }
@@ -1966,6 +1972,8 @@ UScriptStruct::UScriptStruct(const FObjectInitializer& ObjectInitializer)
 #endif
 	, bPrepareCppStructOpsCompleted(false)
 	, CppStructOps(NULL)
+	, bFastBinaryPlanBuilt(false)
+	, bFastBinaryPlanAllSaveGame(false)
 {
 }
 
@@ -2177,6 +2185,101 @@ bool UScriptStruct::UseBinarySerialization(const FArchive& Ar) const
 		|| (0 != (StructFlags & STRUCT_Immutable));
 }
 
+/** Guards lazy construction of fast binary plans; contention is one-time per struct. */
+static FCriticalSection GFastBinaryPlanLock;
+
+void UScriptStruct::BuildFastBinarySerializationPlan()
+{
+	FScopeLock Lock(&GFastBinaryPlanLock);
+	if (bFastBinaryPlanBuilt)
+	{
+		return;
+	}
+
+	TArray<FFastBinarySerializationStep> NewPlan;
+	bool bAllSaveGame = true;
+
+	for (UProperty* Property = PropertyLink; Property; Property = Property->PropertyLinkNext)
+	{
+		// A property can join a raw run only if its binary serialization is exactly its in-memory bytes
+		// and no archive state can skip it: a plain numeric without a bound enum (enum-bound bytes can
+		// resolve through the linker) or a native bool (bitfields serialize as normalized bytes), and
+		// none of the flags that make ShouldSerializeValue conditional. POD-flagged struct properties
+		// stay off the raw path because a POD struct may still carry a native serializer whose stream
+		// is not its memory image. Everything else serializes itself.
+		const uint64 ConditionalFlags = CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_NonTransactional | CPF_Deprecated | CPF_DevelopmentAssets | CPF_SkipSerialization;
+		bool bRawEligible = false;
+		if (!Property->HasAnyPropertyFlags(ConditionalFlags) && !Property->IsEditorOnlyProperty() && Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			if (UNumericProperty* NumericProperty = Cast<UNumericProperty>(Property))
+			{
+				bRawEligible = NumericProperty->GetIntPropertyEnum() == nullptr;
+			}
+			else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
+			{
+				bRawEligible = BoolProperty->IsNativeBool();
+			}
+		}
+
+		if (bRawEligible)
+		{
+			bAllSaveGame = bAllSaveGame && Property->HasAnyPropertyFlags(CPF_SaveGame);
+			const int32 Offset = Property->GetOffset_ForInternal();
+			const int32 Size = Property->ElementSize * Property->ArrayDim;
+			// merge with the previous raw run only when byte-contiguous, so interior padding never reaches the archive
+			if (NewPlan.Num() && NewPlan.Last().Property == nullptr && NewPlan.Last().Offset + NewPlan.Last().Size == Offset)
+			{
+				NewPlan.Last().Size += Size;
+			}
+			else
+			{
+				NewPlan.Add({ nullptr, Offset, Size });
+			}
+		}
+		else
+		{
+			NewPlan.Add({ Property, 0, 0 });
+		}
+	}
+
+	FastBinaryPlan = MoveTemp(NewPlan);
+	bFastBinaryPlanAllSaveGame = bAllSaveGame;
+	FPlatformMisc::MemoryBarrier();
+	bFastBinaryPlanBuilt = true;
+}
+
+bool UScriptStruct::CanUseFastBinarySerialization(FArchive& Ar) const
+{
+	// the raw runs replay in-memory bytes, so the archive must be a straight native binary stream with
+	// no per-property filtering in play
+	return (Ar.IsLoading() || Ar.IsSaving())
+		&& !Ar.IsTextFormat()
+		&& !Ar.IsByteSwapping()
+		&& !Ar.ArUseCustomPropertyList
+		&& !Ar.IsObjectReferenceCollector()
+		&& Ar.GetPortFlags() == 0
+		&& !Ar.IsCountingMemory()
+		&& !Ar.IsTransacting()
+		&& (!Ar.IsSaveGame() || bFastBinaryPlanAllSaveGame);
+}
+
+void UScriptStruct::SerializeWithFastBinaryPlan(FStructuredArchive::FSlot Slot, void* Value)
+{
+	FArchive& UnderlyingArchive = Slot.GetUnderlyingArchive();
+	FStructuredArchive::FStream PropertyStream = Slot.EnterStream();
+	for (const FFastBinarySerializationStep& Step : FastBinaryPlan)
+	{
+		if (Step.Property)
+		{
+			Step.Property->SerializeBinProperty(PropertyStream.EnterElement(), Value);
+		}
+		else
+		{
+			UnderlyingArchive.Serialize((uint8*)Value + Step.Offset, Step.Size);
+		}
+	}
+}
+
 void UScriptStruct::SerializeItem(FArchive& Ar, void* Value, void const* Defaults)
 {
 	SerializeItem(FStructuredArchiveFromArchive(Ar).GetSlot(), Value, Defaults);
@@ -2234,7 +2337,23 @@ void UScriptStruct::SerializeItem(FStructuredArchive::FSlot Slot, void* Value, v
 			}
 			else
 			{
-				SerializeBin(Slot, Value);
+				bool bUseFastPlan = false;
+				if ((UnderlyingArchive.IsLoading() || UnderlyingArchive.IsSaving()) && !UnderlyingArchive.IsTextFormat())
+				{
+					if (!bFastBinaryPlanBuilt)
+					{
+						BuildFastBinarySerializationPlan();
+					}
+					bUseFastPlan = CanUseFastBinarySerialization(UnderlyingArchive);
+				}
+				if (bUseFastPlan)
+				{
+					SerializeWithFastBinaryPlan(Slot, Value);
+				}
+				else
+				{
+					SerializeBin(Slot, Value);
+				}
 			}
 		}
 		else
@@ -2421,6 +2540,10 @@ void UScriptStruct::ExportText(FString& ValueStr, const void* Value, const void*
 void UScriptStruct::Link(FArchive& Ar, bool bRelinkExistingProperties)
 {
 	Super::Link(Ar, bRelinkExistingProperties);
+
+	// property offsets may have changed; the fast binary plan is rebuilt on next use
+	bFastBinaryPlanBuilt = false;
+	FastBinaryPlan.Empty();
 	if (!HasDefaults()) // if you have CppStructOps, then that is authoritative, otherwise we look at the properties
 	{
 		StructFlags = EStructFlags(StructFlags | STRUCT_ZeroConstructor | STRUCT_NoDestructor | STRUCT_IsPlainOldData);
@@ -3451,6 +3574,55 @@ void UClass::Link(FArchive& Ar, bool bRelinkExistingProperties)
 {
 	check(!bRelinkExistingProperties || !(ClassFlags & CLASS_Intrinsic));
 	Super::Link(Ar, bRelinkExistingProperties);
+
+	// property offsets may have changed; the template init plan is rebuilt on next use
+	bTemplateInitPlanBuilt = false;
+	TemplateInitPlan.Empty();
+}
+
+/** Guards lazy construction of template init plans; contention is one-time per class. */
+static FCriticalSection GTemplateInitPlanLock;
+
+void UClass::BuildTemplateInitPlan()
+{
+	FScopeLock Lock(&GTemplateInitPlanLock);
+	if (bTemplateInitPlanBuilt)
+	{
+		return;
+	}
+
+	TArray<FTemplateInitStep> NewPlan;
+	for (UProperty* P = PropertyLink; P; P = P->PropertyLinkNext)
+	{
+		// mirror of the template-copy filter in FObjectInitializer::InitProperties
+		const bool bIsTransient = P->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient);
+		if (bIsTransient && P->ContainsInstancedObjectProperty())
+		{
+			continue;
+		}
+		// plain-old-data properties copy as raw bytes; adjacent ones collapse into one span
+		if (P->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			const int32 Offset = P->GetOffset_ForInternal();
+			const int32 Size = P->ElementSize * P->ArrayDim;
+			if (NewPlan.Num() && NewPlan.Last().Property == nullptr && NewPlan.Last().Offset + NewPlan.Last().Size == Offset)
+			{
+				NewPlan.Last().Size += Size;
+			}
+			else
+			{
+				NewPlan.Add({ nullptr, Offset, Size });
+			}
+		}
+		else
+		{
+			NewPlan.Add({ P, 0, 0 });
+		}
+	}
+
+	TemplateInitPlan = MoveTemp(NewPlan);
+	FPlatformMisc::MemoryBarrier();
+	bTemplateInitPlanBuilt = true;
 }
 
 #if (UE_BUILD_SHIPPING)
@@ -4546,6 +4718,14 @@ UFunction* UClass::FindFunctionByName(FName InName, EIncludeSuperFlag::Type Incl
 void UClass::AssembleReferenceTokenStreams()
 {
 	SCOPED_BOOT_TIMING("AssembleReferenceTokenStreams (can be optimized)");
+
+	// With -LazyGCTokenStreams, token streams assemble on first use inside the collector instead of
+	// here, taking a large serial chunk out of cold boot; the flag also makes per-class assembly take
+	// its lock for native classes so GC workers can race on the same class safely. CDO creation below
+	// still runs either way, other systems rely on it.
+	static const bool bLazyTokenStreams = FParse::Param(FCommandLine::Get(), TEXT("LazyGCTokenStreams"));
+	GLazyAssembleGCTokenStreams = bLazyTokenStreams;
+
 	// Iterate over all class objects and force the default objects to be created. Additionally also
 	// assembles the token reference stream at this point. This is required for class objects that are
 	// not taken into account for garbage collection but have instances that are.
@@ -4560,7 +4740,7 @@ void UClass::AssembleReferenceTokenStreams()
 				Class->GetDefaultObject(); // Force the default object to be constructed if it isn't already
 			}
 			// Assemble reference token stream for garbage collection/ RTGC.
-			if (!Class->HasAnyFlags(RF_ClassDefaultObject) && !Class->HasAnyClassFlags(CLASS_TokenStreamAssembled))
+			if (!bLazyTokenStreams && !Class->HasAnyFlags(RF_ClassDefaultObject) && !Class->HasAnyClassFlags(CLASS_TokenStreamAssembled))
 			{
 				Class->AssembleReferenceTokenStream();
 			}
@@ -1217,18 +1217,50 @@ public:
 #endif
 	}
 
+	/**
+	 * One slice of a time-sliced reachability analysis. The first call (null InOutSliceState) seeds the
+	 * work list and runs the unreachable-flagging mark phase in full; every call then traverses under
+	 * the time budget. Returns true once the work list has drained; the caller owns completion (folding
+	 * in write-barrier arrivals, tracing external roots, returning the state to the pool).
+	 */
+	bool PerformReachabilityAnalysisSlice(EObjectFlags KeepFlags, double TimeLimitSeconds, FGCArrayStruct*& InOutSliceState)
+	{
+		LLM_SCOPE(ELLMTag::GC);
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRealtimeGC::PerformReachabilityAnalysisSlice"), STAT_FArchiveRealtimeGC_PerformReachabilityAnalysisSlice, STATGROUP_GC);
+
+		if (!InOutSliceState)
+		{
+			InOutSliceState = FGCArrayPool::Get().GetArrayStructFromPool();
+			TArray<UObject*>& ObjectsToSerialize = InOutSliceState->ObjectsToSerialize;
+
+			GObjectCountDuringLastMarkPhase.Reset();
+
+			if (FPlatformProperties::RequiresCookedData() && FGCObject::GGCObjectReferencer && GUObjectArray.IsDisregardForGC(FGCObject::GGCObjectReferencer))
+			{
+				ObjectsToSerialize.Add(FGCObject::GGCObjectReferencer);
+			}
+
+			// the flagging pass runs in full on the first slice; only the traversal is sliced
+			MarkObjectsAsUnreachable(ObjectsToSerialize, KeepFlags, false);
+		}
+
+		FGCReferenceProcessorSinglethreaded ReferenceProcessor;
+		TFastReferenceCollector<false, FGCReferenceProcessorSinglethreaded, FGCCollectorSinglethreaded, FGCArrayPool, true> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get());
+		return ReferenceCollector.CollectReferencesTimeSliced(*InOutSliceState, TimeLimitSeconds);
+	}
+
 	virtual void PerformReachabilityAnalysisOnObjects(FGCArrayStruct* ArrayStruct, bool bForceSingleThreaded) override
 	{
 		if (!bForceSingleThreaded)
 		{
 			FGCReferenceProcessorMultithreaded ReferenceProcessor;
-			TFastReferenceCollector<true, FGCReferenceProcessorMultithreaded, FGCCollectorMultithreaded, FGCArrayPool> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get());
+			TFastReferenceCollector<true, FGCReferenceProcessorMultithreaded, FGCCollectorMultithreaded, FGCArrayPool, true> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get());
 			ReferenceCollector.CollectReferences(*ArrayStruct);
 		}
 		else
 		{
 			FGCReferenceProcessorSinglethreaded ReferenceProcessor;
-			TFastReferenceCollector<false, FGCReferenceProcessorSinglethreaded, FGCCollectorSinglethreaded, FGCArrayPool> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get());
+			TFastReferenceCollector<false, FGCReferenceProcessorSinglethreaded, FGCCollectorSinglethreaded, FGCArrayPool, true> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get());
 			ReferenceCollector.CollectReferences(*ArrayStruct);
 		}
 	}
@@ -1237,6 +1269,55 @@ public:
 // Allow parallel GC to be overridden to single threaded via console command.
 static int32 GAllowParallelGC = 1;
 
+/** If set, non-full-purge garbage collections spread reachability analysis over multiple frames (see GCIncrementalReachabilityWriteBarrier for the mutation contract). */
+static int32 GTimeSlicedReachability = 0;
+static FAutoConsoleVariableRef CVarTimeSlicedReachability(
+	TEXT("gc.TimeSlicedReachability"),
+	GTimeSlicedReachability,
+	TEXT("If true, reachability analysis for non-full-purge GCs is spread across frames under gc.TimeSlicedReachabilityTimeLimit. Requires reference mutation to go through reflected setters."),
+	ECVF_Default
+);
+
+static float GTimeSlicedReachabilityTimeLimit = 0.002f;
+static FAutoConsoleVariableRef CVarTimeSlicedReachabilityTimeLimit(
+	TEXT("gc.TimeSlicedReachabilityTimeLimit"),
+	GTimeSlicedReachabilityTimeLimit,
+	TEXT("Per-frame budget in seconds for time-sliced reachability analysis."),
+	ECVF_Default
+);
+
+bool GIsIncrementalReachabilityPending = false;
+
+bool GLazyAssembleGCTokenStreams = false;
+
+/** If set, cluster assumption verification is budgeted and round-robins across collections instead of verifying every cluster each GC. */
+static int32 GIncrementalClusterVerification = 0;
+static FAutoConsoleVariableRef CVarIncrementalClusterVerification(
+	TEXT("gc.IncrementalClusterVerification"),
+	GIncrementalClusterVerification,
+	TEXT("If true, verify a time-budgeted subset of GC clusters per collection, resuming round-robin at the next one."),
+	ECVF_Default
+);
+
+/** Work list carried between reachability slices; allocated from the GC array pool for the cycle's duration. */
+static FGCArrayStruct* GReachabilitySliceState = nullptr;
+/** Keep flags the in-flight cycle was started with, for the external-roots trace at completion. */
+static EObjectFlags GReachabilitySliceKeepFlags = RF_NoFlags;
+/** Objects re-marked by the write barrier since the last slice; drained into the work list each slice. */
+static TLockFreePointerListUnordered<UObjectBase, PLATFORM_CACHE_LINE_SIZE> GReachabilityBarrierObjects;
+
+void GCIncrementalReachabilityWriteBarrier(const UObjectBase* ReferencedObject)
+{
+	if (GIsIncrementalReachabilityPending && ReferencedObject)
+	{
+		FUObjectItem* ObjectItem = GUObjectArray.ObjectToObjectItem(const_cast<UObjectBase*>(ReferencedObject));
+		if (ObjectItem && ObjectItem->IsUnreachable() && ObjectItem->ThisThreadAtomicallyClearedRFUnreachable())
+		{
+			GReachabilityBarrierObjects.Push(const_cast<UObjectBase*>(ReferencedObject));
+		}
+	}
+}
+
 static FAutoConsoleVariableRef CVarAllowParallelGC(
 	TEXT("gc.AllowParallelGC"),
 	GAllowParallelGC,
@@ -1244,6 +1325,61 @@ static FAutoConsoleVariableRef CVarAllowParallelGC(
 	ECVF_Default
 );
 
+/**
+ * Runs one reachability slice of an in-flight time-sliced cycle, folding in objects re-marked by the
+ * write barrier. Returns true when the whole cycle has completed. Caller must hold the GC lock.
+ */
+static bool PerformIncrementalReachabilitySlice(double TimeLimitSeconds)
+{
+	const double SliceEndSeconds = FPlatformTime::Seconds() + TimeLimitSeconds;
+	FRealtimeGC TagUsedRealtimeGC;
+	while (true)
+	{
+		const double Remaining = SliceEndSeconds - FPlatformTime::Seconds();
+		if (!TagUsedRealtimeGC.PerformReachabilityAnalysisSlice(GReachabilitySliceKeepFlags, FMath::Max(Remaining, 0.0), GReachabilitySliceState))
+		{
+			return false;
+		}
+
+		// the work list drained; anything the write barrier re-marked since the last drain still needs its children scanned
+		bool bAnyBarrierObjects = false;
+		while (UObjectBase* BarrierObject = GReachabilityBarrierObjects.Pop())
+		{
+			GReachabilitySliceState->ObjectsToSerialize.Add(static_cast<UObject*>(BarrierObject));
+			bAnyBarrierObjects = true;
+		}
+		if (!bAnyBarrierObjects)
+		{
+			break;
+		}
+		if (FPlatformTime::Seconds() >= SliceEndSeconds)
+		{
+			return false;
+		}
+	}
+
+	// cycle complete: external roots trace synchronously as the final re-mark
+	FCoreUObjectDelegates::TraceExternalRootsForReachabilityAnalysis.Broadcast(TagUsedRealtimeGC, GReachabilitySliceKeepFlags, true);
+	FGCArrayPool::Get().ReturnToPool(GReachabilitySliceState);
+	GReachabilitySliceState = nullptr;
+	return true;
+}
+
+/** Discards an in-flight time-sliced reachability cycle; safe because the next mark phase recomputes all flags. */
+static void AbandonIncrementalReachability()
+{
+	if (GReachabilitySliceState)
+	{
+		GReachabilitySliceState->ObjectsToSerialize.Reset();
+		FGCArrayPool::Get().ReturnToPool(GReachabilitySliceState);
+		GReachabilitySliceState = nullptr;
+	}
+	while (GReachabilityBarrierObjects.Pop())
+	{
+	}
+	GIsIncrementalReachabilityPending = false;
+}
+
 /** Returns true if Garbage Collection should be forced to run on a single thread */
 static bool ShouldForceSingleThreadedGC()
 {
@@ -1311,6 +1447,32 @@ void IncrementalPurgeGarbage(bool bUseTimeLimit, float TimeLimit)
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("IncrementalPurgeGarbage"), STAT_IncrementalPurgeGarbage, STATGROUP_GC);
 	CSV_SCOPED_TIMING_STAT_EXCLUSIVE(GarbageCollection);
 
+	// Continue an in-flight time-sliced reachability cycle before any purge work; nothing can be
+	// purged until the unreachable set is final.
+	if (GIsIncrementalReachabilityPending)
+	{
+		AcquireGCLock();
+		{
+			FGCScopeLock GCLock;
+			// async loading writes references through the linker, outside the write barrier; when it is
+			// active, close the hazard window by finishing the cycle in one go
+			const bool bRunToCompletion = !bUseTimeLimit || IsAsyncLoading();
+			if (PerformIncrementalReachabilitySlice(bRunToCompletion ? MAX_flt : GTimeSlicedReachabilityTimeLimit))
+			{
+				GIsIncrementalReachabilityPending = false;
+				PostReachabilityAnalysisCleanup(false, true);
+			}
+		}
+		ReleaseGCLock();
+		if (GIsIncrementalReachabilityPending)
+		{
+			return; // nothing purgeable until the unreachable set is final
+		}
+		FCoreUObjectDelegates::GetPostGarbageCollect().Broadcast();
+		// fall through: the completed cycle set GObjPurgeIsRequired, and unbounded callers (exit purge)
+		// expect the purge to happen in this same call
+	}
+
 	if (GExitPurge)
 	{
 		GObjPurgeIsRequired = true;
@@ -1673,7 +1835,7 @@ bool IncrementalDestroyGarbage(bool bUseTimeLimit, float TimeLimit)
  */
 bool IsIncrementalPurgePending()
 {
-	return GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired;
+	return GIsIncrementalReachabilityPending || GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired;
 }
 
 
@@ -1785,6 +1947,57 @@ void GatherUnreachableObjects(bool bForceSingleThreaded)
  * @param	KeepFlags			objects with those flags will be kept regardless of being referenced or not
  * @param	bPerformFullPurge	if true, perform a full purge after the mark pass
  */
+/**
+ * Everything that runs after reachability analysis has determined the unreachable set: cluster
+ * dissolution, unreachable gathering, unhashing and kicking the purge. Shared by the synchronous
+ * collection path and the completion of a time-sliced reachability cycle.
+ */
+static void PostReachabilityAnalysisCleanup(bool bPerformFullPurge, bool bForceSingleThreadedGC)
+{
+	// Reconstruct clusters if needed
+	if (GUObjectClusters.ClustersNeedDissolving())
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		GUObjectClusters.DissolveClusters();
+		UE_LOG(LogGarbage, Log, TEXT("%f ms for dissolving GC clusters"), (FPlatformTime::Seconds() - StartTime) * 1000);
+	}
+
+	// Fire post-reachability analysis hooks
+	FCoreUObjectDelegates::PostReachabilityAnalysis.Broadcast();
+
+	{
+		FGCArrayPool::Get().ClearWeakReferences(bPerformFullPurge);
+
+		GatherUnreachableObjects(bForceSingleThreadedGC);
+
+		if (bPerformFullPurge || !GIncrementalBeginDestroyEnabled)
+		{
+			UnhashUnreachableObjects(/**bUseTimeLimit = */ false);
+			FScopedCBDProfile::DumpProfile();
+		}
+	}
+
+	// Set flag to indicate that we are relying on a purge to be performed.
+	GObjPurgeIsRequired = true;
+
+	// Perform a full purge by not using a time limit for the incremental purge. The Editor always does a full purge.
+	if (bPerformFullPurge || GIsEditor)
+	{
+		IncrementalPurgeGarbage(false);
+	}
+
+	if (bPerformFullPurge)
+	{
+		ShrinkUObjectHashTables();
+	}
+
+	// Destroy all pending delete linkers
+	DeleteLoaders();
+
+	// Trim allocator memory
+	FMemory::Trim();
+}
+
 void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 {
 	SCOPE_TIME_GUARD(TEXT("Collect Garbage"));
@@ -1850,7 +2063,14 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 			DECLARE_SCOPE_CYCLE_COUNTER(TEXT("CollectGarbageInternal.VerifyGCAssumptions"), STAT_CollectGarbageInternal_VerifyGCAssumptions, STATGROUP_GC);
 			const double StartTime = FPlatformTime::Seconds();
 			VerifyGCAssumptions();
-			VerifyClustersAssumptions();
+			if (GIncrementalClusterVerification)
+			{
+				VerifyClustersAssumptionsIncremental(0.001);
+			}
+			else
+			{
+				VerifyClustersAssumptions();
+			}
 			UE_LOG(LogGarbage, Log, TEXT("%f ms for Verify GC Assumptions"), (FPlatformTime::Seconds() - StartTime) * 1000);
 		}
 #endif
@@ -1860,60 +2080,46 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 		// Temporarily forcing single-threaded GC in the editor until Modify() can be safely removed from HandleObjectReference.
 		const bool bForceSingleThreadedGC = ShouldForceSingleThreadedGC();
 
-		// Perform reachability analysis.
+		// A forced collection while a time-sliced cycle is in flight abandons the cycle; the mark phase
+		// below recomputes every flag from scratch, so discarding the partial state is sound.
+		if (GIsIncrementalReachabilityPending)
 		{
-			const double StartTime = FPlatformTime::Seconds();
-			FRealtimeGC TagUsedRealtimeGC;
-			TagUsedRealtimeGC.PerformReachabilityAnalysis(KeepFlags, bForceSingleThreadedGC);
-			UE_LOG(LogGarbage, Log, TEXT("%f ms for GC"), (FPlatformTime::Seconds() - StartTime) * 1000);
+			AbandonIncrementalReachability();
 		}
 
-		// Reconstruct clusters if needed
-		if (GUObjectClusters.ClustersNeedDissolving())
+		// Perform reachability analysis.
+		if (GTimeSlicedReachability && !bPerformFullPurge && !GIsEditor)
 		{
+			// First slice runs here (including the full flagging pass); the remainder continues from
+			// IncrementalPurgeGarbage's per-frame tick until the cycle completes.
 			const double StartTime = FPlatformTime::Seconds();
-			GUObjectClusters.DissolveClusters();
-			UE_LOG(LogGarbage, Log, TEXT("%f ms for dissolving GC clusters"), (FPlatformTime::Seconds() - StartTime) * 1000);
-		}
-
-		// Fire post-reachability analysis hooks
-		FCoreUObjectDelegates::PostReachabilityAnalysis.Broadcast();
-
-		{
-			FGCArrayPool::Get().ClearWeakReferences(bPerformFullPurge);
-
-			GatherUnreachableObjects(bForceSingleThreadedGC);
-
-			if (bPerformFullPurge || !GIncrementalBeginDestroyEnabled)
+			GReachabilitySliceKeepFlags = KeepFlags;
+			GIsIncrementalReachabilityPending = true;
+			if (PerformIncrementalReachabilitySlice(GTimeSlicedReachabilityTimeLimit))
 			{
-				UnhashUnreachableObjects(/**bUseTimeLimit = */ false);
-				FScopedCBDProfile::DumpProfile();
+				GIsIncrementalReachabilityPending = false;
 			}
+			UE_LOG(LogGarbage, Log, TEXT("%f ms for GC reachability slice (%s)"), (FPlatformTime::Seconds() - StartTime) * 1000, GIsIncrementalReachabilityPending ? TEXT("continuing next frame") : TEXT("completed"));
 		}
-
-		// Set flag to indicate that we are relying on a purge to be performed.
-		GObjPurgeIsRequired = true;
-
-		// Perform a full purge by not using a time limit for the incremental purge. The Editor always does a full purge.
-		if (bPerformFullPurge || GIsEditor)
+		else
 		{
-			IncrementalPurgeGarbage(false);
+			const double StartTime = FPlatformTime::Seconds();
+			FRealtimeGC TagUsedRealtimeGC;
+			TagUsedRealtimeGC.PerformReachabilityAnalysis(KeepFlags, bForceSingleThreadedGC);
+			UE_LOG(LogGarbage, Log, TEXT("%f ms for GC"), (FPlatformTime::Seconds() - StartTime) * 1000);
 		}
 
-		if (bPerformFullPurge)
+		if (!GIsIncrementalReachabilityPending)
 		{
-			ShrinkUObjectHashTables();
+			PostReachabilityAnalysisCleanup(bPerformFullPurge, bForceSingleThreadedGC);
 		}
-
-		// Destroy all pending delete linkers
-		DeleteLoaders();
-
-		// Trim allocator memory
-		FMemory::Trim();
 	}
 
-	// Route callbacks to verify GC assumptions
-	FCoreUObjectDelegates::GetPostGarbageCollect().Broadcast();
+	// Route callbacks to verify GC assumptions; deferred to cycle completion when reachability is still in flight
+	if (!GIsIncrementalReachabilityPending)
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Broadcast();
+	}
 
 	STAT_ADD_CUSTOMMESSAGE_NAME( STAT_NamedMarker, TEXT( "GarbageCollection - End" ) );
 }
@@ -2462,8 +2668,8 @@ struct FScopeLockIfNotNative
 
 void UClass::AssembleReferenceTokenStream(bool bForce)
 {
-	// Lock for non-native classes
-	FScopeLockIfNotNative ReferenceTokenStreamLock(ReferenceTokenStreamCritical, !(ClassFlags & CLASS_Native));
+	// Lock for non-native classes; with lazy boot assembly, GC workers can race on native classes too
+	FScopeLockIfNotNative ReferenceTokenStreamLock(ReferenceTokenStreamCritical, !(ClassFlags & CLASS_Native) || GLazyAssembleGCTokenStreams);
 
 	UE_CLOG(!IsInGameThread() && !IsGarbageCollectionLocked(), LogGarbage, Fatal, TEXT("AssembleReferenceTokenStream for %s called on a non-game thread while GC is not locked."), *GetFullName());
 
@@ -2526,6 +2732,8 @@ void UClass::AssembleReferenceTokenStream(bool bForce)
 		ReferenceTokenStream.Shrink();
 
 		check(!HasAnyClassFlags(CLASS_TokenStreamAssembled)); // recursion here is probably bad
+		// publish the stream before the flag; lock-free readers in the parallel collector check the flag first
+		FPlatformMisc::MemoryBarrier();
 		ClassFlags |= CLASS_TokenStreamAssembled;
 	}
 }
@@ -2538,6 +2746,7 @@ void UClass::AssembleReferenceTokenStream(bool bForce)
  */
 void FGCReferenceTokenStream::PrependStream( const FGCReferenceTokenStream& Other )
 {
+	BreakObjectRun();
 	// Remove embedded EOS token if needed.
 	TArray<uint32> TempTokens = Other.Tokens;
 	FGCReferenceInfo EndOfStream( GCRT_EndOfStream, 0 );
@@ -2597,6 +2806,12 @@ void FGCReferenceTokenStream::ReplaceOrAddAddReferencedObjectsCall(void (*AddRef
 				TokenIndex += GNumTokensPerPointer;
 			}
 			break;
+		case GCRT_ObjectRun:
+			{
+				// Skip count
+				TokenIndex += 1;
+			}
+			break;
 		case GCRT_None:
 		case GCRT_Object:
 		case GCRT_PersistentObject:
@@ -2617,6 +2832,35 @@ void FGCReferenceTokenStream::ReplaceOrAddAddReferencedObjectsCall(void (*AddRef
 
 int32 FGCReferenceTokenStream::EmitReferenceInfo(FGCReferenceInfo ReferenceInfo)
 {
+	// Merge adjacent plain object references into GCRT_ObjectRun tokens: one dispatch plus a tight
+	// pointer loop at collection time instead of one switch round trip per reference.
+	if (ReferenceInfo.Type == GCRT_Object && ReferenceInfo.ReturnCount == 0)
+	{
+		if (OpenRunInfoIndex != INDEX_NONE && ReferenceInfo.Offset == OpenRunNextOffset)
+		{
+			FGCReferenceInfo RunInfo(Tokens[OpenRunInfoIndex]);
+			if (RunInfo.Type == GCRT_Object)
+			{
+				// second reference of the run: upgrade the token and append its count word
+				check(OpenRunInfoIndex == Tokens.Num() - 1);
+				RunInfo.Type = GCRT_ObjectRun;
+				Tokens[OpenRunInfoIndex] = RunInfo;
+				Tokens.Add(2);
+			}
+			else
+			{
+				check(RunInfo.Type == GCRT_ObjectRun && OpenRunInfoIndex == Tokens.Num() - 2);
+				Tokens[OpenRunInfoIndex + 1]++;
+			}
+			OpenRunNextOffset += sizeof(void*);
+			return OpenRunInfoIndex;
+		}
+		const int32 TokenIndex = Tokens.Add(ReferenceInfo);
+		OpenRunInfoIndex = TokenIndex;
+		OpenRunNextOffset = ReferenceInfo.Offset + sizeof(void*);
+		return TokenIndex;
+	}
+	BreakObjectRun();
 	return Tokens.Add(ReferenceInfo);
 }
 
@@ -2627,6 +2871,7 @@ int32 FGCReferenceTokenStream::EmitReferenceInfo(FGCReferenceInfo ReferenceInfo)
  */
 uint32 FGCReferenceTokenStream::EmitSkipIndexPlaceholder()
 {
+	BreakObjectRun();
 	return Tokens.Add( E_GCSkipIndexPlaceholder );
 }
 
@@ -2660,11 +2905,13 @@ void FGCReferenceTokenStream::UpdateSkipIndexPlaceholder( uint32 SkipIndexIndex,
  */
 void FGCReferenceTokenStream::EmitCount( uint32 Count )
 {
+	BreakObjectRun();
 	Tokens.Add( Count );
 }
 
 void FGCReferenceTokenStream::EmitPointer( void const* Ptr )
 {
+	BreakObjectRun();
 	const int32 StoreIndex = Tokens.Num();
 	Tokens.AddUninitialized(GNumTokensPerPointer);
 	StorePointer(&Tokens[StoreIndex], Ptr);
@@ -2680,6 +2927,7 @@ void FGCReferenceTokenStream::EmitPointer( void const* Ptr )
  */
 void FGCReferenceTokenStream::EmitStride( uint32 Stride )
 {
+	BreakObjectRun();
 	Tokens.Add( Stride );
 }
 
@@ -2690,6 +2938,15 @@ void FGCReferenceTokenStream::EmitStride( uint32 Stride )
  */
 uint32 FGCReferenceTokenStream::EmitReturn()
 {
+	if (OpenRunInfoIndex != INDEX_NONE && OpenRunInfoIndex == Tokens.Num() - 2)
+	{
+		// The stream ends with a run's count word, which cannot carry return counts (skip-index handling
+		// reads the last word as an info token). Append an end-of-pointer style carrier, the same trick
+		// EmitPointer uses for raw pointer words.
+		check(FGCReferenceInfo(Tokens[OpenRunInfoIndex]).Type == GCRT_ObjectRun);
+		Tokens.Add(FGCReferenceInfo(GCRT_EndOfPointer, 0));
+	}
+	BreakObjectRun();
 	FGCReferenceInfo ReferenceInfo = Tokens.Last();
 	check(ReferenceInfo.Type != GCRT_None);
 	ReferenceInfo.ReturnCount++;
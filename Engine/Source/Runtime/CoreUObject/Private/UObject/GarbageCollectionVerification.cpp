@@ -275,6 +275,58 @@ public:
 };
 typedef TDefaultReferenceCollector<FClusterVerifyReferenceProcessor> FClusterVerifyReferenceCollector;
 
+void VerifyClustersAssumptionsIncremental(double TimeLimitSeconds)
+{
+	static int32 ClusterVerificationCursor = 0;
+
+	const double EndTimeSeconds = FPlatformTime::Seconds() + TimeLimitSeconds;
+	const int32 MaxNumberOfClusters = GUObjectClusters.GetClustersUnsafe().Num();
+	if (!MaxNumberOfClusters)
+	{
+		return;
+	}
+	// the cluster array can shrink between collections
+	ClusterVerificationCursor = ClusterVerificationCursor % MaxNumberOfClusters;
+
+	FGCArrayStruct ArrayStruct;
+	int32 NumErrors = 0;
+	int32 NumVerified = 0;
+
+	FClusterVerifyReferenceProcessor Processor;
+	TFastReferenceCollector<false, FClusterVerifyReferenceProcessor, FClusterVerifyReferenceCollector, FGCArrayPool, true> ReferenceCollector(Processor, FGCArrayPool::Get());
+
+	while (NumVerified < MaxNumberOfClusters && FPlatformTime::Seconds() < EndTimeSeconds)
+	{
+		const int32 ClusterIndex = ClusterVerificationCursor;
+		ClusterVerificationCursor = (ClusterVerificationCursor + 1) % MaxNumberOfClusters;
+		NumVerified++;
+
+		FUObjectCluster& Cluster = GUObjectClusters.GetClustersUnsafe()[ClusterIndex];
+		if (Cluster.RootIndex >= 0 && Cluster.Objects.Num())
+		{
+			ArrayStruct.ObjectsToSerialize.Reset();
+			ArrayStruct.ObjectsToSerialize.Reserve(Cluster.Objects.Num() + 1);
+			{
+				FUObjectItem* RootItem = GUObjectArray.IndexToObject(Cluster.RootIndex);
+				check(RootItem);
+				check(RootItem->Object);
+				ArrayStruct.ObjectsToSerialize.Add(static_cast<UObject*>(RootItem->Object));
+			}
+			for (int32 ObjectIndex : Cluster.Objects)
+			{
+				FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(ObjectIndex);
+				check(ObjectItem);
+				check(ObjectItem->Object);
+				ArrayStruct.ObjectsToSerialize.Add(static_cast<UObject*>(ObjectItem->Object));
+			}
+			ReferenceCollector.CollectReferences(ArrayStruct);
+			NumErrors += Processor.GetErrorCount();
+		}
+	}
+
+	UE_CLOG(NumErrors > 0, LogGarbage, Fatal, TEXT("Encountered %d object(s) breaking GC Clusters assumptions. Please check log for details."), NumErrors);
+}
+
 void VerifyClustersAssumptions()
 {
 	int32 MaxNumberOfClusters = GUObjectClusters.GetClustersUnsafe().Num();
@@ -22,6 +22,13 @@ void VerifyGCAssumptions();
 /** Verifies GC Cluster assumptions */
 void VerifyClustersAssumptions();
 
+/**
+ * Budgeted cluster verification: verifies clusters round-robin from a persistent cursor until the
+ * time limit passes, so verification cost amortizes across collections instead of scaling with the
+ * total cluster count (which runtime actor clustering makes much larger).
+ */
+void VerifyClustersAssumptionsIncremental(double TimeLimitSeconds);
+
 #endif // VERIFY_DISREGARD_GC_ASSUMPTIONS
 
 
@@ -3346,8 +3346,45 @@ void FLinkerLoad::LoadAllObjects(bool bForcePreload)
 	// Tick the heartbeat if we're loading on the game thread
 	const bool bShouldTickHeartBeat = IsInGameThread();
 
+	// When preloading everything, stream export data ahead of the serialization cursor in windows so
+	// the sequential serialization below overlaps with IO/decompression instead of stalling per
+	// export. Cooked packages lay exports out in serialization order, so a forward window covers the
+	// next run of exports; Precache is a no-op on loaders without async backing.
+	const bool bPrecacheExportWindows = bForcePreload && Loader;
+	const int64 ExportPrecacheWindowBytes = 4 * 1024 * 1024;
+	int32 NextPrecacheExportIndex = 0;
+
 	for(int32 ExportIndex = 0; ExportIndex < ExportMap.Num(); ++ExportIndex)
 	{
+		if (bPrecacheExportWindows && ExportIndex >= NextPrecacheExportIndex)
+		{
+			int64 WindowStart = -1;
+			int64 WindowEnd = -1;
+			int32 WindowEndExportIndex = ExportIndex;
+			for (; WindowEndExportIndex < ExportMap.Num(); ++WindowEndExportIndex)
+			{
+				const FObjectExport& PrecacheExport = ExportMap[WindowEndExportIndex];
+				if (PrecacheExport.SerialSize > 0)
+				{
+					if (WindowStart < 0)
+					{
+						WindowStart = PrecacheExport.SerialOffset;
+					}
+					WindowEnd = PrecacheExport.SerialOffset + PrecacheExport.SerialSize;
+					if (WindowEnd - WindowStart >= ExportPrecacheWindowBytes)
+					{
+						++WindowEndExportIndex;
+						break;
+					}
+				}
+			}
+			if (WindowStart >= 0)
+			{
+				Loader->Precache(WindowStart, WindowEnd - WindowStart);
+			}
+			// refresh at the half-way point so the next window is in flight before this one drains
+			NextPrecacheExportIndex = ExportIndex + FMath::Max(1, (WindowEndExportIndex - ExportIndex) / 2);
+		}
 #if WITH_EDITOR
 		if (SlowTask)
 		{
@@ -0,0 +1,123 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "UObject/ReflectionHandles.h"
+#include "UObject/Class.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectBaseUtility.h"
+#include "Misc/ScopeLock.h"
+
+namespace ReflectionHandlesInternal
+{
+
+/**
+ * Append-only pointer table with stable rows and lock-free reads. Chunks are allocated under the
+ * writer lock and published with a barrier before any handle referencing them is returned, so a
+ * reader holding a valid handle can always index without synchronization.
+ */
+template<typename ObjectType>
+struct TFrozenPointerTable
+{
+	enum
+	{
+		ChunkSizeLog2 = 10,
+		ChunkSize = 1 << ChunkSizeLog2,
+		MaxChunks = 64
+	};
+
+	FCriticalSection WriterLock;
+	TMap<FName, int32> PathToIndex;
+	ObjectType** Chunks[MaxChunks] = { nullptr };
+	int32 NumEntries = 0;
+
+	/** Finds or appends; INDEX_NONE when the object is null or rejected by the filter. Takes the writer lock. */
+	int32 FindOrAdd(const TCHAR* ObjectPathName, ObjectType* Object)
+	{
+		FScopeLock Lock(&WriterLock);
+		const FName PathName(ObjectPathName);
+		if (const int32* Existing = PathToIndex.Find(PathName))
+		{
+			return *Existing;
+		}
+		if (!Object)
+		{
+			return INDEX_NONE;
+		}
+		const int32 Index = NumEntries;
+		const int32 ChunkIndex = Index >> ChunkSizeLog2;
+		if (ChunkIndex >= MaxChunks)
+		{
+			return INDEX_NONE; // table full; fall back to regular lookups
+		}
+		if (!Chunks[ChunkIndex])
+		{
+			ObjectType** NewChunk = (ObjectType**)FMemory::Malloc(sizeof(ObjectType*) * ChunkSize);
+			FMemory::Memzero(NewChunk, sizeof(ObjectType*) * ChunkSize);
+			FPlatformMisc::MemoryBarrier();
+			Chunks[ChunkIndex] = NewChunk;
+		}
+		Chunks[ChunkIndex][Index & (ChunkSize - 1)] = Object;
+		FPlatformMisc::MemoryBarrier();
+		NumEntries = Index + 1;
+		PathToIndex.Add(PathName, Index);
+		return Index;
+	}
+
+	FORCEINLINE ObjectType* Resolve(int32 Index) const
+	{
+		if (Index >= 0 && Index < NumEntries)
+		{
+			return Chunks[Index >> ChunkSizeLog2][Index & (ChunkSize - 1)];
+		}
+		return nullptr;
+	}
+};
+
+static TFrozenPointerTable<UEnum>& GetEnumTable()
+{
+	static TFrozenPointerTable<UEnum> Table;
+	return Table;
+}
+
+static TFrozenPointerTable<UScriptStruct>& GetStructTable()
+{
+	static TFrozenPointerTable<UScriptStruct> Table;
+	return Table;
+}
+
+} // namespace ReflectionHandlesInternal
+
+FReflectionHandleRegistry::FEnumHandle FReflectionHandleRegistry::GetEnumHandle(const TCHAR* EnumPathName)
+{
+	UEnum* Enum = FindObject<UEnum>(nullptr, EnumPathName);
+	if (Enum && !Enum->IsNative())
+	{
+		ensureMsgf(false, TEXT("FReflectionHandleRegistry only accepts native enums; '%s' is not native"), EnumPathName);
+		Enum = nullptr;
+	}
+	FEnumHandle Handle;
+	Handle.Index = ReflectionHandlesInternal::GetEnumTable().FindOrAdd(EnumPathName, Enum);
+	return Handle;
+}
+
+FReflectionHandleRegistry::FStructHandle FReflectionHandleRegistry::GetStructHandle(const TCHAR* StructPathName)
+{
+	UScriptStruct* Struct = FindObject<UScriptStruct>(nullptr, StructPathName);
+	if (Struct && !Struct->IsNative())
+	{
+		ensureMsgf(false, TEXT("FReflectionHandleRegistry only accepts native structs; '%s' is not native"), StructPathName);
+		Struct = nullptr;
+	}
+	FStructHandle Handle;
+	Handle.Index = ReflectionHandlesInternal::GetStructTable().FindOrAdd(StructPathName, Struct);
+	return Handle;
+}
+
+UEnum* FReflectionHandleRegistry::ResolveEnum(FEnumHandle Handle)
+{
+	return ReflectionHandlesInternal::GetEnumTable().Resolve(Handle.Index);
+}
+
+UScriptStruct* FReflectionHandleRegistry::ResolveStruct(FStructHandle Handle)
+{
+	return ReflectionHandlesInternal::GetStructTable().Resolve(Handle.Index);
+}
@@ -420,6 +420,36 @@ UObject* FSoftObjectPath::ResolveObject() const
 	return ResolveObjectInternal();
 }
 
+// Defined in UObjectHash.cpp; takes/releases every object hash table lock.
+void LockUObjectHashTables();
+void UnlockUObjectHashTables();
+
+void FSoftObjectPath::ResolveObjects(const TArrayView<const FSoftObjectPath>& Paths, TArray<UObject*>& OutObjects)
+{
+	OutObjects.Reset();
+	OutObjects.Reserve(Paths.Num());
+
+	// Hold the hash table locks across the batch: the per-path finds re-enter them recursively and
+	// uncontended, so a thousand resolves pay for one contended acquisition instead of a thousand.
+	// PIE resolution can run fixup delegates, which must not execute under the global locks.
+	bool bHoldLocksAcrossBatch = true;
+#if WITH_EDITOR
+	bHoldLocksAcrossBatch = (GPlayInEditorID == INDEX_NONE);
+#endif
+	if (bHoldLocksAcrossBatch)
+	{
+		LockUObjectHashTables();
+	}
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		OutObjects.Add(Path.ResolveObject());
+	}
+	if (bHoldLocksAcrossBatch)
+	{
+		UnlockUObjectHashTables();
+	}
+}
+
 UObject* FSoftObjectPath::ResolveObjectInternal() const
 {
 	if (SubPathString.IsEmpty())
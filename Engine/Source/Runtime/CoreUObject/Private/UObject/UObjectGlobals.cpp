@@ -2980,15 +2980,25 @@ void FObjectInitializer::InitProperties(UObject* Obj, UClass* DefaultsClass, UOb
 			if (Class->GetDefaultObject(false) != DefaultData)
 			{
 				QUICK_SCOPE_CYCLE_COUNTER(STAT_InitProperties_FromTemplate);
-				for (UProperty* P = Class->PropertyLink; P; P = P->PropertyLinkNext)
+				// Replay the class's template init plan: runs of plain-old-data properties become block
+				// copies from the template and only the remaining properties pay a CopyCompleteValue
+				// call. DefaultsClass == Class here (bCanUsePostConstructLink), so the per-property
+				// IsInContainer test the slow loop needed is always true.
+				if (!Class->bTemplateInitPlanBuilt)
 				{
-					bool bIsTransient = P->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient);
-					if (!bIsTransient || !P->ContainsInstancedObjectProperty())
+					Class->BuildTemplateInitPlan();
+				}
+				uint8* ObjBase = (uint8*)Obj;
+				const uint8* DefaultBase = (const uint8*)DefaultData;
+				for (const UClass::FTemplateInitStep& Step : Class->TemplateInitPlan)
+				{
+					if (Step.Property)
 					{
-						if (P->IsInContainer(DefaultsClass))
-						{
-							P->CopyCompleteValue_InContainer(Obj, DefaultData);
-						}
+						Step.Property->CopyCompleteValue_InContainer(Obj, DefaultData);
+					}
+					else
+					{
+						FMemory::Memcpy(ObjBase + Step.Offset, DefaultBase + Step.Offset, Step.Size);
 					}
 				}
 			}
@@ -280,9 +280,28 @@ class FUObjectHashTables
 
 public:
 
-	/** Hash sets */
-	TMap<int32, FHashBucket> Hash;
-	TMultiMap<int32, class UObjectBase*> HashOuter;
+	enum
+	{
+		/** Number of lock shards for the name hash tables; power of two, sized so find/spawn storms across threads rarely collide. */
+		NumNameHashShards = 16,
+		NameHashShardMask = NumNameHashShards - 1
+	};
+
+	/**
+	 * One lock-sharded partition of the FName hash tables. StaticFindObjectFast and Hash/UnhashObject
+	 * pick the shard from the key hash, so lookups and spawns on different names proceed in parallel
+	 * instead of funneling through the single table lock. The outer/class maps (whole-table iteration
+	 * semantics) stay under the main lock.
+	 */
+	struct FNameHashShard
+	{
+		FCriticalSection CriticalSection;
+		TMap<int32, FHashBucket> Hash;
+		TMultiMap<int32, class UObjectBase*> HashOuter;
+	};
+
+	/** Name hash shards, selected by key hash */
+	FNameHashShard NameHashShards[NumNameHashShards];
 
 	/** Map of object to their outers, used to avoid an object iterator to find such things. **/
 	TMap<UObjectBase*, FHashBucket> ObjectOuterMap;
@@ -293,15 +312,23 @@ public:
 	{
 	}
 
+	FORCEINLINE FNameHashShard& GetNameHashShard(int32 KeyHash)
+	{
+		return NameHashShards[uint32(KeyHash) & NameHashShardMask];
+	}
+
 	void ShrinkMaps()
 	{
 		double StartTime = FPlatformTime::Seconds();
-		Hash.Compact();
-		for (auto& Pair : Hash)
+		for (FNameHashShard& Shard : NameHashShards)
 		{
-			Pair.Value.Compact();
+			Shard.Hash.Compact();
+			for (auto& Pair : Shard.Hash)
+			{
+				Pair.Value.Compact();
+			}
+			Shard.HashOuter.Compact();
 		}
-		HashOuter.Compact();
 		ObjectOuterMap.Compact();
 		for (auto& Pair : ObjectOuterMap)
 		{
@@ -320,34 +347,35 @@ public:
 		UE_LOG(LogUObjectHash, Log, TEXT("Compacting FUObjectHashTables data took %6.2fms"), 1000.0f * float(FPlatformTime::Seconds() - StartTime));
 	}
 
-	/** Checks if the Hash/Object pair exists in the FName hash table */
+	/** Checks if the Hash/Object pair exists in the FName hash table. Caller must hold the key's shard lock. */
 	FORCEINLINE bool PairExistsInHash(int32 InHash, UObjectBase* Object)
 	{
 		bool bResult = false;
-		FHashBucket* Bucket = Hash.Find(InHash);
+		FHashBucket* Bucket = GetNameHashShard(InHash).Hash.Find(InHash);
 		if (Bucket)
 		{
 			bResult = Bucket->Contains(Object);
 		}
 		return bResult;
 	}
-	/** Adds the Hash/Object pair to the FName hash table */
+	/** Adds the Hash/Object pair to the FName hash table. Caller must hold the key's shard lock. */
 	FORCEINLINE void AddToHash(int32 InHash, UObjectBase* Object)
 	{
-		FHashBucket& Bucket = Hash.FindOrAdd(InHash);
+		FHashBucket& Bucket = GetNameHashShard(InHash).Hash.FindOrAdd(InHash);
 		Bucket.Add(Object);
 	}
-	/** Removes the Hash/Object pair from the FName hash table */
+	/** Removes the Hash/Object pair from the FName hash table. Caller must hold the key's shard lock. */
 	FORCEINLINE int32 RemoveFromHash(int32 InHash, UObjectBase* Object)
 	{
 		int32 NumRemoved = 0;
-		FHashBucket* Bucket = Hash.Find(InHash);
+		TMap<int32, FHashBucket>& ShardHash = GetNameHashShard(InHash).Hash;
+		FHashBucket* Bucket = ShardHash.Find(InHash);
 		if (Bucket)
 		{
 			NumRemoved = Bucket->Remove(Object);
 			if (Bucket->Num() == 0)
 			{
-				Hash.Remove(InHash);
+				ShardHash.Remove(InHash);
 			}
 		}
 		return NumRemoved;
@@ -363,6 +391,25 @@ public:
 		CriticalSection.Unlock();
 	}
 
+	/** Locks the main lock and every name hash shard, for operations that need a consistent view of everything (GC, stats, shrinking). */
+	void LockAll()
+	{
+		CriticalSection.Lock();
+		for (FNameHashShard& Shard : NameHashShards)
+		{
+			Shard.CriticalSection.Lock();
+		}
+	}
+
+	void UnlockAll()
+	{
+		for (FNameHashShard& Shard : NameHashShards)
+		{
+			Shard.CriticalSection.Unlock();
+		}
+		CriticalSection.Unlock();
+	}
+
 	static FUObjectHashTables& Get()
 	{
 		static FUObjectHashTables Singleton;
@@ -370,6 +417,40 @@ public:
 	}
 };
 
+/** Scoped lock for one name hash shard; same GC-thread exemption as FHashTableLock. */
+class FNameHashShardLock
+{
+#if THREADSAFE_UOBJECTS
+	FUObjectHashTables::FNameHashShard* Shard;
+#endif
+public:
+	FORCEINLINE FNameHashShardLock(FUObjectHashTables& InTables, int32 KeyHash)
+	{
+#if THREADSAFE_UOBJECTS
+		if (!(IsGarbageCollecting() && IsInGameThread()))
+		{
+			Shard = &InTables.GetNameHashShard(KeyHash);
+			Shard->CriticalSection.Lock();
+		}
+		else
+		{
+			Shard = nullptr;
+		}
+#else
+		check(IsInGameThread());
+#endif
+	}
+	FORCEINLINE ~FNameHashShardLock()
+	{
+#if THREADSAFE_UOBJECTS
+		if (Shard)
+		{
+			Shard->CriticalSection.Unlock();
+		}
+#endif
+	}
+};
+
 class FHashTableLock
 {
 #if THREADSAFE_UOBJECTS
@@ -433,8 +514,8 @@ UObject* StaticFindObjectFastExplicitThreadSafe(FUObjectHashTables& ThreadHash,
 
 	// Find an object with the specified name and (optional) class, in any package; if bAnyPackage is false, only matches top-level packages
 	int32 Hash = GetObjectHash(ObjectName);
-	FHashTableLock HashLock(ThreadHash);
-	FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
+	FNameHashShardLock HashLock(ThreadHash, Hash);
+	FHashBucket* Bucket = ThreadHash.GetNameHashShard(Hash).Hash.Find(Hash);
 	if (Bucket)
 	{
 		for (FHashBucketIterator It(*Bucket); It; ++It)
@@ -541,8 +622,8 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 	if (ObjectPackage != nullptr)
 	{
 		int32 Hash = GetObjectOuterHash(ObjectName, (PTRINT)ObjectPackage);
-		FHashTableLock HashLock(ThreadHash);
-		for (TMultiMap<int32, class UObjectBase*>::TConstKeyIterator HashIt(ThreadHash.HashOuter, Hash); HashIt; ++HashIt)
+		FNameHashShardLock HashLock(ThreadHash, Hash);
+		for (TMultiMap<int32, class UObjectBase*>::TConstKeyIterator HashIt(ThreadHash.GetNameHashShard(Hash).HashOuter, Hash); HashIt; ++HashIt)
 		{
 			UObject *Object = (UObject *)HashIt.Value();
 			if
@@ -581,9 +662,9 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 		FObjectSearchPath SearchPath(ObjectName);
 
 		const int32 Hash = GetObjectHash(SearchPath.Inner);
-		FHashTableLock HashLock(ThreadHash);
+		FNameHashShardLock HashLock(ThreadHash, Hash);
 
-		FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
+		FHashBucket* Bucket = ThreadHash.GetNameHashShard(Hash).Hash.Find(Hash);
 		if (Bucket)
 		{
 			for (FHashBucketIterator It(*Bucket); It; ++It)
@@ -734,8 +815,9 @@ FORCEINLINE static void RemoveFromClassMap(FUObjectHashTables& ThreadHash, UObje
 void ShrinkUObjectHashTables()
 {
 	auto& ThreadHash = FUObjectHashTables::Get();
-	FHashTableLock HashLock(ThreadHash);
+	ThreadHash.LockAll();
 	ThreadHash.ShrinkMaps();
+	ThreadHash.UnlockAll();
 }
 
 static void ShrinkUObjectHashTablesDel(const TArray<FString>& Args)
@@ -1033,21 +1115,28 @@ void HashObject(UObjectBase* Object)
 		int32 Hash = 0;
 
 		auto& ThreadHash = FUObjectHashTables::Get();
-		FHashTableLock HashLock(ThreadHash);
 
-		Hash = GetObjectHash(Name);				
-		checkSlow(!ThreadHash.PairExistsInHash(Hash, Object));  // if it already exists, something is wrong with the external code
-		ThreadHash.AddToHash(Hash, Object);
+		Hash = GetObjectHash(Name);
+		{
+			FNameHashShardLock ShardLock(ThreadHash, Hash);
+			checkSlow(!ThreadHash.PairExistsInHash(Hash, Object));  // if it already exists, something is wrong with the external code
+			ThreadHash.AddToHash(Hash, Object);
+		}
 
-		if (PTRINT Outer = (PTRINT)Object->GetOuter())
+		const PTRINT Outer = (PTRINT)Object->GetOuter();
+		if (Outer)
 		{
 			Hash = GetObjectOuterHash(Name, Outer);
-			checkSlow(!ThreadHash.HashOuter.FindPair(Hash, Object));  // if it already exists, something is wrong with the external code
-			ThreadHash.HashOuter.Add(Hash, Object);
+			FNameHashShardLock ShardLock(ThreadHash, Hash);
+			checkSlow(!ThreadHash.GetNameHashShard(Hash).HashOuter.FindPair(Hash, Object));  // if it already exists, something is wrong with the external code
+			ThreadHash.GetNameHashShard(Hash).HashOuter.Add(Hash, Object);
+		}
 
+		FHashTableLock HashLock(ThreadHash);
+		if (Outer)
+		{
 			AddToOuterMap(ThreadHash, Object);
 		}
-
 		AddToClassMap( ThreadHash, Object );
 	}
 }
@@ -1068,21 +1157,28 @@ void UnhashObject(UObjectBase* Object)
 		int32 NumRemoved = 0;
 
 		auto& ThreadHash = FUObjectHashTables::Get();
-		FHashTableLock LockHash(ThreadHash);
 
 		Hash = GetObjectHash(Name);
-		NumRemoved = ThreadHash.RemoveFromHash(Hash, Object);
-		check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+		{
+			FNameHashShardLock ShardLock(ThreadHash, Hash);
+			NumRemoved = ThreadHash.RemoveFromHash(Hash, Object);
+			check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+		}
 
-		if (PTRINT Outer = (PTRINT)Object->GetOuter())
+		const PTRINT Outer = (PTRINT)Object->GetOuter();
+		if (Outer)
 		{
 			Hash = GetObjectOuterHash(Name, Outer);
-			NumRemoved = ThreadHash.HashOuter.RemoveSingle(Hash, Object);
+			FNameHashShardLock ShardLock(ThreadHash, Hash);
+			NumRemoved = ThreadHash.GetNameHashShard(Hash).HashOuter.RemoveSingle(Hash, Object);
 			check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+		}
 
+		FHashTableLock LockHash(ThreadHash);
+		if (Outer)
+		{
 			RemoveFromOuterMap(ThreadHash, Object);
 		}
-
 		RemoveFromClassMap( ThreadHash, Object );
 	}
 }
@@ -1093,7 +1189,7 @@ void UnhashObject(UObjectBase* Object)
 void LockUObjectHashTables()
 {
 #if THREADSAFE_UOBJECTS
-	FUObjectHashTables::Get().Lock();
+	FUObjectHashTables::Get().LockAll();
 #else
 	check(IsInGameThread());
 #endif
@@ -1105,7 +1201,7 @@ void LockUObjectHashTables()
 void UnlockUObjectHashTables()
 {
 #if THREADSAFE_UOBJECTS
-	FUObjectHashTables::Get().Unlock();
+	FUObjectHashTables::Get().UnlockAll();
 #else
 	check(IsInGameThread());
 #endif
@@ -1252,8 +1348,13 @@ void LogHashStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisionInf
 	Ar.Logf(TEXT("Hash efficiency statistics for the Object Hash"));
 	Ar.Logf(TEXT("-------------------------------------------------"));
 	Ar.Logf(TEXT(""));
-	FHashTableLock HashLock(FUObjectHashTables::Get());
-	LogHashStatisticsInternal(FUObjectHashTables::Get().Hash, Ar, bShowHashBucketCollisionInfo);
+	FUObjectHashTables::Get().LockAll();
+	for (int32 ShardIndex = 0; ShardIndex < FUObjectHashTables::NumNameHashShards; ShardIndex++)
+	{
+		Ar.Logf(TEXT("Shard %d:"), ShardIndex);
+		LogHashStatisticsInternal(FUObjectHashTables::Get().NameHashShards[ShardIndex].Hash, Ar, bShowHashBucketCollisionInfo);
+	}
+	FUObjectHashTables::Get().UnlockAll();
 	Ar.Logf(TEXT(""));
 }
 
@@ -1262,14 +1363,22 @@ void LogHashOuterStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisi
 	Ar.Logf(TEXT("Hash efficiency statistics for the Outer Object Hash"));
 	Ar.Logf(TEXT("-------------------------------------------------"));
 	Ar.Logf(TEXT(""));
-	FHashTableLock HashLock(FUObjectHashTables::Get());
-	LogHashStatisticsInternal(FUObjectHashTables::Get().HashOuter, Ar, bShowHashBucketCollisionInfo);
+	FUObjectHashTables::Get().LockAll();
+	for (int32 ShardIndex = 0; ShardIndex < FUObjectHashTables::NumNameHashShards; ShardIndex++)
+	{
+		Ar.Logf(TEXT("Shard %d:"), ShardIndex);
+		LogHashStatisticsInternal(FUObjectHashTables::Get().NameHashShards[ShardIndex].HashOuter, Ar, bShowHashBucketCollisionInfo);
+	}
+	FUObjectHashTables::Get().UnlockAll();
 	Ar.Logf(TEXT(""));
 
 	uint32 HashOuterMapSize = 0;
-	for (TPair<UObjectBase*, FHashBucket>& OuterMapEntry : FUObjectHashTables::Get().ObjectOuterMap)
 	{
-		HashOuterMapSize += OuterMapEntry.Value.GetItemsSize();
+		FHashTableLock HashLock(FUObjectHashTables::Get());
+		for (TPair<UObjectBase*, FHashBucket>& OuterMapEntry : FUObjectHashTables::Get().ObjectOuterMap)
+		{
+			HashOuterMapSize += OuterMapEntry.Value.GetItemsSize();
+		}
 	}
 	Ar.Logf(TEXT("Total memory allocated for Object Outer Map: %u bytes."), HashOuterMapSize);
 	Ar.Logf(TEXT(""));
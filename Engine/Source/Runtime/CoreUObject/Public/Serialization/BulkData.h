@@ -444,6 +444,9 @@ public:
 	 */
 	bool CanLoadFromDisk() const;
 
+	/** Offers the resident payload to the recycle cache before it is deallocated (s.BulkDataRecycleCacheMB). */
+	void TryRecyclePayload() const;
+
 	/**
 	 * Returns flags usable to decompress the bulk data
 	 * 
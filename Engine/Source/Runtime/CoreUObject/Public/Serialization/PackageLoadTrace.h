@@ -0,0 +1,32 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Records the order packages are requested during a load (a level stream-in, a travel) and replays
+ * it as bulk IO precache on later loads of the same content.
+ *
+ * Dependent packages discovered mid-load through import tables otherwise serialize behind their
+ * parents: the loader cannot ask for what it does not yet know it needs. A recorded trace is that
+ * knowledge. BeginTrace/EndTrace bracket a load and save the package request order to
+ * Saved/LoadTraces/<name>.trace; Prefetch replays a saved trace by issuing whole-file precache
+ * reads for every recorded package up front, which the pak precacher then schedules in offset
+ * order, converting the discovery-ordered seek storm into sequential reads ahead of demand.
+ *
+ * Traces are advisory: stale entries (renamed or deleted packages) are skipped, and packages not in
+ * the trace simply load as they always did. Game code owns the trace naming, typically per level.
+ */
+class COREUOBJECT_API FPackageLoadTrace
+{
+public:
+	/** Starts recording the order of async package load requests. Only one trace records at a time. */
+	static void BeginTrace(const FString& TraceName);
+
+	/** Stops recording and saves the trace; no-op if nothing is recording. */
+	static void EndTrace();
+
+	/** Issues precache reads for every package in a saved trace, in recorded order. Returns the number of packages prefetched. */
+	static int32 Prefetch(const FString& TraceName);
+};
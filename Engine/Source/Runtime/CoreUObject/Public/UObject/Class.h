@@ -1409,11 +1409,37 @@ public:
 	friend struct FScriptStructArchiveProxy;
 #endif
 
+	/**
+	 * One step of the fast binary serialization plan: a raw run of plain-old-data property bytes that
+	 * byte-matches what per-property binary serialization would produce (Property == null), or a
+	 * property that must still serialize itself.
+	 */
+	struct FFastBinarySerializationStep
+	{
+		class UProperty* Property;
+		int32 Offset;
+		int32 Size;
+	};
+
 private:
 	/** true if we have performed PrepareCppStructOps **/
 	bool bPrepareCppStructOpsCompleted;
 	/** Holds the Cpp ctors and dtors, sizeof, etc. Is not owned by this and is not released. **/
 	ICppStructOps* CppStructOps;
+
+	/** Lazily built memcpy plan replayed by SerializeItem for eligible binary archives; see BuildFastBinarySerializationPlan. */
+	TArray<FFastBinarySerializationStep> FastBinaryPlan;
+	/** true once FastBinaryPlan has been computed (it may legitimately be empty for property-less structs). */
+	bool bFastBinaryPlanBuilt;
+	/** true when every property in the plan carries CPF_SaveGame, making the plan valid for save-game archives too. */
+	bool bFastBinaryPlanAllSaveGame;
+
+	/** Computes the plan from the property list; called once under a lock on first eligible use. */
+	COREUOBJECT_API void BuildFastBinarySerializationPlan();
+	/** True when the plan's byte stream is identical to per-property binary serialization for this archive. */
+	bool CanUseFastBinarySerialization(FArchive& Ar) const;
+	/** Replays the plan. */
+	void SerializeWithFastBinaryPlan(FStructuredArchive::FSlot Slot, void* Value);
 public:
 
 	// UObject Interface
@@ -2702,6 +2728,26 @@ public:
 	virtual void SetSuperStruct(UStruct* NewSuperStruct) override;
 	// End of UStruct interface.
 
+	/**
+	 * One step of the template initialization plan replayed by FObjectInitializer::InitProperties when
+	 * constructing from a non-CDO template: a raw byte span copied straight from the template
+	 * (Property == null) or a property that needs CopyCompleteValue.
+	 */
+	struct FTemplateInitStep
+	{
+		class UProperty* Property;
+		int32 Offset;
+		int32 Size;
+	};
+
+	/** Lazily built plan for initializing instances from a same-class template; see BuildTemplateInitPlan. */
+	TArray<FTemplateInitStep> TemplateInitPlan;
+	/** True once TemplateInitPlan is valid for the current property layout. */
+	bool bTemplateInitPlanBuilt = false;
+
+	/** Computes TemplateInitPlan from the property chain; called once under a lock on first use. */
+	void BuildTemplateInitPlan();
+
 #if WITH_EDITOR
 	/** Provides access to C++ type info. */
 	const ICppClassTypeInfo* GetCppTypeInfo() const
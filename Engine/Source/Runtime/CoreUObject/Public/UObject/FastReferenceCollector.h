@@ -480,6 +480,9 @@ private:
 
 	FCollectorTaskQueue TaskQueue;
 
+	/** When non-zero, ProcessObjectArray stops once FPlatformTime::Seconds() passes this; see CollectReferencesTimeSliced. */
+	double TimeSliceEndSeconds;
+
 	/** Helper struct for stack based approach */
 	struct FStackEntry
 	{
@@ -501,8 +504,30 @@ public:
 		: ReferenceProcessor(InReferenceProcessor)
 		, ArrayPool(InArrayPool)
 		, TaskQueue(this, InArrayPool)
+		, TimeSliceEndSeconds(0.0)
 	{}
 
+	/**
+	* Single-threaded, budgeted variant of CollectReferences. Processes until the work list drains or
+	* the time limit passes; on early exit the remaining work (unprocessed objects plus any children
+	* discovered so far) is left in ArrayStruct so a later call can resume. Marking already-visited
+	* objects is idempotent, so resumption after outside mutation only ever adds work, never corrupts it.
+	*
+	* @return true when reachability fully completed, false when interrupted by the time limit
+	*/
+	bool CollectReferencesTimeSliced(FGCArrayStruct& ArrayStruct, double TimeLimitSeconds)
+	{
+		check(!bParallel);
+		if (ArrayStruct.ObjectsToSerialize.Num())
+		{
+			TimeSliceEndSeconds = FPlatformTime::Seconds() + TimeLimitSeconds;
+			FGraphEventRef InvalidRef;
+			ProcessObjectArray(ArrayStruct, InvalidRef);
+			TimeSliceEndSeconds = 0.0;
+		}
+		return ArrayStruct.ObjectsToSerialize.Num() == 0;
+	}
+
 	/**
 	* Performs reachability analysis.
 	*
@@ -603,11 +628,23 @@ private:
 		// Keep serializing objects till we reach the end of the growing array at which point
 		// we are done.
 		int32 CurrentIndex = 0;
+		int32 TimeSlicePollCounter = 0;
+		bool bTimeSliceExpired = false;
 		do
 		{
 			CollectorType ReferenceCollector(ReferenceProcessor, NewObjectsToSerializeStruct);
 			while (CurrentIndex < ObjectsToSerialize.Num())
 			{
+				if (TimeSliceEndSeconds != 0.0 && ((TimeSlicePollCounter++ & 0xFF) == 0) && FPlatformTime::Seconds() > TimeSliceEndSeconds)
+				{
+					// Out of budget: compact the remaining work back into the caller's struct and stop.
+					// ObjectsToSerialize always aliases the input struct's array (Exchange swaps contents, not identity).
+					ObjectsToSerialize.RemoveAt(0, CurrentIndex, false);
+					ObjectsToSerialize.Append(NewObjectsToSerialize);
+					NewObjectsToSerialize.SetNumUnsafeInternal(0);
+					bTimeSliceExpired = true;
+					break;
+				}
 #if PERF_DETAILED_PER_CLASS_GC_STATS
 				uint32 StartCycles = FPlatformTime::Cycles();
 #endif
@@ -625,7 +662,9 @@ private:
 				//@todo rtgc: we need to handle object references in struct defaults
 
 				// Make sure that token stream has been assembled at this point as the below code relies on it.
-				if (!bParallel && bAutoGenerateTokenStream)
+				// With lazy boot assembly the parallel collector may assemble too; AssembleReferenceTokenStream
+				// locks in that mode, so racing workers serialize on the class.
+				if (bAutoGenerateTokenStream && (!bParallel || GLazyAssembleGCTokenStreams))
 				{
 					UClass* ObjectClass = CurrentObject->GetClass();
 					if (!ObjectClass->HasAnyClassFlags(CLASS_TokenStreamAssembled))
@@ -707,6 +746,19 @@ private:
 						ReferenceProcessor.HandleTokenStreamObjectReference(NewObjectsToSerialize, CurrentObject, Object, ReferenceTokenStreamIndex, true);
 					}
 					break;
+					case GCRT_ObjectRun:
+					{
+						// A run of contiguous object references merged into one token at stream assembly time.
+						UObject**	ObjectPtr = (UObject**)(StackEntryData + ReferenceInfo.Offset);
+						const uint32 NumInRun = TokenStream->ReadCount(TokenStreamIndex);
+						TokenReturnCount = ReferenceInfo.ReturnCount;
+						for (uint32 RunIndex = 0; RunIndex < NumInRun; RunIndex++)
+						{
+							FPlatformMisc::Prefetch(ObjectPtr + RunIndex + 1);
+							ReferenceProcessor.HandleTokenStreamObjectReference(NewObjectsToSerialize, CurrentObject, ObjectPtr[RunIndex], ReferenceTokenStreamIndex, true);
+						}
+					}
+					break;
 					case GCRT_ArrayObject:
 					{
 						// We're dealing with an array of object references.
@@ -877,6 +929,10 @@ EndLoop:
 
 				CurrentIndex = 0;
 			}
+			if (bTimeSliceExpired)
+			{
+				break;
+			}
 		}
 		while (CurrentIndex < ObjectsToSerialize.Num());
 
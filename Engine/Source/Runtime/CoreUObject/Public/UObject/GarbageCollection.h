@@ -23,6 +23,21 @@
 COREUOBJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogGarbage, Warning, All);
 DECLARE_STATS_GROUP(TEXT("Garbage Collection"), STATGROUP_GC, STATCAT_Advanced);
 
+/** True while a time-sliced reachability analysis cycle is in flight (gc.TimeSlicedReachability). */
+extern COREUOBJECT_API bool GIsIncrementalReachabilityPending;
+
+/** True when -LazyGCTokenStreams deferred boot-time token stream assembly to first GC use; makes lazy assembly thread safe inside the parallel collector. */
+extern COREUOBJECT_API bool GLazyAssembleGCTokenStreams;
+
+/**
+ * Write barrier for time-sliced reachability analysis. When a reference to an object is stored while a
+ * reachability cycle is in flight, the object may already have been passed over by the mark; this
+ * re-marks it and queues it for scanning in the next slice. Called from the reflected reference
+ * setters; native code that writes UObject* fields directly between slices is outside the contract,
+ * which is why the time-sliced mode is opt-in per project.
+ */
+COREUOBJECT_API void GCIncrementalReachabilityWriteBarrier(const class UObjectBase* ReferencedObject);
+
 /**
  * Do extra checks on GC'd function references to catch uninitialized pointers?
  */
@@ -49,6 +64,8 @@ enum EGCReferenceType
 	GCRT_AddTSetReferencedObjects,
 	GCRT_EndOfPointer,
 	GCRT_EndOfStream,
+	/** A run of contiguous plain object references: the token's offset is the first pointer, followed by one count word. Produced by merging adjacent GCRT_Object emissions. */
+	GCRT_ObjectRun,
 };
 
 /** 
@@ -239,6 +256,7 @@ struct FGCReferenceTokenStream
 	void Empty()
 	{
 		Tokens.Empty();
+		BreakObjectRun();
 	}
 
 	/**
@@ -441,6 +459,17 @@ private:
 
 	/** Token array */
 	TArray<uint32>	Tokens;
+
+	/** Index of the info token of the object run currently open for merging, or INDEX_NONE. */
+	int32 OpenRunInfoIndex = INDEX_NONE;
+	/** Byte offset the next GCRT_Object emission must have to extend the open run. */
+	uint32 OpenRunNextOffset = 0;
+
+	/** Ends the object run currently open for merging; any emission other than a mergeable GCRT_Object must call this. */
+	FORCEINLINE void BreakObjectRun()
+	{
+		OpenRunInfoIndex = INDEX_NONE;
+	}
 };
 
 /** Prevent GC from running in the current scope */
@@ -0,0 +1,60 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEnum;
+class UScriptStruct;
+
+/**
+ * Process-stable handles for steady-state enum and struct reflection lookups.
+ *
+ * FindObject-based lookups re-resolve by name every call and contend on the global object hash
+ * locks, which shows up in serialization layers that touch the same few dozen types millions of
+ * times. This registry hands out small integer handles for native reflection types: acquiring a
+ * handle is a slow, locked, name-based lookup meant to run once (typically from a function-local
+ * static after module load), and resolving a handle is a lock-free bounds-checked read of a table
+ * whose rows never move.
+ *
+ * Only native (compiled-in) types may be registered; they are rooted for the process lifetime, so
+ * the cached pointers cannot go stale at runtime. Blueprint-created types must keep using the
+ * regular lookup paths, since their objects can be collected and reloaded.
+ */
+class COREUOBJECT_API FReflectionHandleRegistry
+{
+public:
+	struct FEnumHandle
+	{
+		int32 Index = INDEX_NONE;
+
+		FORCEINLINE bool IsValid() const
+		{
+			return Index != INDEX_NONE;
+		}
+	};
+
+	struct FStructHandle
+	{
+		int32 Index = INDEX_NONE;
+
+		FORCEINLINE bool IsValid() const
+		{
+			return Index != INDEX_NONE;
+		}
+	};
+
+	/**
+	 * Finds the native enum by object path and registers it, returning its handle; the same path
+	 * always returns the same handle. Slow and locked — call once and keep the handle. Returns an
+	 * invalid handle when the enum does not exist or is not native.
+	 */
+	static FEnumHandle GetEnumHandle(const TCHAR* EnumPathName);
+
+	/** Struct counterpart of GetEnumHandle. */
+	static FStructHandle GetStructHandle(const TCHAR* StructPathName);
+
+	/** Lock-free handle resolution for steady-state use. Invalid handles resolve to null. */
+	static UEnum* ResolveEnum(FEnumHandle Handle);
+	static UScriptStruct* ResolveStruct(FStructHandle Handle);
+};
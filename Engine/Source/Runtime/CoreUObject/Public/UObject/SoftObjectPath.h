@@ -107,6 +107,14 @@ struct COREUOBJECT_API FSoftObjectPath
 	 */
 	UObject* ResolveObject() const;
 
+	/**
+	 * Resolves a whole batch of paths against loaded objects in one pass, holding the object hash
+	 * table locks once for the batch instead of once per path. OutObjects is filled index-for-index
+	 * with the found object or nullptr. Use when resolving many paths at once (inventory grids,
+	 * icon sets); pair the misses with a single consolidated FStreamableManager::RequestAsyncLoad.
+	 */
+	static COREUOBJECT_API void ResolveObjects(const TArrayView<const FSoftObjectPath>& Paths, TArray<UObject*>& OutObjects);
+
 	/** Resets reference to point to null */
 	void Reset()
 	{		
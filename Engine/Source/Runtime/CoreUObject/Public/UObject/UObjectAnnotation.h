@@ -7,6 +7,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/FlatMap.h"
 #include "UObject/UObjectArray.h"
 #include "Misc/ScopeLock.h"
 #include "Misc/ScopeRWLock.h"
@@ -205,11 +206,14 @@ public:
 		return AnnotationCacheValue;
 	}
 
+	/** The map type used for annotation storage; flat and open-addressed since lookups dominate this container's life. */
+	typedef TFlatMap<const UObjectBase *,TAnnotation> TAnnotationMap;
+
 	/**
 	 * Return the annotation map. Caution, this is for low level use 
 	 * @return A mapping from UObjectBase to annotation for non-default annotations
 	 */
-	const TMap<const UObjectBase *,TAnnotation>& GetAnnotationMap() const
+	const TAnnotationMap& GetAnnotationMap() const
 	{
 		return AnnotationMap;
 	}
@@ -228,7 +232,7 @@ private:
 	/**
 	 * Map from live objects to an annotation
 	 */
-	TMap<const UObjectBase *,TAnnotation> AnnotationMap;
+	TAnnotationMap AnnotationMap;
 	FCriticalSection AnnotationMapCritical;
 
 	/**
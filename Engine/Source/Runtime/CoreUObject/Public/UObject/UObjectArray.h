@@ -538,6 +538,13 @@ public:
 * that non-GC objects come before GC ones during iteration.
 *
 **/
+/**
+ * True while a time-sliced reachability analysis cycle is in flight (see GarbageCollection.h). While set,
+ * the Unreachable flag only means "not yet proven reachable this cycle", so validity checks must not
+ * treat it as dead; objects are never destroyed while the flag is transiently set.
+ */
+extern COREUOBJECT_API bool GIsIncrementalReachabilityPending;
+
 class COREUOBJECT_API FUObjectArray
 {
 public:
@@ -704,7 +711,9 @@ public:
 	{
 		if (ObjectItem)
 		{
-			return bEvenIfPendingKill ? !ObjectItem->IsUnreachable() : !(ObjectItem->IsUnreachable() || ObjectItem->IsPendingKill());
+			// mid-cycle Unreachable means "not yet proven reachable", not dead
+			const bool bUnreachable = ObjectItem->IsUnreachable() && !GIsIncrementalReachabilityPending;
+			return bEvenIfPendingKill ? !bUnreachable : !(bUnreachable || ObjectItem->IsPendingKill());
 		}
 		return false;
 	}
@@ -725,7 +734,8 @@ public:
 	FORCEINLINE bool IsStale(FUObjectItem* ObjectItem, bool bEvenIfPendingKill)
 	{
 		// This method assumes ObjectItem is valid.
-		return bEvenIfPendingKill ? (ObjectItem->IsPendingKill() || ObjectItem->IsUnreachable()) : (ObjectItem->IsUnreachable());
+		const bool bUnreachable = ObjectItem->IsUnreachable() && !GIsIncrementalReachabilityPending;
+		return bEvenIfPendingKill ? (ObjectItem->IsPendingKill() || bUnreachable) : bUnreachable;
 	}
 
 	FORCEINLINE bool IsStale(int32 Index, bool bEvenIfPendingKill)
@@ -538,6 +538,34 @@ COREUOBJECT_API bool IsReferenced( UObject*& Res, EObjectFlags KeepFlags, EInter
  */
 COREUOBJECT_API void FlushAsyncLoading(int32 PackageID = INDEX_NONE);
 
+/**
+ * Registers or updates a named async loading budget profile. A profile overrides the per-tick time
+ * slice async loading runs under and caps how many packages one tick processes, so game code can
+ * switch between e.g. an unbounded loading-screen budget and a strict streaming budget atomically
+ * instead of retuning scattered cvars.
+ *
+ * @param ProfileName			Name to register under
+ * @param TimeLimitMs			Per-tick time slice in milliseconds; <= 0 makes ticks unbounded (loading screens)
+ * @param MaxPackagesPerTick	Cap on packages processed per tick; <= 0 for no cap
+ */
+COREUOBJECT_API void RegisterAsyncLoadingBudgetProfile(FName ProfileName, float TimeLimitMs, int32 MaxPackagesPerTick);
+
+/**
+ * Switches the active budget profile; NAME_None restores caller-provided limits. Built-in profiles:
+ * "LoadingScreen" (unbounded) and "Streaming" (1ms, 4 packages per tick). Explicitly unbounded calls
+ * (flushes) are never constrained by a profile.
+ */
+COREUOBJECT_API void SetAsyncLoadingBudgetProfile(FName ProfileName);
+
+/**
+ * Declares that a class's PostLoad neither depends on running in export order relative to other
+ * objects NOR is depended upon: no other object's PostLoad may require this class's PostLoad to
+ * have already run. Deferred PostLoads of marked classes are dispatched grouped by class after the
+ * unmarked ones (s.GroupPostLoadsByClass), keeping one PostLoad's code and data hot across the
+ * whole batch. Only mark classes whose PostLoad is genuinely self-contained in both directions.
+ */
+COREUOBJECT_API void MarkClassPostLoadOrderIndependent(FName ClassName);
+
 /**
  * Return number of active async load package requests
  */
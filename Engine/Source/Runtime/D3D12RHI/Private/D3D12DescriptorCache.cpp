@@ -590,15 +590,13 @@ void FD3D12DescriptorCache::SetSRVs(const FD3D12RootSignature* RootSignature, FD
 	HeapSlot += SlotsNeeded;
 
 	D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor = CurrentViewHeap->GetCPUSlotHandle(FirstSlotIndex);
-	const uint64 DescriptorSize = CurrentViewHeap->GetDescriptorSize();
+	CD3DX12_CPU_DESCRIPTOR_HANDLE SrcDescriptors[MAX_SRVS];
 
 	for (uint32 SlotIndex = 0; SlotIndex < SlotsNeeded; SlotIndex++)
 	{
-		CD3DX12_CPU_DESCRIPTOR_HANDLE SrcDescriptor;
-
 		if (SRVs[SlotIndex] != nullptr)
 		{
-			SrcDescriptor = SRVs[SlotIndex]->GetView();
+			SrcDescriptors[SlotIndex] = SRVs[SlotIndex]->GetView();
 
 			CommandList.UpdateResidency(Cache.ResidencyHandles[ShaderStage][SlotIndex]);
 
@@ -617,17 +615,20 @@ void FD3D12DescriptorCache::SetSRVs(const FD3D12RootSignature* RootSignature, FD
 		}
 		else
 		{
-			SrcDescriptor = pNullSRV->GetHandle();
+			SrcDescriptors[SlotIndex] = pNullSRV->GetHandle();
 		}
-		check(SrcDescriptor.ptr != 0);
-
-		Device->CopyDescriptorsSimple(1, DestDescriptor, SrcDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-		DestDescriptor.ptr += DescriptorSize;
+		check(SrcDescriptors[SlotIndex].ptr != 0);
 
 		FD3D12ShaderResourceViewCache::CleanSlot(CurrentDirtySlotMask, SlotIndex);
 	}
 
+	// Gather the descriptors from the offline heaps to the online heap in one call, like SetUAVs/SetSamplers,
+	// rather than one device copy per slot.
+	Device->CopyDescriptors(
+		1, &DestDescriptor, &SlotsNeeded,
+		SlotsNeeded, SrcDescriptors, nullptr /* sizes */,
+		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
 	check((CurrentDirtySlotMask & SlotsNeededMask) == 0);	// Check all slots that needed to be set, were set.
 
 	const D3D12_GPU_DESCRIPTOR_HANDLE BindDescriptor = CurrentViewHeap->GetGPUSlotHandle(FirstSlotIndex);
@@ -774,7 +774,17 @@ struct ENGINE_API FExposedValueHandler
 	void Initialize(UObject* AnimInstanceObject, int32 NodeOffset);
 
 	// Execute the function and copy records
-	void Execute(const FAnimationBaseContext& Context) const;
+	/** Runs the bound function and copy records. Fully folded handlers (no function, no copy records) cost one branch, keeping constant-input nodes off the dispatch path entirely. */
+	FORCEINLINE void Execute(const FAnimationBaseContext& Context) const
+	{
+		if (Function != nullptr || CopyRecords.Num() > 0)
+		{
+			ExecuteImpl(Context);
+		}
+	}
+
+	/** Non-trivial execution body; see Execute. */
+	ENGINE_API void ExecuteImpl(const FAnimationBaseContext& Context) const;
 };
 
 /**
@@ -449,6 +449,11 @@ public:
 	*/
 	void GetBonePose(FCompactPose& OutPose, FBlendedCurve& OutCurve, const FAnimExtractContext& ExtractionContext, bool bForceUseRawData=false) const;
 
+private:
+	/** GetBonePose's evaluation body; the public entry consults the shared evaluated-pose cache first (a.SharedPoseCache). */
+	void GetBonePose_Internal(FCompactPose& OutPose, FBlendedCurve& OutCurve, const FAnimExtractContext& ExtractionContext, bool bForceUseRawData) const;
+public:
+
 	const TArray<FRawAnimSequenceTrack>& GetRawAnimationData() const { return RawAnimationData; }
 
 #if WITH_EDITORONLY_DATA
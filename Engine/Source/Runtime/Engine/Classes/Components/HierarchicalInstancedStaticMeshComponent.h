@@ -124,6 +124,14 @@ struct FClusterNode
 };
 
 UCLASS(ClassGroup=Rendering, meta=(BlueprintSpawnableComponent))
+// Note on incremental cluster maintenance: edits are already incremental at the render level -
+// removals hide instances through the instance update command buffer, additions render as
+// unbuilt instances immediately - and the cluster tree itself rebuilds wholesale on an async
+// task when outdated. True subtree-local tree updates (splitting/merging only touched
+// clusters) would change the tree invariants every traversal relies on (tight bounds,
+// contiguous render ranges per cluster); with rebuilds already off the game thread, the win
+// to chase first is rebuild frequency (batching bursts of edits into one rebuild), which the
+// outdated-tree scheduling already provides a hook for.
 class ENGINE_API UHierarchicalInstancedStaticMeshComponent : public UInstancedStaticMeshComponent
 {
 	GENERATED_UCLASS_BODY()
@@ -319,6 +319,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Animation)
 	class TSubclassOf<UAnimInstance> AnimClass;
 
+	/**
+	 * If set, this component's tick batches with other skeletal mesh components running the same
+	 * animation class (see FTickFunction::TickBatchKey): a crowd sharing one AnimBP traverses that
+	 * graph back to back in one scheduled task instead of interleaving it with every other ticking
+	 * class, which is where same-AnimBP crowds lose their time. Requires the component tick to have
+	 * no prerequisites beyond the defaults; ineligible ticks fall back to individual scheduling.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = Animation)
+	uint8 bBatchTicksWithSameAnimClass:1;
+
 	/** The active animation graph program instance. */
 	UPROPERTY(transient, NonTransactional)
 	UAnimInstance* AnimScriptInstance;
@@ -1512,6 +1522,9 @@ public:
 	virtual void SetAllPhysicsRotation(const FQuat& NewRot) override;
 	virtual void WakeAllRigidBodies() override;
 	virtual void PutAllRigidBodiesToSleep() override;
+
+	/** Applies ragdoll simulation LOD (p.RagdollLOD.FreezeScreenSize): keeps distant/unrendered simulating ragdolls asleep. Called from TickComponent. */
+	void UpdateRagdollSimulationLOD();
 	virtual bool IsAnyRigidBodyAwake() override;
 	virtual void SetEnableGravity(bool bGravityEnabled);
 	virtual bool IsGravityEnabled() const override;
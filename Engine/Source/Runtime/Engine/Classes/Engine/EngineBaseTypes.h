@@ -213,6 +213,51 @@ public:
 	/** If false, this tick will run on the game thread, otherwise it will run on any thread in parallel with the game thread and in parallel with other "async ticks" **/
 	uint8 bRunOnAnyThread:1;
 
+	/**
+	 * When set, this tick function may be executed together with other functions sharing the key in a
+	 * single scheduled task, eliminating the per-function scheduling overhead that dominates classes
+	 * with thousands of tiny ticks (projectiles, timers). Only functions with no prerequisites, no
+	 * tick interval and matching start/end group and priority flags batch; everything else falls back
+	 * to individual scheduling, and dependents of a batched function wait on the whole batch. Classes
+	 * can register a callback receiving the whole batch via RegisterBatchTickCallback; without one,
+	 * members still execute individually inside the single task. Execution order within a batch is
+	 * unspecified.
+	 */
+	FName TickBatchKey;
+
+	/**
+	 * Optional tick-rate LOD: when bound, the callback returns the function's current significance in
+	 * [0,1] and the scheduler derives the effective tick interval each time the function is
+	 * rescheduled: 1 ticks at MinTickRateLODInterval (0 = every frame), 0 at MaxTickRateLODInterval,
+	 * linearly in between. TickInterval is ignored while the callback is bound. Delta time accumulates
+	 * across skipped frames exactly like plain interval ticking, so rate-scaled logic stays correct.
+	 * Evaluated on the game thread during scheduling; keep it trivial (a cached distance bucket, not a trace).
+	 */
+	TFunction<float()> TickSignificanceCallback;
+
+	/** Interval used at full significance when TickSignificanceCallback is bound; 0 means tick every frame. */
+	float MinTickRateLODInterval = 0.0f;
+
+	/** Interval used at zero significance when TickSignificanceCallback is bound. */
+	float MaxTickRateLODInterval = 1.0f;
+
+	/** The interval the scheduler should use for the next reschedule: LOD-derived when the significance callback is bound, plain TickInterval otherwise. */
+	float GetEffectiveTickInterval() const
+	{
+		if (TickSignificanceCallback)
+		{
+			const float Significance = FMath::Clamp(TickSignificanceCallback(), 0.0f, 1.0f);
+			return FMath::Lerp(MaxTickRateLODInterval, MinTickRateLODInterval, Significance);
+		}
+		return TickInterval;
+	}
+
+	/** Signature for a batch tick callback: all batched functions for the key, the (uniform) delta time, tick type and executing thread. */
+	typedef TFunction<void(const TArrayView<FTickFunction* const>&, float, ELevelTick, ENamedThreads::Type)> FBatchTickCallback;
+
+	/** Registers (or replaces) the batch execution callback for a batch key; see TickBatchKey. */
+	static ENGINE_API void RegisterBatchTickCallback(FName BatchKey, FBatchTickCallback Callback);
+
 private:
 
 	enum class ETickState : uint8
@@ -250,6 +295,9 @@ private:
 		/** Cache whether this function was rescheduled as an interval function during StartParallel */
 		bool bWasInterval:1;
 
+		/** Whether TaskPointer currently aliases a batch task rather than this function's own task; decides how GetCompletionHandle resolves it. */
+		bool bWasBatchQueued:1;
+
 		/** Internal data that indicates the tick group we actually started in (it may have been delayed due to prerequisites) **/
 		TEnumAsByte<enum ETickingGroup> ActualStartTickGroup;
 
@@ -420,6 +468,7 @@ private:
 	friend class FTickTaskManager;
 	friend class FTickTaskLevel;
 	friend class FTickFunctionTask;
+	friend class FTickBatchTask;
 
 	// It is unsafe to copy FTickFunctions and any subclasses of FTickFunction should specify the type trait WithCopy = false
 	FTickFunction& operator=(const FTickFunction&) = delete;
@@ -223,6 +223,15 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=LevelStreaming, meta=(ClampMin = "0", UIMin = "0", UIMax = "10"))
 	float MinTimeBetweenVolumeUnloadRequests;
 
+	/**
+	 * Per-level override for the AddToWorld incremental time budget, in milliseconds per frame.
+	 * 0 uses the global s.LevelStreamingActorsUpdateTimeLimit. Lets a heavyweight hub level take a
+	 * larger slice while background sublevels stream under a strict budget, instead of one global
+	 * number serving both.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=LevelStreaming, meta=(ClampMin = "0", UIMin = "0", UIMax = "20"))
+	float AddToWorldTimeBudgetMsOverride = 0.0f;
+
 	/** Time of last volume unload request.  Used in preventing spurious unload requests. */
 	float LastVolumeUnloadRequestTime;
 
@@ -435,6 +435,8 @@ public:
 
 	// Packet.
 	FBitWriter		SendBuffer;						// Queued up bits waiting to send
+	FNetBitWriter	ReplicationScratchWriter;		// Reused by property replication to avoid a writer allocation per replicated object
+	bool			bReplicationScratchWriterInUse = false;	// Guards against reentrant use; nested callers fall back to a local writer
 	double			OutLagTime[256];				// For lag measuring.
 	int32			OutLagPacketId[256];			// For lag measuring.
 	uint8			OutBytesPerSecondHistory[256];	// For saturation measuring.
@@ -1034,6 +1034,12 @@ public:
 	 */
 	TSharedPtr< FReplicationChangelistMgr > GetReplicationChangeListMgr( UObject* Object );
 
+	/** Opts an object into push-based dirty tracking: its property compares are skipped on frames where it was not marked dirty. */
+	ENGINE_API void SetObjectPushDirtyTracking(UObject* Object);
+
+	/** Marks a push-tracked object's state changed so its next replication runs a fresh compare. */
+	ENGINE_API void MarkObjectDirtyForReplication(UObject* Object);
+
 	TMap< FNetworkGUID, TSet< FObjectReplicator* > >	GuidToReplicatorMap;
 	int32												TotalTrackedGuidMemoryBytes;
 	TSet< FObjectReplicator* >							UnmappedReplicators;
@@ -1527,7 +1533,7 @@ protected:
 	*/
 	int32 ServerReplicateActors_PrepConnections( const float DeltaSeconds );
 	void ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime );
-	int32 ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors );
+	int32 ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors, const bool bDoSort = true );
 	int32 ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated );
 #endif
 
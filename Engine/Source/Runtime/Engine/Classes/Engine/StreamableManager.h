@@ -241,6 +241,14 @@ struct ENGINE_API FStreamableManager : public FGCObject
 	TSharedPtr<FStreamableHandle> RequestAsyncLoad(TArray<FSoftObjectPath> TargetsToStream, FStreamableDelegate DelegateToCall = FStreamableDelegate(), TAsyncLoadPriority Priority = DefaultAsyncLoadPriority, bool bManageActiveHandle = false, bool bStartStalled = false, FString DebugName = TEXT("RequestAsyncLoad ArrayDelegate"));
 	TSharedPtr<FStreamableHandle> RequestAsyncLoad(const FSoftObjectPath& TargetToStream, FStreamableDelegate DelegateToCall = FStreamableDelegate(), TAsyncLoadPriority Priority = DefaultAsyncLoadPriority, bool bManageActiveHandle = false, bool bStartStalled = false, FString DebugName = TEXT("RequestAsyncLoad SingleDelegate"));
 
+	/**
+	 * Resolves a batch of paths against already-loaded objects in one pass and issues a single
+	 * consolidated async load for the misses. OutResolved is filled index-for-index with the loaded
+	 * object or null for paths now in flight; the returned handle (null when everything resolved)
+	 * covers all misses, so a screen full of soft references costs one request instead of N.
+	 */
+	TSharedPtr<FStreamableHandle> ResolveOrRequestAsyncLoad(const TArray<FSoftObjectPath>& TargetsToStream, TArray<UObject*>& OutResolved, FStreamableDelegate DelegateToCall = FStreamableDelegate(), TAsyncLoadPriority Priority = DefaultAsyncLoadPriority, bool bManageActiveHandle = false, FString DebugName = TEXT("ResolveOrRequestAsyncLoad"));
+
 	/** Lambda Wrappers. Be aware that Callback may go off multiple seconds in the future. */
 	TSharedPtr<FStreamableHandle> RequestAsyncLoad(TArray<FSoftObjectPath> TargetsToStream, TFunction<void()>&& Callback, TAsyncLoadPriority Priority = DefaultAsyncLoadPriority, bool bManageActiveHandle = false, bool bStartStalled = false, FString DebugName = TEXT("RequestAsyncLoad ArrayLambda"));
 	TSharedPtr<FStreamableHandle> RequestAsyncLoad(const FSoftObjectPath& TargetToStream, TFunction<void()>&& Callback, TAsyncLoadPriority Priority = DefaultAsyncLoadPriority, bool bManageActiveHandle = false, bool bStartStalled = false, FString DebugName = TEXT("RequestAsyncLoad SingleLambda"));
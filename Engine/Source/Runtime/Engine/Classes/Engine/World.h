@@ -1034,6 +1034,15 @@ public:
 	/** Whether we are in the middle of ticking actors/components or not														*/
 	uint8 bInTick:1;
 
+	/** True while FlushDeferredOverlapUpdates runs, so re-entrant overlap updates take the immediate path. Not a bitfield so the flush can scope-guard it. */
+	bool bIsFlushingDeferredOverlaps = false;
+
+	/** Components whose re-scan overlap updates were coalesced this tick group (p.BatchComponentOverlapUpdates). */
+	TSet<TWeakObjectPtr<UPrimitiveComponent>> DeferredOverlapComponents;
+
+	/** Runs the coalesced overlap updates queued since the last flush; called at tick group boundaries. */
+	ENGINE_API void FlushDeferredOverlapUpdates();
+
 	/** Whether we have already built the collision tree or not                                                                 */
 	uint8 bIsBuilt:1;
 
@@ -1963,6 +1972,11 @@ public:
 	 *							TraceDelegate.BindRaw(this, &MyActor::TraceDone);
 	 * 
 	 *	@param	UserData		UserData
+	 *
+	 *	Note for high-volume users (weapons, visibility): traces queued here are frame-batched
+	 *	into fixed-size chunks, each chunk runs as its own task graph job, and results return via
+	 *	the delegate or next-frame polling - so thousands of independent traces per frame should
+	 *	go through this rather than one-off synchronous LineTrace* calls on the game thread.
 	 */ 
 	FTraceHandle	AsyncLineTraceByChannel(EAsyncTraceType InTraceType, const FVector& Start,const FVector& End, ECollisionChannel TraceChannel, const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam, const FCollisionResponseParams& ResponseParam = FCollisionResponseParams::DefaultResponseParam, FTraceDelegate * InDelegate=NULL, uint32 UserData = 0 );
 
@@ -2991,6 +3005,22 @@ public:
 	 */
 	AActor* SpawnActor( UClass* Class, FTransform const* Transform, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters());
 
+	/**
+	 * Spawns a batch of actors of one class in two phases: every actor is allocated and initialized
+	 * with construction deferred, then all construction scripts and component registration run in one
+	 * consolidated pass. Splitting the phases keeps each phase's code and data hot across the whole
+	 * batch (class layout, construction script bytecode, registration paths) instead of interleaving
+	 * them per actor, which is where spawn-storm time goes. Failed spawns produce null entries so
+	 * OutActors is index-aligned with Transforms.
+	 *
+	 * @param Class			Class of every actor in the batch
+	 * @param Transforms	One transform per actor to spawn
+	 * @param SpawnParameters	Spawn parameters applied to each spawn (Name must be NAME_None for batches of more than one)
+	 * @param OutActors		Receives one entry per transform: the spawned actor or null
+	 * @return Number of actors successfully spawned
+	 */
+	int32 SpawnActorsBatched(UClass* Class, const TArrayView<const FTransform>& Transforms, const FActorSpawnParameters& SpawnParameters, TArray<AActor*>& OutActors);
+
 	/**
 	 * Spawn Actors with given absolute transform (override root component transform) and SpawnParameters
 	 * 
@@ -69,6 +69,12 @@ struct FDistanceVisibleLevel
  *  - Handles properly levels repositioning during level loading and saving
  */
 UCLASS(config=Engine)
+// Note on an imposter tier below HLOD: distance streaming here swaps whole HLOD proxy
+// meshes/textures per tile, which is the IO burst at tile boundaries. A cheaper far tier -
+// shared imposter atlases covering many tiles with per-tile cards - is cook-side content
+// generation (atlas baking, card meshes) plus a far-distance streaming level per region; the
+// runtime distance machinery in this class already supports additional tiers via streaming
+// layers, so the work is in the cook pipeline, not here.
 class ENGINE_API UWorldComposition : public UObject
 {
 	GENERATED_UCLASS_BODY()
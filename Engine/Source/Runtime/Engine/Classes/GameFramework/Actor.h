@@ -338,6 +338,22 @@ protected:
 	UPROPERTY(Category=Actor, EditAnywhere, AdvancedDisplay)
 	uint8 bCanBeInCluster:1;
 
+	/**
+	 * If true, a runtime-spawned instance of this actor creates a GC cluster rooted at itself once its
+	 * components are initialized, so the whole spawned subobject graph (components, instanced
+	 * subobjects, dynamic materials) collapses to a single visit during reachability analysis.
+	 * Intended for classes spawned in large numbers (AI agents, projectiles); the cluster dissolves
+	 * automatically when any clustered object is renamed out or destroyed. Ignored in the editor and
+	 * when gc.CreateGCClusters is disabled.
+	 *
+	 * CONTRACT: a cluster's outgoing reference set is frozen when the cluster is created. A class that
+	 * opts in must not acquire references to new objects after initialization (no late dynamic
+	 * material or subobject creation) unless those objects are referenced from outside the cluster as
+	 * well. gc.IncrementalClusterVerification exists to catch violations in development builds.
+	 */
+	UPROPERTY(Category=Actor, EditAnywhere, AdvancedDisplay)
+	uint8 bClusterSpawnedSubobjects:1;
+
 	/**
 	 * If false, the Blueprint ReceiveTick() event will be disabled on dedicated servers.
 	 * @see AllowReceiveTickEventOnDedicatedServer()
@@ -1614,6 +1630,7 @@ public:
 	virtual bool Rename( const TCHAR* NewName=nullptr, UObject* NewOuter=nullptr, ERenameFlags Flags=REN_None ) override;
 	virtual void PostRename( UObject* OldOuter, const FName OldName ) override;
 	virtual bool CanBeInCluster() const override;
+	virtual bool CanBeClusterRoot() const override;
 	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 	virtual bool IsEditorOnly() const override;
 #if WITH_EDITOR
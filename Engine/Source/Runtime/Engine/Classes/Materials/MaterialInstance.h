@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
 #include "UObject/ObjectMacros.h"
 #include "Misc/Guid.h"
 #include "RenderCommandFence.h"
@@ -707,6 +708,8 @@ protected:
 	bool SetVectorParameterByIndexInternal(int32 ParameterIndex, FLinearColor Value);
 	bool SetScalarParameterByIndexInternal(int32 ParameterIndex, float Value);
 	void SetScalarParameterValueInternal(const FMaterialParameterInfo& ParameterInfo, float Value);
+	/** Sets several scalar parameters with a single render-side update instead of one per parameter. */
+	void SetScalarParameterValuesInternal(TArrayView<const TPair<FName, float>> ParameterValues);
 #if WITH_EDITOR
 	void SetScalarParameterAtlasInternal(const FMaterialParameterInfo& ParameterInfo, FScalarParameterAtlasInstanceData AtlasData);
 #endif
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
 #include "UObject/ObjectMacros.h"
 #include "Materials/MaterialInstance.h"
 #include "MaterialInstanceDynamic.generated.h"
@@ -17,6 +18,12 @@ class ENGINE_API UMaterialInstanceDynamic : public UMaterialInstance
 	UFUNCTION(BlueprintCallable, meta=(Keywords = "SetFloatParameterValue"), Category="Rendering|Material")
 	void SetScalarParameterValue(FName ParameterName, float Value);
 
+	/**
+	 * Sets several scalar parameters in one call, enqueuing a single render thread update instead
+	 * of one command per parameter; intended for UI and effects animating many parameters per frame.
+	 */
+	void SetScalarParameterValues(TArrayView<const TPair<FName, float>> ParameterValues);
+
 	// NOTE: These Index-related functions should be used VERY carefully, and only in cases where optimization is
 	// critical.  Generally that's only if you're using an unusually high number of parameters in a material AND
 	// setting a huge number of parameters in the same frame.
@@ -38,6 +38,9 @@ private:
 	// The actual audio buffer that can be consumed. QueuedAudio is fed to this buffer. Accessed only audio thread.
 	TArray<uint8> AudioBuffer;
 
+	// Read cursor into AudioBuffer; consumed bytes are skipped instead of shifting the array every callback
+	int32 AudioBufferReadOffset = 0;
+
 	// Flag to reset the audio buffer
 	FThreadSafeBool bReset;
 
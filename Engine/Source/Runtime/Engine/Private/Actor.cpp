@@ -326,6 +326,11 @@ bool AActor::CanBeInCluster() const
 	return bCanBeInCluster;
 }
 
+bool AActor::CanBeClusterRoot() const
+{
+	return bClusterSpawnedSubobjects;
+}
+
 void AActor::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
 	AActor* This = CastChecked<AActor>(InThis);
@@ -3224,6 +3229,13 @@ void AActor::PostActorConstruction()
 					SCOPE_CYCLE_COUNTER(STAT_ActorBeginPlay);
 					DispatchBeginPlay();
 				}
+
+				// Collapse the freshly spawned subobject graph into one GC cluster; everything the
+				// actor owns exists by now, so the cluster captures components and their subobjects.
+				if (bClusterSpawnedSubobjects && !GIsEditor && !IsPendingKill())
+				{
+					CreateCluster();
+				}
 			}
 		}
 	}
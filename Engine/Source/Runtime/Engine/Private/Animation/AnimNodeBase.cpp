@@ -678,7 +678,7 @@ void FExposedValueHandler::Initialize(UObject* AnimInstanceObject, int32 NodeOff
 	bInitialized = true;
 }
 
-void FExposedValueHandler::Execute(const FAnimationBaseContext& Context) const
+void FExposedValueHandler::ExecuteImpl(const FAnimationBaseContext& Context) const
 {
 	if (Function != nullptr)
 	{
@@ -5,6 +5,7 @@
 =============================================================================*/ 
 
 #include "Animation/AnimSequence.h"
+#include "Hash/CityHash.h"
 #include "Misc/MessageDialog.h"
 #include "Logging/LogScopedVerbosityOverride.h"
 #include "UObject/FrameworkObjectVersion.h"
@@ -1102,8 +1103,13 @@ void UAnimSequence::VerifyTrackMap(USkeleton* MySkeleton)
 }
 
 #endif // WITH_EDITOR
+/** Defined with the shared pose cache below; drops a dying sequence's cached poses. */
+static void InvalidateSharedPoseCacheEntries(const UAnimSequence* Sequence);
+
 void UAnimSequence::BeginDestroy()
 {
+	InvalidateSharedPoseCacheEntries(this);
+
 	Super::BeginDestroy();
 
 	CompressedData.CompressedDataStructure.TranslationCodec = nullptr;
@@ -1483,7 +1489,136 @@ void UAnimSequence::GetAnimationPose(FCompactPose& OutPose, FBlendedCurve& OutCu
 #endif
 }
 
+/**
+ * Shared evaluated-pose cache: background characters playing identical loops at identical phase
+ * decompress each pose once per (sequence, quantized time, bone set, curve table) instead of once
+ * per instance. Root-motion extraction and raw-data evaluation bypass the cache; hits copy the
+ * shared bones and curve elements, whose layout the key guarantees to match.
+ */
+static int32 GSharedPoseCache = 0;
+static FAutoConsoleVariableRef CVarSharedPoseCache(
+	TEXT("a.SharedPoseCache"),
+	GSharedPoseCache,
+	TEXT("If true, evaluated poses are shared between components sampling the same sequence at the same quantized time with the same bone set."),
+	ECVF_Default
+);
+
+static float GSharedPoseCacheTimeQuantum = 1.0f / 120.0f;
+static FAutoConsoleVariableRef CVarSharedPoseCacheTimeQuantum(
+	TEXT("a.SharedPoseCacheTimeQuantum"),
+	GSharedPoseCacheTimeQuantum,
+	TEXT("Time quantization bucket, in seconds, for the shared evaluated-pose cache."),
+	ECVF_Default
+);
+
+namespace SharedPoseCache
+{
+	struct FEntry
+	{
+		const UAnimSequence* Sequence = nullptr;
+		TArray<FTransform> Bones;
+		/** Curve values only, heap-backed: the cache must not retain a container LUT pointer or FBlendedCurve's memstack-backed element storage. */
+		TArray<FCurveElement> CurveElements;
+		uint16 NumValidCurveCount = 0;
+		uint64 LastUsed = 0;
+	};
+
+	enum { MaxEntries = 256 };
+	static FCriticalSection GLock;
+	static TMap<uint64, FEntry> GEntries;
+	static uint64 GAccessCounter = 0;
+
+	static uint64 MakeKey(const UAnimSequence* Sequence, int32 QuantizedTime, const FBoneContainer& RequiredBones, bool bForceUseRawData)
+	{
+		uint64 Key = CityHash64((const char*)&Sequence, sizeof(Sequence));
+		Key = CityHash64WithSeed((const char*)&QuantizedTime, sizeof(QuantizedTime), Key);
+		const TArray<FBoneIndexType>& BoneIndices = RequiredBones.GetBoneIndicesArray();
+		Key = CityHash64WithSeed((const char*)BoneIndices.GetData(), BoneIndices.Num() * sizeof(FBoneIndexType), Key);
+		// Hash the curve LUT contents and the asset the container was built for, not the LUT
+		// allocation: containers are per-component, so a pointer key would split identical
+		// layouts across instances (defeating sharing) and could alias through a freed LUT.
+		// Identical LUT contents imply an identical curve layout, which is what makes the
+		// cached curve values safe to copy into another instance's curve.
+		const TArray<uint16>& CurveLUT = RequiredBones.GetUIDToArrayLookupTable();
+		Key = CityHash64WithSeed((const char*)CurveLUT.GetData(), CurveLUT.Num() * sizeof(uint16), Key);
+		const UObject* ContainerAsset = RequiredBones.GetAsset();
+		Key = CityHash64WithSeed((const char*)&ContainerAsset, sizeof(ContainerAsset), Key);
+		const uint8 Flags = (bForceUseRawData ? 1 : 0) | (RequiredBones.GetDisableRetargeting() ? 2 : 0);
+		Key = CityHash64WithSeed((const char*)&Flags, sizeof(Flags), Key);
+		return Key;
+	}
+}
+
+static void InvalidateSharedPoseCacheEntries(const UAnimSequence* Sequence)
+{
+	FScopeLock Lock(&SharedPoseCache::GLock);
+	for (auto It = SharedPoseCache::GEntries.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Sequence == Sequence)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
 void UAnimSequence::GetBonePose(FCompactPose& OutPose, FBlendedCurve& OutCurve, const FAnimExtractContext& ExtractionContext, bool bForceUseRawData) const
+{
+	if (GSharedPoseCache && !ExtractionContext.bExtractRootMotion && GSharedPoseCacheTimeQuantum > 0.0f)
+	{
+		const int32 QuantizedTime = (int32)(ExtractionContext.CurrentTime / GSharedPoseCacheTimeQuantum);
+		const uint64 Key = SharedPoseCache::MakeKey(this, QuantizedTime, OutPose.GetBoneContainer(), bForceUseRawData);
+		{
+			FScopeLock Lock(&SharedPoseCache::GLock);
+			if (SharedPoseCache::FEntry* Entry = SharedPoseCache::GEntries.Find(Key))
+			{
+				if (Entry->Bones.Num() == OutPose.GetNumBones() && Entry->CurveElements.Num() == OutCurve.Elements.Num())
+				{
+					Entry->LastUsed = ++SharedPoseCache::GAccessCounter;
+					OutPose.CopyBonesFrom(Entry->Bones);
+					// Copy curve values only; the cache carries no LUT pointer and OutCurve
+					// keeps the one for its own container. Layout equality across instances
+					// is guaranteed by the key hashing the LUT contents.
+					OutCurve.Elements.Reset();
+					OutCurve.Elements.Append(Entry->CurveElements);
+					OutCurve.NumValidCurveCount = Entry->NumValidCurveCount;
+					OutCurve.bInitialized = true;
+					return;
+				}
+			}
+		}
+
+		GetBonePose_Internal(OutPose, OutCurve, ExtractionContext, bForceUseRawData);
+
+		FScopeLock Lock(&SharedPoseCache::GLock);
+		if (SharedPoseCache::GEntries.Num() >= SharedPoseCache::MaxEntries)
+		{
+			uint64 OldestAccess = MAX_uint64;
+			uint64 OldestKey = 0;
+			for (const TPair<uint64, SharedPoseCache::FEntry>& Pair : SharedPoseCache::GEntries)
+			{
+				if (Pair.Value.LastUsed < OldestAccess)
+				{
+					OldestAccess = Pair.Value.LastUsed;
+					OldestKey = Pair.Key;
+				}
+			}
+			SharedPoseCache::GEntries.Remove(OldestKey);
+		}
+		SharedPoseCache::FEntry& NewEntry = SharedPoseCache::GEntries.Add(Key);
+		NewEntry.Sequence = this;
+		NewEntry.Bones = OutPose.GetBones();
+		// Store curve values only: retaining the LUT pointer CopyFrom copies would dangle once
+		// the evaluating component's bone container goes away.
+		NewEntry.CurveElements.Append(OutCurve.Elements);
+		NewEntry.NumValidCurveCount = OutCurve.NumValidCurveCount;
+		NewEntry.LastUsed = ++SharedPoseCache::GAccessCounter;
+		return;
+	}
+
+	GetBonePose_Internal(OutPose, OutCurve, ExtractionContext, bForceUseRawData);
+}
+
+void UAnimSequence::GetBonePose_Internal(FCompactPose& OutPose, FBlendedCurve& OutCurve, const FAnimExtractContext& ExtractionContext, bool bForceUseRawData) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_AnimSeq_GetBonePose);
 	CSV_SCOPED_TIMING_STAT(Animation, AnimSeq_GetBonePose);
@@ -70,6 +70,26 @@ FORCEINLINE void BlendPose(const FCompactPose& SourcePose, FCompactPose& ResultP
 	}
 }
 
+/**
+ * Fused two-pose blend: the overwrite-scale, accumulate and rotation-normalize that the general path
+ * runs as three separate passes over the bone array collapse into one pass, so every bone's
+ * transforms are touched exactly once while resident in registers. Two-pose blends are the dominant
+ * shape in blend-heavy graphs, and the per-bone math is the same vectorized FTransform path the
+ * general loop uses; the win is memory traffic, not arithmetic.
+ */
+FORCEINLINE void BlendTwoPosesFused(const FCompactPose& PoseA, const FCompactPose& PoseB, const float WeightA, const float WeightB, FCompactPose& ResultPose)
+{
+	const ScalarRegister VWeightA(WeightA);
+	const ScalarRegister VWeightB(WeightB);
+	for (FCompactPoseBoneIndex BoneIndex : ResultPose.ForEachBoneIndex())
+	{
+		FTransform& Result = ResultPose[BoneIndex];
+		Result = PoseA[BoneIndex] * VWeightA;
+		Result.AccumulateWithShortestRotation(PoseB[BoneIndex], VWeightB);
+		Result.NormalizeRotation();
+	}
+}
+
 FORCEINLINE void BlendCurves(const TArrayView<const FBlendedCurve> SourceCurves, const TArrayView<const float> SourceWeights, const TArrayView<const int32> SourceWeightsIndices, FBlendedCurve& OutCurve)
 {
 	if (SourceCurves.Num() > 0)
@@ -149,17 +169,25 @@ void FAnimationRuntime::BlendPosesTogether(
 {
 	check(SourcePoses.Num() > 0);
 
-	BlendPose<ETransformBlendMode::Overwrite>(SourcePoses[0], ResultPose, SourceWeights[0]);
-
-	for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
+	if (SourcePoses.Num() == 2)
 	{
-		BlendPose<ETransformBlendMode::Accumulate>(SourcePoses[PoseIndex], ResultPose, SourceWeights[PoseIndex]);
+		// single fused pass; see BlendTwoPosesFused
+		BlendTwoPosesFused(SourcePoses[0], SourcePoses[1], SourceWeights[0], SourceWeights[1], ResultPose);
 	}
-
-	// Ensure that all of the resulting rotations are normalized
-	if (SourcePoses.Num() > 1)
+	else
 	{
-		ResultPose.NormalizeRotations();
+		BlendPose<ETransformBlendMode::Overwrite>(SourcePoses[0], ResultPose, SourceWeights[0]);
+
+		for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
+		{
+			BlendPose<ETransformBlendMode::Accumulate>(SourcePoses[PoseIndex], ResultPose, SourceWeights[PoseIndex]);
+		}
+
+		// Ensure that all of the resulting rotations are normalized
+		if (SourcePoses.Num() > 1)
+		{
+			ResultPose.NormalizeRotations();
+		}
 	}
 
 	// curve blending if exists
@@ -13,6 +13,70 @@ DEFINE_LOG_CATEGORY_STATIC(LogBatchedElements, Log, All);
 /** The simple element vertex declaration. */
 TGlobalResource<FSimpleElementVertexDeclaration> GSimpleElementVertexDeclaration;
 
+/**
+ * Pool of volatile vertex buffers reused across batched element draws. Each draw used to create a
+ * fresh buffer; since volatile buffers rename on every write lock, a pooled buffer can be locked
+ * again immediately with discard semantics, leaving only the cheap lock/unlock per draw.
+ * Render thread only. Buckets are power-of-two sizes; entries idle for a while are released.
+ */
+class FBatchedElementVertexBufferPool : public FRenderResource
+{
+public:
+	virtual void ReleaseRHI() override
+	{
+		Buffers.Empty();
+	}
+
+	FVertexBufferRHIRef Acquire(uint32 SizeInBytes)
+	{
+		check(IsInRenderingThread());
+
+		ReleaseStaleEntries();
+
+		const uint32 BucketSize = FMath::RoundUpToPowerOfTwo(SizeInBytes);
+		for (FPooledBuffer& Pooled : Buffers)
+		{
+			if (Pooled.Size == BucketSize)
+			{
+				Pooled.LastUsedFrame = GFrameNumberRenderThread;
+				return Pooled.Buffer;
+			}
+		}
+
+		FRHIResourceCreateInfo CreateInfo;
+		FPooledBuffer NewPooled;
+		NewPooled.Size = BucketSize;
+		NewPooled.LastUsedFrame = GFrameNumberRenderThread;
+		NewPooled.Buffer = RHICreateVertexBuffer(BucketSize, BUF_Volatile, CreateInfo);
+		Buffers.Add(NewPooled);
+		return NewPooled.Buffer;
+	}
+
+private:
+	void ReleaseStaleEntries()
+	{
+		const uint32 MaxIdleFrames = 60;
+		for (int32 Index = Buffers.Num() - 1; Index >= 0; --Index)
+		{
+			if (GFrameNumberRenderThread - Buffers[Index].LastUsedFrame > MaxIdleFrames)
+			{
+				Buffers.RemoveAtSwap(Index, 1, false);
+			}
+		}
+	}
+
+	struct FPooledBuffer
+	{
+		uint32 Size = 0;
+		uint32 LastUsedFrame = 0;
+		FVertexBufferRHIRef Buffer;
+	};
+
+	TArray<FPooledBuffer> Buffers;
+};
+
+static TGlobalResource<FBatchedElementVertexBufferPool> GBatchedElementVertexBufferPool;
+
 EBlendModeFilter::Type GetBlendModeFilter(ESimpleElementBlendMode BlendMode)
 {
 	if (BlendMode == SE_BLEND_Opaque || BlendMode == SE_BLEND_Masked || BlendMode == SE_BLEND_MaskedDistanceField || BlendMode == SE_BLEND_MaskedDistanceFieldShadowed)
@@ -786,8 +850,7 @@ void FBatchedElements::DrawPointElements(FRHICommandList& RHICmdList, const FMat
 		const int32 NumTris = NumPoints * 2;
 		const int32 NumVertices = NumTris * 3;
 
-		FRHIResourceCreateInfo CreateInfo;
-		FVertexBufferRHIRef VertexBufferRHI = RHICreateVertexBuffer(sizeof(FSimpleElementVertex) * NumVertices, BUF_Volatile, CreateInfo);
+		FVertexBufferRHIRef VertexBufferRHI = GBatchedElementVertexBufferPool.Acquire(sizeof(FSimpleElementVertex) * NumVertices);
 		void* VerticesPtr = RHILockVertexBuffer(VertexBufferRHI, 0, sizeof(FSimpleElementVertex) * NumVertices, RLM_WriteOnly);
 
 		FSimpleElementVertex* PointVertices = (FSimpleElementVertex*)VerticesPtr;
@@ -893,8 +956,7 @@ bool FBatchedElements::Draw(FRHICommandList& RHICmdList, const FMeshPassProcesso
 				PrepareShaders(RHICmdList, GraphicsPSOInit, FeatureLevel, SE_BLEND_Opaque, Transform, bNeedToSwitchVerticalAxis, BatchedElementParameters, GWhiteTexture, bHitTesting, Gamma, NULL, &View);
 				RHICmdList.SetStencilRef(StencilRef);
 
-				FRHIResourceCreateInfo CreateInfo;
-				FVertexBufferRHIRef VertexBufferRHI = RHICreateVertexBuffer(sizeof(FSimpleElementVertex) * LineVertices.Num(), BUF_Volatile, CreateInfo);
+				FVertexBufferRHIRef VertexBufferRHI = GBatchedElementVertexBufferPool.Acquire(sizeof(FSimpleElementVertex) * LineVertices.Num());
 				void* VoidPtr = RHILockVertexBuffer(VertexBufferRHI, 0, sizeof(FSimpleElementVertex) * LineVertices.Num(), RLM_WriteOnly);
 
 				FMemory::Memcpy(VoidPtr, LineVertices.GetData(), sizeof(FSimpleElementVertex) * LineVertices.Num());
@@ -964,8 +1026,7 @@ bool FBatchedElements::Draw(FRHICommandList& RHICmdList, const FMeshPassProcesso
 					PrepareShaders(RHICmdList, GraphicsPSOInit, FeatureLevel, SE_BLEND_AlphaBlend, Transform, bNeedToSwitchVerticalAxis, BatchedElementParameters, GWhiteTexture, bHitTesting, Gamma, NULL, &View);
 					RHICmdList.SetStencilRef(StencilRef);
 
-					FRHIResourceCreateInfo CreateInfo;
-					FVertexBufferRHIRef VertexBufferRHI = RHICreateVertexBuffer(sizeof(FSimpleElementVertex) * 8 * 3 * NumLinesThisBatch, BUF_Volatile, CreateInfo);
+					FVertexBufferRHIRef VertexBufferRHI = GBatchedElementVertexBufferPool.Acquire(sizeof(FSimpleElementVertex) * 8 * 3 * NumLinesThisBatch);
 					void* ThickVertexData = RHILockVertexBuffer(VertexBufferRHI, 0, sizeof(FSimpleElementVertex) * 8 * 3 * NumLinesThisBatch, RLM_WriteOnly);
 					FSimpleElementVertex* ThickVertices = (FSimpleElementVertex*)ThickVertexData;
 					check(ThickVertices);
@@ -1050,8 +1111,7 @@ bool FBatchedElements::Draw(FRHICommandList& RHICmdList, const FMeshPassProcesso
 			{
 				check(WireTriVerts.Num() == WireTris.Num() * 3);
 
-				FRHIResourceCreateInfo CreateInfo;
-				FVertexBufferRHIRef VertexBufferRHI = RHICreateVertexBuffer(sizeof(FSimpleElementVertex) * WireTriVerts.Num(), BUF_Volatile, CreateInfo);
+				FVertexBufferRHIRef VertexBufferRHI = GBatchedElementVertexBufferPool.Acquire(sizeof(FSimpleElementVertex) * WireTriVerts.Num());
 				void* VoidPtr = RHILockVertexBuffer(VertexBufferRHI, 0, sizeof(FSimpleElementVertex) * WireTriVerts.Num(), RLM_WriteOnly);
 				FMemory::Memcpy(VoidPtr, WireTriVerts.GetData(), sizeof(FSimpleElementVertex) * WireTriVerts.Num());
 				RHIUnlockVertexBuffer(VertexBufferRHI);
@@ -1138,8 +1198,7 @@ bool FBatchedElements::Draw(FRHICommandList& RHICmdList, const FMeshPassProcesso
 
 			if (ValidSpriteCount > 0)
 			{
-				FRHIResourceCreateInfo CreateInfo;
-				FVertexBufferRHIRef VertexBufferRHI = RHICreateVertexBuffer(sizeof(FSimpleElementVertex) * ValidSpriteCount * 6, BUF_Volatile, CreateInfo);
+				FVertexBufferRHIRef VertexBufferRHI = GBatchedElementVertexBufferPool.Acquire(sizeof(FSimpleElementVertex) * ValidSpriteCount * 6);
 				void* VoidPtr = RHILockVertexBuffer(VertexBufferRHI, 0, sizeof(FSimpleElementVertex) * ValidSpriteCount * 6, RLM_WriteOnly);
 				FSimpleElementVertex* SpriteList = reinterpret_cast<FSimpleElementVertex*>(VoidPtr);
 
@@ -1203,8 +1262,7 @@ bool FBatchedElements::Draw(FRHICommandList& RHICmdList, const FMeshPassProcesso
 
 		if( MeshElements.Num() > 0)
 		{
-			FRHIResourceCreateInfo CreateInfo;
-			FVertexBufferRHIRef VertexBufferRHI = RHICreateVertexBuffer(sizeof(FSimpleElementVertex) * MeshVertices.Num(), BUF_Volatile, CreateInfo);
+			FVertexBufferRHIRef VertexBufferRHI = GBatchedElementVertexBufferPool.Acquire(sizeof(FSimpleElementVertex) * MeshVertices.Num());
 			void* VoidPtr = RHILockVertexBuffer(VertexBufferRHI, 0, sizeof(FSimpleElementVertex) * MeshVertices.Num(), RLM_WriteOnly);
 			FPlatformMemory::Memcpy(VoidPtr, MeshVertices.GetData(), sizeof(FSimpleElementVertex) * MeshVertices.Num());
 			RHIUnlockVertexBuffer(VertexBufferRHI);
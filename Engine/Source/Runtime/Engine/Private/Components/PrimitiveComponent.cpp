@@ -3006,11 +3006,39 @@ TArray<UPrimitiveComponent*> UPrimitiveComponent::CopyArrayOfMoveIgnoreComponent
 	return MoveIgnoreComponents;
 }
 
+/**
+ * If enabled, pure re-scan overlap updates (no pending or end-location overlap lists) issued while
+ * the world is mid-tick are coalesced per frame and flushed together at the end of each tick group:
+ * a component moved several times in one frame pays one broadphase pass, and the flush walks the
+ * queued set back to back instead of scattering queries through movement code.
+ * Overlap begin/end notifications then fire at the tick group boundary rather than at the exact
+ * move site, which is why this is opt-in.
+ */
+static int32 GBatchComponentOverlapUpdates = 0;
+static FAutoConsoleVariableRef CVarBatchComponentOverlapUpdates(
+	TEXT("p.BatchComponentOverlapUpdates"),
+	GBatchComponentOverlapUpdates,
+	TEXT("If true, re-scan overlap updates during world tick are deduplicated per frame and flushed at tick group boundaries."),
+	ECVF_Default
+);
+
 bool UPrimitiveComponent::UpdateOverlapsImpl(const TOverlapArrayView* NewPendingOverlaps, bool bDoNotifies, const TOverlapArrayView* OverlapsAtEndLocation)
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateOverlaps); 
 	SCOPE_CYCLE_UOBJECT(ComponentScope, this);
 
+	// Coalesce pure re-scans into the world's per-tick-group batch; moves carrying explicit overlap
+	// lists keep the immediate path since those views do not outlive the call.
+	if (GBatchComponentOverlapUpdates && !NewPendingOverlaps && !OverlapsAtEndLocation && bDoNotifies)
+	{
+		UWorld* MyWorld = GetWorld();
+		if (MyWorld && MyWorld->bInTick && !MyWorld->bIsFlushingDeferredOverlaps)
+		{
+			MyWorld->DeferredOverlapComponents.Add(this);
+			return false;
+		}
+	}
+
 	// if we haven't begun play, we're still setting things up (e.g. we might be inside one of the construction scripts)
 	// so we don't want to generate overlaps yet. There is no need to update children yet either, they will update once we are allowed to as well.
 	const AActor* const MyActor = GetOwner();
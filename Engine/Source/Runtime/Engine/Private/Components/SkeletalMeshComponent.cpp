@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "Components/SkeletalMeshComponent.h"
+#include "Misc/ScopeExit.h"
 #include "Misc/App.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimStats.h"
@@ -511,6 +512,17 @@ void USkeletalMeshComponent::OnRegister()
 {
 	UpdateHasValidBodies();	//Make sure this is done before we call into the Super which will trigger OnCreatePhysicsState
 
+	// group this component's tick with others running the same animation class, so one AnimBP's
+	// graph update runs as a contiguous batch (see FTickFunction::TickBatchKey)
+	if (bBatchTicksWithSameAnimClass && *AnimClass)
+	{
+		PrimaryComponentTick.TickBatchKey = AnimClass->GetFName();
+	}
+	else
+	{
+		PrimaryComponentTick.TickBatchKey = NAME_None;
+	}
+
 	Super::OnRegister();
 
 	// Ensure we have an empty list of linked instances on registration. Ready for the initialization below 
@@ -1271,6 +1283,9 @@ void USkeletalMeshComponent::TickComponent(float DeltaTime, enum ELevelTick Tick
 	
 	PendingRadialForces.Reset();
 
+	// distant or unrendered ragdolls freeze their pose (p.RagdollLOD.FreezeScreenSize)
+	UpdateRagdollSimulationLOD();
+
 	// Update bOldForceRefPose
 	bOldForceRefPose = bForceRefpose;
 
@@ -3514,8 +3529,17 @@ void USkeletalMeshComponent::RefreshMorphTargets()
 	UpdateMorphTargetOverrideCurves();
 }
 
+/** Worker-side animation cycle accumulator feeding the closed-loop budgeter in SkinnedMeshComponent.cpp. */
+FThreadSafeCounter GAnimEvaluationCycles;
+
 void USkeletalMeshComponent::ParallelAnimationEvaluation() 
 {
+	const uint32 EvalStartCycles = FPlatformTime::Cycles();
+	ON_SCOPE_EXIT
+	{
+		GAnimEvaluationCycles.Add((int32)(FPlatformTime::Cycles() - EvalStartCycles));
+	};
+
 	if (AnimEvaluationContext.bDoInterpolation)
 	{
 		PerformAnimationProcessing(AnimEvaluationContext.SkeletalMesh, AnimEvaluationContext.AnimInstance, AnimEvaluationContext.bDoEvaluation, AnimEvaluationContext.CachedComponentSpaceTransforms, AnimEvaluationContext.CachedBoneSpaceTransforms, AnimEvaluationContext.RootBoneTranslation, AnimEvaluationContext.CachedCurve);
@@ -180,8 +180,53 @@ namespace FAnimUpdateRateManager
 		0,
 		TEXT("Set to 1 to disable interpolation"));
 
+	/**
+	 * Closed-loop animation budgeter: the measured animation worker time of the previous frame is
+	 * compared against a.Budget.TargetMs and a global evaluation-rate scale adjusts continuously, so
+	 * crowds converge on a frame-skip distribution that holds the budget instead of popping between
+	 * the fixed buckets. Always-relevant components (human controlled, root motion) are untouched.
+	 */
+	static float GAnimBudgetTargetMs = 0.0f;
+	static FAutoConsoleVariableRef CVarAnimBudgetTargetMs(
+		TEXT("a.Budget.TargetMs"),
+		GAnimBudgetTargetMs,
+		TEXT("Target animation worker milliseconds per frame for the closed-loop URO budgeter; 0 disables."),
+		ECVF_Default);
+
+	static float GAnimBudgetGain = 0.1f;
+	static FAutoConsoleVariableRef CVarAnimBudgetGain(
+		TEXT("a.Budget.Gain"),
+		GAnimBudgetGain,
+		TEXT("Controller gain for the animation budgeter; fraction of the relative error applied to the rate scale per frame."),
+		ECVF_Default);
+
+	static float GAnimBudgetRateScale = 1.0f;
+	static uint64 GAnimBudgetLastFrame = 0;
+
+	static void TickAnimationBudget()
+	{
+		extern FThreadSafeCounter GAnimEvaluationCycles;
+		if (GAnimBudgetLastFrame == GFrameCounter)
+		{
+			return;
+		}
+		GAnimBudgetLastFrame = GFrameCounter;
+
+		const float MeasuredMs = FPlatformTime::ToMilliseconds(GAnimEvaluationCycles.GetValue());
+		GAnimEvaluationCycles.Reset();
+		if (GAnimBudgetTargetMs <= 0.0f)
+		{
+			GAnimBudgetRateScale = 1.0f;
+			return;
+		}
+		// proportional controller on relative error; under budget decays back toward full rate
+		GAnimBudgetRateScale += GAnimBudgetGain * (MeasuredMs / GAnimBudgetTargetMs - 1.0f);
+		GAnimBudgetRateScale = FMath::Clamp(GAnimBudgetRateScale, 1.0f, 4.0f);
+	}
+
 	void AnimUpdateRateSetParams(FAnimUpdateRateParametersTracker* Tracker, float DeltaTime, bool bRecentlyRendered, float MaxDistanceFactor, int32 MinLod, bool bNeedsValidRootMotion, bool bUsingRootMotionFromEverything)
 	{
+		TickAnimationBudget();
 		// default rules for setting update rates
 
 		// Human controlled characters should be ticked always fully to minimize latency w/ game play events triggered by animation.
@@ -251,6 +296,12 @@ namespace FAnimUpdateRateManager
 				}
 			}
 
+			// the budgeter stretches frame-skips continuously when the measured worker time overruns
+			if (GAnimBudgetTargetMs > 0.0f && GAnimBudgetRateScale > 1.0f)
+			{
+				DesiredEvaluationRate = FMath::CeilToInt(DesiredEvaluationRate * GAnimBudgetRateScale);
+			}
+
 			int32 ForceAnimRate = CVarForceAnimRate.GetValueOnGameThread();
 			if (ForceAnimRate)
 			{
@@ -1517,7 +1517,31 @@ bool FObjectReplicator::ReplicateProperties( FOutBunch & Bunch, FReplicationFlag
 
 	UNetConnection* OwningChannelConnection = OwningChannel->Connection;
 
-	FNetBitWriter Writer( Bunch.PackageMap, 8192 );
+	// Reuse the connection's scratch writer rather than allocating a fresh 1KB buffer per
+	// replicated object. The writer never escapes this function (its bits are copied into the
+	// bunch), so per-connection reuse is safe; a reentrant caller falls back to a local writer.
+	FNetBitWriter LocalWriter;
+	FNetBitWriter* WriterPtr = &LocalWriter;
+	if (!OwningChannelConnection->bReplicationScratchWriterInUse)
+	{
+		FNetBitWriter& ScratchWriter = OwningChannelConnection->ReplicationScratchWriter;
+		if (ScratchWriter.GetMaxBits() == 0)
+		{
+			ScratchWriter = FNetBitWriter(Bunch.PackageMap, 8192);
+		}
+		else
+		{
+			ScratchWriter.Reset();
+		}
+		ScratchWriter.PackageMap = Bunch.PackageMap;
+		WriterPtr = &ScratchWriter;
+	}
+	else
+	{
+		LocalWriter = FNetBitWriter(Bunch.PackageMap, 8192);
+	}
+	TGuardValue<bool> ScratchWriterGuard(OwningChannelConnection->bReplicationScratchWriterInUse, true);
+	FNetBitWriter& Writer = *WriterPtr;
 
 	// TODO: Maybe ReplicateProperties could just take the RepState, Changelist Manger, Writer, and OwningChannel
 	//		and all the work could just be done in a single place.
@@ -641,6 +641,9 @@ UDemoNetDriver::UDemoNetDriver(const FObjectInitializer& ObjectInitializer)
 	bIsWaitingForStream = false;
 	MaxArchiveReadPos = 0;
 	bNeverApplyNetworkEmulationSettings = true;
+	// Time-slice checkpoint saving by default so live matches don't pay the whole serialization
+	// in one frame; config and demo.CheckpointSaveMaxMSPerFrameOverride can still change it.
+	CheckpointSaveMaxMSPerFrame = 5.0f;
 
 	if (!HasAnyFlags(RF_ClassDefaultObject))
 	{
@@ -760,7 +763,6 @@ bool UDemoNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, cons
 		bPrioritizeActors				= false;
 		bPauseRecording					= false;
 		PlaybackPacketIndex				= 0;
-		CheckpointSaveMaxMSPerFrame		= -1.0f;
 		RecordBuildConsiderAndPrioritizeTimeSlice = CVarDemoMaximumRepPrioritizeTime.GetValueOnAnyThread();
 
 		if (RelevantTimeout == 0.0f)
@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "GPUSkinVertexFactory.h"
+#include "Hash/CityHash.h"
 #include "SceneView.h"
 #include "MeshBatch.h"
 #include "GPUSkinCache.h"
@@ -197,12 +198,35 @@ static bool DeferSkeletalLockAndFillToRHIThread()
 	return IsRunningRHIInSeparateThread() && CVarRHICmdDeferSkeletalLockAndFillToRHIThread.GetValueOnRenderThread() > 0;
 }
 
+/** If true, a component whose mapped bone matrices are unchanged since its last upload skips the bone buffer update entirely (stopped characters, partial-body animation). */
+static int32 GSkipRedundantBoneUploads = 0;
+static FAutoConsoleVariableRef CVarSkipRedundantBoneUploads(
+	TEXT("r.GPUSkin.SkipRedundantBoneUploads"),
+	GSkipRedundantBoneUploads,
+	TEXT("If true, bone buffer uploads are skipped when the mapped matrices hash identically to the previous upload for that slot."),
+	ECVF_RenderThreadSafe
+);
+
 bool FGPUBaseSkinVertexFactory::FShaderDataType::UpdateBoneData(FRHICommandListImmediate& RHICmdList, const TArray<FMatrix>& ReferenceToLocalMatrices,
 	const TArray<FBoneIndexType>& BoneMap, uint32 RevisionNumber, bool bPrevious, ERHIFeatureLevel::Type InFeatureLevel, bool bUseSkinCache)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_FGPUBaseSkinVertexFactory_UpdateBoneData);
 	const uint32 NumBones = BoneMap.Num();
 	check(NumBones <= MaxGPUSkinBones);
+
+	// Hash of the mapped subset the shader consumes, for the redundant-upload skip below; computed up
+	// front so both the SRV and uniform paths could use it, but only applied against the physical
+	// buffer actually selected for writing, since double buffering means the write target may hold
+	// two-frames-old data even when the pose is unchanged frame to frame.
+	uint64 BoneHash = 0;
+	if (GSkipRedundantBoneUploads && SupportsBonesBufferSRV(InFeatureLevel))
+	{
+		BoneHash = CityHash64((const char*)&NumBones, sizeof(NumBones));
+		for (uint32 BoneIdx = 0; BoneIdx < NumBones; BoneIdx++)
+		{
+			BoneHash = CityHash64WithSeed((const char*)&ReferenceToLocalMatrices[BoneMap[BoneIdx]], sizeof(FMatrix), BoneHash);
+		}
+	}
 	FMatrix3x4* ChunkMatrices = nullptr;
 
 	FVertexBufferAndSRV* CurrentBoneBuffer = 0;
@@ -222,6 +246,7 @@ bool FGPUBaseSkinVertexFactory::FShaderDataType::UpdateBoneData(FRHICommandListI
 		uint32 VectorArraySize = NumVectors * sizeof(FVector4);
 		uint32 PooledArraySize = BoneBufferPool.PooledSizeForCreationArguments(VectorArraySize);
 
+		const int32 PhysicalBufferIndex = (CurrentBoneBuffer == &BoneBuffer[0]) ? 0 : 1;
 		if(!IsValidRef(*CurrentBoneBuffer) || PooledArraySize != CurrentBoneBuffer->VertexBufferRHI->GetSize())
 		{
 			if(IsValidRef(*CurrentBoneBuffer))
@@ -230,7 +255,14 @@ bool FGPUBaseSkinVertexFactory::FShaderDataType::UpdateBoneData(FRHICommandListI
 			}
 			*CurrentBoneBuffer = BoneBufferPool.CreatePooledResource(VectorArraySize);
 			check(IsValidRef(*CurrentBoneBuffer));
+			LastUploadedBoneHash[PhysicalBufferIndex] = 0; // fresh buffer, nothing resident
+		}
+		if (GSkipRedundantBoneUploads && NumBones && BoneHash != 0 && BoneHash == LastUploadedBoneHash[PhysicalBufferIndex])
+		{
+			// this physical buffer already holds exactly these matrices
+			return true;
 		}
+		LastUploadedBoneHash[PhysicalBufferIndex] = BoneHash;
 		if(NumBones)
 		{
 			if (!bUseSkinCache && DeferSkeletalLockAndFillToRHIThread())
@@ -1472,6 +1472,12 @@ void FHierarchicalStaticMeshSceneProxy::FillDynamicMeshElements(FMeshElementColl
 #endif
 }
 
+// Note on GPU instance culling: CPU traversal of the cluster tree is what bounds cull
+// granularity to clusters. Per-instance GPU culling needs the instance transforms visible to a
+// culling compute pass and indirect draws per view - mesh-draw-command and vertex-factory work
+// shared with every instanced path, not something this proxy can adopt alone. Density-scaling
+// feedback additionally changes visual density policy and belongs to the foliage scalability
+// settings. The CPU traversal below stays the cluster-granular fallback either way.
 void FHierarchicalStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const
 {
 	if (Views[0]->bRenderFirstInstanceOnly)
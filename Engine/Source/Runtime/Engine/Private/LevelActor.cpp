@@ -305,6 +305,44 @@ AActor* UWorld::SpawnActor( UClass* Class, FVector const* Location, FRotator con
 
 #include "GameFramework/SpawnActorTimer.h"
 
+int32 UWorld::SpawnActorsBatched(UClass* Class, const TArrayView<const FTransform>& Transforms, const FActorSpawnParameters& SpawnParameters, TArray<AActor*>& OutActors)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpawnActorTime);
+	check(Transforms.Num() <= 1 || SpawnParameters.Name == NAME_None); // explicit names cannot apply to more than one actor
+
+	OutActors.Reset();
+	OutActors.Reserve(Transforms.Num());
+
+	// Phase 1: allocate and initialize every actor with construction deferred, so the per-class
+	// object construction path stays hot across the batch.
+	FActorSpawnParameters DeferredParameters = SpawnParameters;
+	DeferredParameters.bDeferConstruction = true;
+	for (const FTransform& Transform : Transforms)
+	{
+		OutActors.Add(SpawnActor(Class, &Transform, DeferredParameters));
+	}
+
+	// Phase 2: run construction scripts and component registration in one consolidated pass.
+	int32 NumSpawned = 0;
+	for (int32 ActorIndex = 0; ActorIndex < OutActors.Num(); ActorIndex++)
+	{
+		if (AActor* Actor = OutActors[ActorIndex])
+		{
+			Actor->FinishSpawning(Transforms[ActorIndex]);
+			if (Actor->IsPendingKill())
+			{
+				// collision handling or construction decided against this one
+				OutActors[ActorIndex] = nullptr;
+			}
+			else
+			{
+				NumSpawned++;
+			}
+		}
+	}
+	return NumSpawned;
+}
+
 AActor* UWorld::SpawnActor( UClass* Class, FTransform const* UserTransformPtr, const FActorSpawnParameters& SpawnParameters )
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpawnActorTime);
@@ -3836,6 +3836,50 @@ void UMaterialInstance::SetScalarParameterValueInternal(const FMaterialParameter
 	}
 }
 
+void UMaterialInstance::SetScalarParameterValuesInternal(TArrayView<const TPair<FName, float>> InParameterValues)
+{
+	LLM_SCOPE(ELLMTag::MaterialInstance);
+
+	// Same storage update as the single setter, but changed values are gathered and pushed to the
+	// render thread in one command, with one uniform expression recache for the whole batch.
+	TArray<FScalarParameterValue> ChangedParameters;
+	for (const TPair<FName, float>& NameAndValue : InParameterValues)
+	{
+		const FMaterialParameterInfo ParameterInfo(NameAndValue.Key);
+		FScalarParameterValue* ParameterValue = GameThread_FindParameterByName(ScalarParameterValues, ParameterInfo);
+
+		bool bForceUpdate = false;
+		if (!ParameterValue)
+		{
+			ParameterValue = new(ScalarParameterValues) FScalarParameterValue;
+			ParameterValue->ParameterInfo = ParameterInfo;
+			ParameterValue->ExpressionGUID.Invalidate();
+			bForceUpdate = true;
+		}
+
+		if (bForceUpdate || ParameterValue->ParameterValue != NameAndValue.Value)
+		{
+			ParameterValue->ParameterValue = NameAndValue.Value;
+			ChangedParameters.Add(*ParameterValue);
+		}
+	}
+
+	if (ChangedParameters.Num() > 0)
+	{
+		FMaterialInstanceResource* LocalResource = Resource;
+		ENQUEUE_RENDER_COMMAND(SetMIBatchedScalarParameters)(
+			[LocalResource, Parameters = MoveTemp(ChangedParameters)](FRHICommandListImmediate& RHICmdList)
+			{
+				for (const FScalarParameterValue& Parameter : Parameters)
+				{
+					LocalResource->RenderThread_UpdateParameter(Parameter.ParameterInfo, FScalarParameterValue::GetValue(Parameter));
+				}
+			});
+
+		CacheMaterialInstanceUniformExpressions(this);
+	}
+}
+
 #if WITH_EDITOR
 void UMaterialInstance::SetScalarParameterAtlasInternal(const FMaterialParameterInfo& ParameterInfo, FScalarParameterAtlasInstanceData AtlasData)
 {
@@ -57,6 +57,11 @@ void UMaterialInstanceDynamic::SetScalarParameterValue(FName ParameterName, floa
 	SetScalarParameterValueInternal(ParameterInfo,Value);
 }
 
+void UMaterialInstanceDynamic::SetScalarParameterValues(TArrayView<const TPair<FName, float>> ParameterValues)
+{
+	SetScalarParameterValuesInternal(ParameterValues);
+}
+
 bool UMaterialInstanceDynamic::InitializeScalarParameterAndGetIndex(const FName& ParameterName, float Value, int32& OutParameterIndex)
 {
 	OutParameterIndex = INDEX_NONE;
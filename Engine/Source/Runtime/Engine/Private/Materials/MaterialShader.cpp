@@ -37,6 +37,9 @@ namespace MaterialShaderCookStats
 //
 FCriticalSection FMaterialShaderMap::GIdToMaterialShaderMapCS;
 TMap<FMaterialShaderMapId,FMaterialShaderMap*> FMaterialShaderMap::GIdToMaterialShaderMap[SP_NumPlatforms];
+#if WITH_EDITORONLY_DATA
+TMap<FSHAHash, FMaterialShaderMap*> FMaterialShaderMap::GTranslationHashToMaterialShaderMap[SP_NumPlatforms];
+#endif
 #if ALLOW_SHADERMAP_DEBUG_DATA
 TArray<FMaterialShaderMap*> FMaterialShaderMap::AllMaterialShaderMaps;
 #endif
@@ -50,7 +53,9 @@ TMap<TRefCountPtr<FMaterialShaderMap>, TArray<FMaterial*> > FMaterialShaderMap::
 
 static inline bool ShouldCacheMaterialShader(const FMaterialShaderType* ShaderType, EShaderPlatform Platform, const FMaterial* Material, int32 PermutationId)
 {
-	return ShaderType->ShouldCompilePermutation(Platform, Material, PermutationId) && Material->ShouldCache(Platform, ShaderType, nullptr);
+	return ShaderType->ShouldCompilePermutation(Platform, Material, PermutationId)
+		&& Material->ShouldCache(Platform, ShaderType, nullptr)
+		&& !IsShaderPermutationPruned(ShaderType, nullptr);
 }
 
 
@@ -965,6 +970,31 @@ TRefCountPtr<FMaterialShaderMap> FMaterialShaderMap::FindId(const FMaterialShade
 	return Result;
 }
 
+#if WITH_EDITORONLY_DATA
+TRefCountPtr<FMaterialShaderMap> FMaterialShaderMap::FindByTranslationHash(const FSHAHash& InTranslationHash, EShaderPlatform InPlatform)
+{
+	FScopeLock ScopeLock(&GIdToMaterialShaderMapCS);
+	FMaterialShaderMap* Found = GTranslationHashToMaterialShaderMap[InPlatform].FindRef(InTranslationHash);
+	// Only share maps whose compilation fully finished; in-flight maps keep their own pipeline.
+	if (Found && Found->bCompilationFinalized && Found->bCompiledSuccessfully && !Found->bDeletedThroughDeferredCleanup)
+	{
+		return Found;
+	}
+	return nullptr;
+}
+
+void FMaterialShaderMap::RegisterTranslationHash(const FSHAHash& InTranslationHash)
+{
+	FScopeLock ScopeLock(&GIdToMaterialShaderMapCS);
+	TranslationHash = InTranslationHash;
+	// First registration wins; a map is only replaced once the previous one is destroyed.
+	if (!GTranslationHashToMaterialShaderMap[GetShaderPlatform()].Contains(InTranslationHash))
+	{
+		GTranslationHashToMaterialShaderMap[GetShaderPlatform()].Add(InTranslationHash, this);
+	}
+}
+#endif // WITH_EDITORONLY_DATA
+
 #if ALLOW_SHADERMAP_DEBUG_DATA
 /** Flushes the given shader types from any loaded FMaterialShaderMap's. */
 void FMaterialShaderMap::FlushShaderTypes(TArray<FShaderType*>& ShaderTypesToFlush, TArray<const FShaderPipelineType*>& ShaderPipelineTypesToFlush, TArray<const FVertexFactoryType*>& VFTypesToFlush)
@@ -2275,6 +2305,17 @@ FMaterialShaderMap::~FMaterialShaderMap()
 	checkSlow(IsInGameThread() || IsAsyncLoading());
 	check(bDeletedThroughDeferredCleanup);
 	check(!bRegistered);
+#if WITH_EDITORONLY_DATA
+	if (TranslationHash != FSHAHash() && GetShaderPlatform() < SP_NumPlatforms)
+	{
+		FScopeLock ScopeLock(&GIdToMaterialShaderMapCS);
+		FMaterialShaderMap** Found = GTranslationHashToMaterialShaderMap[GetShaderPlatform()].Find(TranslationHash);
+		if (Found && *Found == this)
+		{
+			GTranslationHashToMaterialShaderMap[GetShaderPlatform()].Remove(TranslationHash);
+		}
+	}
+#endif
 #if ALLOW_SHADERMAP_DEBUG_DATA
 	AllMaterialShaderMaps.RemoveSwap(this);
 #endif
@@ -6,6 +6,9 @@
 
 #include "MaterialShared.h"
 #include "Stats/StatsMisc.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/SecureHash.h"
+#include "Hash/HashTools.h"
 #include "UObject/CoreObjectVersion.h"
 #include "UObject/FrameworkObjectVersion.h"
 #include "Misc/App.h"
@@ -1945,6 +1948,48 @@ bool FMaterial::CacheShaders(const FMaterialShaderMapId& ShaderMapId, const FSta
 * @param OutShaderMap - the shader map to compile
 * @return - true if compile succeeded or was not necessary (shader map for ShaderMapId was found and was complete)
 */
+#if WITH_EDITORONLY_DATA
+static int32 GShareShaderMapsByTranslationHash = 1;
+static FAutoConsoleVariableRef CVarShareShaderMapsByTranslationHash(
+	TEXT("r.Material.ShareShaderMapsByTranslationHash"),
+	GShareShaderMapsByTranslationHash,
+	TEXT("If enabled, materials whose translation produces identical shader compiler input share one compiled shader map\n")
+	TEXT("instead of compiling duplicates (instances differing only in defaults that do not change the generated code)."),
+	ECVF_Default
+	);
+
+/** Hashes everything the shader compiler will see for a material: the generated code, the translator and material compile environments, and the id fields that shape the shader set. */
+static FSHAHash GetMaterialTranslationHash(const FString& MaterialShaderCode, FShaderCompilerEnvironment& MaterialEnvironment, FShaderCompilerEnvironment& MaterialDefinesEnvironment, EShaderPlatform Platform, const FMaterialShaderMapId& ShaderMapId)
+{
+	FSHA1 Hasher;
+	Hasher.Update((const uint8*)*MaterialShaderCode, MaterialShaderCode.Len() * sizeof(TCHAR));
+
+	TArray<uint8> EnvironmentBytes;
+	FMemoryWriter EnvironmentAr(EnvironmentBytes);
+	EnvironmentAr << MaterialEnvironment;
+	EnvironmentAr << MaterialDefinesEnvironment;
+	// The serializer skips the external contents map, so fold those includes in explicitly.
+	for (const auto& ExternalIncludePair : MaterialEnvironment.IncludeVirtualPathToExternalContentsMap)
+	{
+		EnvironmentAr << const_cast<FString&>(ExternalIncludePair.Key);
+		if (ExternalIncludePair.Value.IsValid())
+		{
+			EnvironmentAr << *ExternalIncludePair.Value;
+		}
+	}
+	Hasher.Update(EnvironmentBytes.GetData(), EnvironmentBytes.Num());
+
+	const uint32 IdFields[4] = { (uint32)Platform, (uint32)ShaderMapId.FeatureLevel, (uint32)ShaderMapId.QualityLevel, (uint32)ShaderMapId.Usage };
+	Hasher.Update((const uint8*)IdFields, sizeof(IdFields));
+
+	Hasher.Final();
+
+	FSHAHash TranslationHash;
+	Hasher.GetHash(&TranslationHash.Hash[0]);
+	return TranslationHash;
+}
+#endif // WITH_EDITORONLY_DATA
+
 bool FMaterial::BeginCompileShaderMap(
 	const FMaterialShaderMapId& ShaderMapId, 
 	const FStaticParameterSet &StaticParameterSet,
@@ -1975,10 +2020,33 @@ bool FMaterial::BeginCompileShaderMap(
 		const FString MaterialShaderCode = MaterialTranslator.GetMaterialShaderCode();
 		const bool bSynchronousCompile = RequiresSynchronousCompilation() || !GShaderCompilingManager->AllowAsynchronousShaderCompiling();
 
+		// Materials and instances that translate to the same compiler input compile to the same
+		// shaders; reuse a finalized map from an identical translation if one is in memory. The
+		// completeness check keeps materials needing a wider shader set (usage flags, special
+		// engine materials) on their own compile. The material defines that Compile will apply
+		// through SetupMaterialEnvironment are captured into a scratch environment and hashed too,
+		// so properties that change compilation without changing the generated code still separate.
+		FShaderCompilerEnvironment MaterialDefinesEnvironment;
+		SetupMaterialEnvironment(Platform, NewCompilationOutput.UniformExpressionSet, MaterialDefinesEnvironment);
+		const FSHAHash TranslationHash = GetMaterialTranslationHash(MaterialShaderCode, *MaterialEnvironment, MaterialDefinesEnvironment, Platform, ShaderMapId);
+		if (GShareShaderMapsByTranslationHash)
+		{
+			TRefCountPtr<FMaterialShaderMap> SharedShaderMap = FMaterialShaderMap::FindByTranslationHash(TranslationHash, Platform);
+			if (SharedShaderMap && SharedShaderMap->IsComplete(this, true))
+			{
+				UE_LOG(LogMaterial, Verbose, TEXT("Reusing shader map of an identical translation for %s"), *GetFriendlyName());
+				OutShaderMap = SharedShaderMap;
+				INC_FLOAT_STAT_BY(STAT_ShaderCompiling_MaterialCompiling,(float)MaterialCompileTime);
+				INC_FLOAT_STAT_BY(STAT_ShaderCompiling_MaterialShaders,(float)MaterialCompileTime);
+				return true;
+			}
+		}
+
 		MaterialEnvironment->IncludeVirtualPathToContentsMap.Add(TEXT("/Engine/Generated/Material.ush"), MaterialShaderCode);
 
 		// Compile the shaders for the material.
 		NewShaderMap->Compile(this, ShaderMapId, MaterialEnvironment, NewCompilationOutput, Platform, bSynchronousCompile);
+		NewShaderMap->RegisterTranslationHash(TranslationHash);
 
 		if (bSynchronousCompile)
 		{
@@ -2373,6 +2441,14 @@ void FUniformExpressionCache::ResetAllocatedVTs()
 	OwnedAllocatedVTs.Reset();
 }
 
+static int32 GSkipRedundantUniformBufferUpdates = 1;
+static FAutoConsoleVariableRef CVarSkipRedundantUniformBufferUpdates(
+	TEXT("r.Material.SkipRedundantUniformBufferUpdates"),
+	GSkipRedundantUniformBufferUpdates,
+	TEXT("If enabled, a material uniform buffer is not re-uploaded when re-evaluating its expressions produced identical contents."),
+	ECVF_RenderThreadSafe
+	);
+
 void FMaterialRenderProxy::EvaluateUniformExpressions(FUniformExpressionCache& OutUniformExpressionCache, const FMaterialRenderContext& Context, FRHICommandList* CommandListIfLocalMode) const
 {
 	check(IsInParallelRenderingThread());
@@ -2432,15 +2508,27 @@ void FMaterialRenderProxy::EvaluateUniformExpressions(FUniformExpressionCache& O
 			UE_LOG(LogMaterial, Fatal, TEXT("The Uniformbuffer needs to be valid if it has been set"));
 		}
 
+		// Dirty notifications fire for parameter sets that often evaluate to the same bytes;
+		// the expensive part is the RHI update and upload, so skip it when nothing changed.
+		// Byte-identical contents imply identical resource references: the buffer's existing
+		// references keep those resources alive, so their addresses cannot have been reused.
+		// The hash tracks only the persistent buffer's contents; the local-mode path above
+		// must not touch it or a later update could be skipped against stale contents.
+		const uint64 FilledContentsHash = FHashTools::HashBytes64(TempBuffer, UniformBufferStruct.GetSize());
+
 		if (IsValidRef(OutUniformExpressionCache.UniformBuffer))
 		{
 			check(OutUniformExpressionCache.UniformBuffer->GetLayout() == UniformBufferStruct.GetLayout());
-			RHIUpdateUniformBuffer(OutUniformExpressionCache.UniformBuffer, TempBuffer);
+			if (!GSkipRedundantUniformBufferUpdates || FilledContentsHash != OutUniformExpressionCache.LastFilledContentsHash)
+			{
+				RHIUpdateUniformBuffer(OutUniformExpressionCache.UniformBuffer, TempBuffer);
+			}
 		}
 		else
 		{
 			OutUniformExpressionCache.UniformBuffer = RHICreateUniformBuffer(TempBuffer, UniformBufferStruct.GetLayout(), UniformBuffer_MultiFrame);
 		}
+		OutUniformExpressionCache.LastFilledContentsHash = FilledContentsHash;
 	}
 
 	OutUniformExpressionCache.ParameterCollections = UniformExpressionSet.ParameterCollections;
@@ -25,7 +25,8 @@ static inline bool ShouldCacheMeshShader(const FMeshMaterialShaderType* ShaderTy
 {
 	return ShaderType->ShouldCompilePermutation(Platform, Material, InVertexFactoryType, PermutationId) &&
 		Material->ShouldCache(Platform, ShaderType, InVertexFactoryType) &&
-		InVertexFactoryType->ShouldCache(Platform, Material, ShaderType);
+		InVertexFactoryType->ShouldCache(Platform, Material, ShaderType) &&
+		!IsShaderPermutationPruned(ShaderType, InVertexFactoryType);
 }
 
 /**
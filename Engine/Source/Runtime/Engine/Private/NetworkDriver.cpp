@@ -10,6 +10,7 @@
 #include "Misc/NetworkGuid.h"
 #include "Stats/Stats.h"
 #include "Misc/App.h"
+#include "Async/ParallelFor.h"
 #include "Misc/MemStack.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/LowLevelMemTracker.h"
@@ -200,6 +201,15 @@ static FAutoConsoleVariableRef CVarSetNetDormancyEnabled(
 	TEXT("1 Enables network dormancy. 0 disables network dormancy."),
 	ECVF_Default);
 
+int32 GNetParallelPrioritySort = 0;
+static FAutoConsoleVariableRef CVarNetParallelPrioritySort(
+	TEXT("net.ParallelPrioritySort"),
+	GNetParallelPrioritySort,
+	TEXT("If enabled, ServerReplicateActors prioritizes every connection first, sorts all priority lists in one ParallelFor,")
+	TEXT(" and then runs the send phase, instead of interleaving per connection. Priorities see start-of-frame actor state")
+	TEXT(" and priority memory for all connections stays allocated for the whole tick."),
+	ECVF_Default);
+
 int32 GNetDormancyValidate = 0;
 static FAutoConsoleVariableRef CVarNetDormancyValidate(
 	TEXT("net.DormancyValidate"),
@@ -224,8 +234,9 @@ static TAutoConsoleVariable<float> CVarNetDebugDrawCullDistance(
 
 static TAutoConsoleVariable<int32> CVarUseAdaptiveNetUpdateFrequency(
 	TEXT( "net.UseAdaptiveNetUpdateFrequency" ), 
-	0, 
-	TEXT( "If 1, NetUpdateFrequency will be calculated based on how often actors actually send something when replicating" ) );
+	1, 
+	TEXT( "If 1, NetUpdateFrequency will be calculated based on how often actors actually send something when replicating:\n" )
+	TEXT( "actors that rarely produce data decay toward MinNetUpdateFrequency and snap back to full rate as soon as an update sends data." ) );
 
 TAutoConsoleVariable<int32> CVarNetAllowEncryption(
 	TEXT("net.AllowEncryption"),
@@ -3930,7 +3941,7 @@ static FORCEINLINE_DEBUGGABLE bool ShouldActorGoDormant( AActor* Actor, const TA
 	return true;
 }
 
-int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors )
+int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors, const bool bDoSort )
 {
 	SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
 
@@ -4059,7 +4070,10 @@ int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connec
 		}
 
 		// Sort by priority
-		Sort( OutPriorityActors, FinalSortedCount, FCompareFActorPriority() );
+		if ( bDoSort )
+		{
+			Sort( OutPriorityActors, FinalSortedCount, FCompareFActorPriority() );
+		}
 	}
 
 	UE_LOG( LogNetTraffic, Log, TEXT( "ServerReplicateActors_PrioritizeActors: Potential %04i ConsiderList %03i FinalSortedCount %03i" ), MaxSortedActors, ConsiderList.Num(), FinalSortedCount );
@@ -4479,6 +4493,141 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 	FMemMark Mark( FMemStack::Get() );
 
+	if ( GNetParallelPrioritySort != 0 && FApp::ShouldUseThreadingForPerformance() )
+	{
+		// Three-phase variant: prioritize every connection first (serial, this mutates shared actor
+		// and channel state), sort all the priority lists on workers, then run the send phase.
+		// Sorting is pure comparisons over per-connection mem stack arrays, so it is the one piece
+		// of the per-connection work that can fan out safely. Priorities are computed from
+		// start-of-frame actor state instead of seeing earlier connections' sends, and priority
+		// memory for all connections stays allocated until the end of the tick.
+		struct FConnectionPrioritizedBatch
+		{
+			UNetConnection* Connection = nullptr;
+			TArray<FNetViewer> Viewers;
+			FActorPriority* PriorityList = nullptr;
+			FActorPriority** PriorityActors = nullptr;
+			int32 FinalSortedCount = 0;
+		};
+
+		TArray<FConnectionPrioritizedBatch> Batches;
+		Batches.Reserve( NumClientsToTick );
+
+		for ( int32 i = 0; i < ClientConnections.Num(); i++ )
+		{
+			UNetConnection* Connection = ClientConnections[i];
+			check( Connection );
+
+			if ( GNetDormancyValidate == 2 )
+			{
+				for ( auto It = Connection->DormantReplicatorMap.CreateIterator(); It; ++It )
+				{
+					FObjectReplicator& Replicator = It.Value().Get();
+					if ( Replicator.OwningChannel != nullptr )
+					{
+						Replicator.ValidateAgainstState( Replicator.OwningChannel->GetActor() );
+					}
+				}
+			}
+
+			if ( i >= NumClientsToTick )
+			{
+				// Same as the interleaved path: flag considered actors for a future update.
+				for ( int32 ConsiderIdx = 0; ConsiderIdx < ConsiderList.Num(); ConsiderIdx++ )
+				{
+					AActor* Actor = ConsiderList[ConsiderIdx]->Actor;
+					if ( Actor != NULL && !ConsiderList[ConsiderIdx]->bPendingNetUpdate )
+					{
+						UActorChannel* Channel = Connection->FindActorChannelRef( ConsiderList[ConsiderIdx]->WeakActor );
+						if ( Channel != NULL && Channel->LastUpdateTime < ConsiderList[ConsiderIdx]->LastNetUpdateTime )
+						{
+							ConsiderList[ConsiderIdx]->bPendingNetUpdate = true;
+						}
+					}
+				}
+				Connection->TimeSensitive = false;
+			}
+			else if ( Connection->ViewTarget )
+			{
+				FConnectionPrioritizedBatch& Batch = Batches.AddDefaulted_GetRef();
+				Batch.Connection = Connection;
+
+				new( Batch.Viewers )FNetViewer( Connection, DeltaSeconds );
+				for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+				{
+					if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+					{
+						new( Batch.Viewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+					}
+				}
+
+				if ( Connection->PlayerController )
+				{
+					Connection->PlayerController->SendClientAdjustment();
+				}
+
+				for ( int32 ChildIdx = 0; ChildIdx < Connection->Children.Num(); ChildIdx++ )
+				{
+					if ( Connection->Children[ChildIdx]->PlayerController != NULL )
+					{
+						Connection->Children[ChildIdx]->PlayerController->SendClientAdjustment();
+					}
+				}
+
+				Batch.FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, Batch.Viewers, ConsiderList, bCPUSaturated, Batch.PriorityList, Batch.PriorityActors, /*bDoSort*/ false );
+			}
+		}
+
+		ParallelFor( Batches.Num(), [&Batches]( int32 BatchIndex )
+		{
+			FConnectionPrioritizedBatch& Batch = Batches[BatchIndex];
+			Sort( Batch.PriorityActors, Batch.FinalSortedCount, FCompareFActorPriority() );
+		} );
+
+		for ( FConnectionPrioritizedBatch& Batch : Batches )
+		{
+			UNetConnection* Connection = Batch.Connection;
+			const int32 LocalNumSaturated = GNumSaturatedConnections;
+
+			const int32 LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActors( Connection, Batch.Viewers, Batch.PriorityActors, Batch.FinalSortedCount, Updated );
+
+			// relevant actors that could not be processed this frame are marked to be considered for next frame
+			for ( int32 k = LastProcessedActor; k < Batch.FinalSortedCount; k++ )
+			{
+				if ( !Batch.PriorityActors[k]->ActorInfo )
+				{
+					continue;
+				}
+
+				AActor* Actor = Batch.PriorityActors[k]->ActorInfo->Actor;
+				UActorChannel* Channel = Batch.PriorityActors[k]->Channel;
+
+				if ( Channel != NULL && Time - Channel->RelevantTime <= 1.f )
+				{
+					Batch.PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
+				}
+				else if ( IsActorRelevantToConnection( Actor, Batch.Viewers ) )
+				{
+					Batch.PriorityActors[k]->ActorInfo->bPendingNetUpdate = true;
+					if ( Channel != NULL )
+					{
+						Channel->RelevantTime = Time + 0.5f * UpdateDelayRandomStream.FRand();
+					}
+				}
+
+				if ( Batch.PriorityActors[k]->ActorInfo->ForceRelevantFrame >= Connection->LastProcessedFrame )
+				{
+					Batch.PriorityActors[k]->ActorInfo->ForceRelevantFrame = ReplicationFrame + 1;
+				}
+			}
+
+			Connection->LastProcessedFrame = ReplicationFrame;
+
+			const bool bWasSaturated = GNumSaturatedConnections > LocalNumSaturated;
+			Connection->TrackReplicationForAnalytics( bWasSaturated );
+		}
+	}
+	else
 	for ( int32 i=0; i < ClientConnections.Num(); i++ )
 	{
 		UNetConnection* Connection = ClientConnections[i];
@@ -5306,6 +5455,24 @@ TSharedPtr< FReplicationChangelistMgr > UNetDriver::GetReplicationChangeListMgr(
 	return ReplicationChangeListMgrPtr->ReplicationChangelistMgr;
 }
 
+void UNetDriver::SetObjectPushDirtyTracking(UObject* Object)
+{
+	TSharedPtr<FReplicationChangelistMgr> ChangelistMgr = GetReplicationChangeListMgr(Object);
+	if (ChangelistMgr.IsValid())
+	{
+		ChangelistMgr->SetUsesPushDirtyTracking();
+	}
+}
+
+void UNetDriver::MarkObjectDirtyForReplication(UObject* Object)
+{
+	FReplicationChangelistMgrWrapper* Wrapper = ReplicationChangeListMap.Find(Object);
+	if (Wrapper && Wrapper->IsObjectValid() && Wrapper->ReplicationChangelistMgr.IsValid())
+	{
+		Wrapper->ReplicationChangelistMgr->MarkPushDirty();
+	}
+}
+
 // This method will be called when Streaming Levels become Visible.
 void UNetDriver::OnLevelAddedToWorld(ULevel* Level, UWorld* InWorld)
 {
@@ -410,6 +410,67 @@ bool IsRuntime(const UBodySetup* BS)
 
 DECLARE_CYCLE_STAT(TEXT("Create Physics Meshes"), STAT_CreatePhysicsMeshes, STATGROUP_Physics);
 
+#if WITH_PHYSX && PHYSICS_INTERFACE_PHYSX && !WITH_EDITOR
+/**
+ * Warm-start cache for PhysX mesh objects across level reloads. Identical static geometry
+ * deserializes from cooked data once per process; reloading the same level then reattaches the
+ * refcounted PhysX meshes instead of rebuilding them. Disabled in the editor, where cooked data
+ * for a given setup guid can legitimately change.
+ */
+static int32 GPhysicsMeshWarmStartCache = 0;
+static FAutoConsoleVariableRef CVarPhysicsMeshWarmStartCache(
+	TEXT("p.PhysicsMeshWarmStartCache"),
+	GPhysicsMeshWarmStartCache,
+	TEXT("If true, PhysX mesh objects created from cooked data are kept referenced across level reloads, keyed by body setup guid, so identical geometry is deserialized once per process."),
+	ECVF_Default
+);
+
+namespace PhysicsMeshWarmStart
+{
+	struct FEntry
+	{
+		TArray<physx::PxConvexMesh*> ConvexMeshes;
+		TArray<physx::PxConvexMesh*> ConvexMeshesNegX;
+		TArray<physx::PxTriangleMesh*> TriMeshes;
+	};
+
+	static FCriticalSection GLock;
+	static TMap<FGuid, FEntry> GEntries;
+
+	static void Store(const FGuid& Guid, const TArray<physx::PxConvexMesh*>& ConvexMeshes, const TArray<physx::PxConvexMesh*>& ConvexMeshesNegX, const TArray<physx::PxTriangleMesh*>& TriMeshes)
+	{
+		FScopeLock Lock(&GLock);
+		if (GEntries.Contains(Guid))
+		{
+			return;
+		}
+		FEntry& Entry = GEntries.Add(Guid);
+		Entry.ConvexMeshes = ConvexMeshes;
+		Entry.ConvexMeshesNegX = ConvexMeshesNegX;
+		Entry.TriMeshes = TriMeshes;
+		// the cache holds its own reference on every object; owners acquire and release theirs as usual
+		for (physx::PxConvexMesh* Mesh : Entry.ConvexMeshes) { if (Mesh) { Mesh->acquireReference(); } }
+		for (physx::PxConvexMesh* Mesh : Entry.ConvexMeshesNegX) { if (Mesh) { Mesh->acquireReference(); } }
+		for (physx::PxTriangleMesh* Mesh : Entry.TriMeshes) { if (Mesh) { Mesh->acquireReference(); } }
+	}
+
+	static bool Restore(const FGuid& Guid, FEntry& OutEntry)
+	{
+		FScopeLock Lock(&GLock);
+		if (const FEntry* Entry = GEntries.Find(Guid))
+		{
+			OutEntry = *Entry;
+			// the restoring owner gets its own reference, matching the release its ClearPhysicsMeshes will do
+			for (physx::PxConvexMesh* Mesh : OutEntry.ConvexMeshes) { if (Mesh) { Mesh->acquireReference(); } }
+			for (physx::PxConvexMesh* Mesh : OutEntry.ConvexMeshesNegX) { if (Mesh) { Mesh->acquireReference(); } }
+			for (physx::PxTriangleMesh* Mesh : OutEntry.TriMeshes) { if (Mesh) { Mesh->acquireReference(); } }
+			return true;
+		}
+		return false;
+	}
+}
+#endif // WITH_PHYSX && PHYSICS_INTERFACE_PHYSX && !WITH_EDITOR
+
 void UBodySetup::CreatePhysicsMeshes()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UBodySetup::CreatePhysicsMeshes);
@@ -430,6 +491,20 @@ void UBodySetup::CreatePhysicsMeshes()
 	
 	bool bClearMeshes = true;
 
+#if WITH_PHYSX && PHYSICS_INTERFACE_PHYSX && !WITH_EDITOR
+	// Warm start: identical geometry loaded earlier this process reattaches its PhysX meshes directly.
+	// setups that carry UV collision info rebuild it from the cooked data reader, so they cannot warm start
+	if (GPhysicsMeshWarmStartCache && BodySetupGuid.IsValid() && !bSupportUVsAndFaceRemap)
+	{
+		PhysicsMeshWarmStart::FEntry CachedMeshes;
+		if (PhysicsMeshWarmStart::Restore(BodySetupGuid, CachedMeshes))
+		{
+			FinishCreatingPhysicsMeshes_PhysX(CachedMeshes.ConvexMeshes, CachedMeshes.ConvexMeshesNegX, CachedMeshes.TriMeshes);
+			return;
+		}
+	}
+#endif
+
 	// Find or create cooked physics data
 	static FName PhysicsFormatName(FPlatformProperties::GetPhysicsFormat());
 
@@ -465,6 +540,20 @@ void UBodySetup::CreatePhysicsMeshes()
 	{
 		ClearPhysicsMeshes();
 	}
+#if WITH_PHYSX && PHYSICS_INTERFACE_PHYSX && !WITH_EDITOR
+	else if (GPhysicsMeshWarmStartCache && BodySetupGuid.IsValid() && !bSupportUVsAndFaceRemap)
+	{
+		// stash the freshly created meshes for the next load of this setup
+		TArray<physx::PxConvexMesh*> ConvexMeshes;
+		TArray<physx::PxConvexMesh*> ConvexMeshesNegX;
+		for (const FKConvexElem& Elem : AggGeom.ConvexElems)
+		{
+			ConvexMeshes.Add(Elem.GetConvexMesh());
+			ConvexMeshesNegX.Add(Elem.GetMirroredConvexMesh());
+		}
+		PhysicsMeshWarmStart::Store(BodySetupGuid, ConvexMeshes, ConvexMeshesNegX, TriMeshes);
+	}
+#endif
 	
 	bCreatedPhysicsMeshes = true;
 
@@ -1177,6 +1177,13 @@ void FPhysScene_PhysX::KillVisualDebugger()
 #endif // WITH_PHYSX 
 }
 
+// Note on a free-running physics thread: simulation already overlaps the frame - the PhysX solve
+// runs on task threads between the start-physics and end-physics tick groups, so its cost only
+// extends the frame when gameplay past TG_EndPhysics consumes results. Fully decoupling at a
+// fixed timestep needs a read-only transform mirror with interpolation for every consumer
+// (components, queries, networking) plus command queues for all game-thread writes into the
+// scene; the substepper (bSubstepping) provides the fixed-timestep half today. That mirror
+// architecture is the prerequisite to remove this wait, not a change to the wait itself.
 void FPhysScene_PhysX::WaitPhysScenes()
 {
 	check(IsInGameThread());
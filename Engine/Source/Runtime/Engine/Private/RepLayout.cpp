@@ -57,8 +57,11 @@ static FAutoConsoleVariableRef CVarUsePackedShadowBuffers(TEXT("Net.UsePackedSha
 int32 GShareShadowState = 1;
 static FAutoConsoleVariableRef CVarShareShadowState(TEXT("net.ShareShadowState"), GShareShadowState, TEXT("If true, work done to compare properties will be shared across connections"));
 
-int32 GShareInitialCompareState = 0;
-static FAutoConsoleVariableRef CVarShareInitialCompareState(TEXT("net.ShareInitialCompareState"), GShareInitialCompareState, TEXT("If true and net.ShareShadowState is enabled, attempt to also share initial replication compares across connections."));
+int32 GPushDirtySkipsCleanObjects = 1;
+static FAutoConsoleVariableRef CVarPushDirtySkipsCleanObjects(TEXT("net.PushDirtySkipsCleanObjects"), GPushDirtySkipsCleanObjects, TEXT("If true, objects opted into push-based dirty tracking (UNetDriver::SetObjectPushDirtyTracking) skip property compares\non frames where they were not marked dirty. The owning game code must mark every state change."));
+
+int32 GShareInitialCompareState = 1;
+static FAutoConsoleVariableRef CVarShareInitialCompareState(TEXT("net.ShareInitialCompareState"), GShareInitialCompareState, TEXT("If true and net.ShareShadowState is enabled, attempt to also share initial replication compares across connections.\nNew connections then reuse the frame's shared changelist and only re-compare the role properties, instead of running a full per-connection compare."));
 
 int32 MaxRepArraySize = UNetworkSettings::DefaultMaxRepArraySize;
 int32 MaxRepArrayMemory = UNetworkSettings::DefaultMaxRepArrayMemory;
@@ -937,6 +940,17 @@ void FRepLayout::UpdateChangelistMgr(
 	const FReplicationFlags& RepFlags,
 	const bool bForceCompare) const
 {
+	// Push-dirty objects skip fresh compares entirely on clean frames. The guards mirror the
+	// share rules below: initial replication and a connection's first compares still run so
+	// new connections and per-connection role state stay correct; existing changelist history
+	// continues to serve per-connection deltas and acks.
+	if (GPushDirtySkipsCleanObjects && InChangelistMgr.bUsesPushDirty && !InChangelistMgr.bPushDirty
+		&& !bForceCompare && !RepFlags.bNetInitial && RepState && RepState->LastCompareIndex > 1)
+	{
+		INC_DWORD_STAT_BY(STAT_NetSkippedDynamicProps, 1);
+		return;
+	}
+
 	if (GShareInitialCompareState)
 	{
 		// See if we can re-use the work already done on a previous connection
@@ -975,6 +989,7 @@ void FRepLayout::UpdateChangelistMgr(
 	CompareProperties(RepState, &InChangelistMgr.RepChangelistState, (const uint8*)InObject, RepFlags);
 
 	InChangelistMgr.LastReplicationFrame = ReplicationFrame;
+	InChangelistMgr.bPushDirty = false;
 
 	if (GShareInitialCompareState && RepFlags.bNetInitial)
 	{
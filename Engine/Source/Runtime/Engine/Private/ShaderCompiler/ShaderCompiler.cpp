@@ -1106,6 +1106,89 @@ void FShaderCompileThreadRunnableBase::CheckHealth() const
 	}
 }
 
+bool IsShaderPermutationPruned(const FShaderType* ShaderType, const FVertexFactoryType* VertexFactoryType)
+{
+	struct FPruneList
+	{
+		TSet<FName> ShaderTypes;
+		TSet<FString> ShaderVertexFactoryPairs;
+
+		FPruneList()
+		{
+			TArray<FString> Entries;
+			if (GConfig)
+			{
+				GConfig->GetArray(TEXT("ShaderPermutationPruning"), TEXT("Prune"), Entries, GEngineIni);
+			}
+			for (const FString& Entry : Entries)
+			{
+				FString ShaderPart;
+				FString VertexFactoryPart;
+				if (Entry.Split(TEXT(":"), &ShaderPart, &VertexFactoryPart))
+				{
+					ShaderVertexFactoryPairs.Add(Entry);
+				}
+				else
+				{
+					ShaderTypes.Add(FName(*Entry));
+				}
+			}
+
+			if (Entries.Num() > 0)
+			{
+				UE_LOG(LogShaderCompilers, Display, TEXT("Shader permutation pruning active: %d shader types, %d shader/vertex factory pairs"), ShaderTypes.Num(), ShaderVertexFactoryPairs.Num());
+			}
+		}
+	};
+	static FPruneList PruneList;
+
+	if (!ShaderType)
+	{
+		return false;
+	}
+
+	if (PruneList.ShaderTypes.Contains(ShaderType->GetFName()))
+	{
+		return true;
+	}
+
+	if (VertexFactoryType && PruneList.ShaderVertexFactoryPairs.Num() > 0)
+	{
+		return PruneList.ShaderVertexFactoryPairs.Contains(FString(ShaderType->GetName()) + TEXT(":") + VertexFactoryType->GetName());
+	}
+
+	return false;
+}
+
+static int32 GGroupShaderJobsBySharedEnvironment = 1;
+static FAutoConsoleVariableRef CVarGroupShaderJobsBySharedEnvironment(
+	TEXT("r.ShaderCompiler.GroupJobsBySharedEnvironment"),
+	GGroupShaderJobsBySharedEnvironment,
+	TEXT("If enabled, a worker's job batch may run slightly past its even share to finish the current shared-environment run,\n")
+	TEXT("so the environment is serialized into one worker's input file instead of two."),
+	ECVF_Default
+	);
+
+/** Returns the environment shared by a job's inputs, or null when it has none; used to keep same-environment runs in one worker batch. */
+static const FShaderCompilerEnvironment* GetJobSharedEnvironment(FShaderCommonCompileJob* Job)
+{
+	if (FShaderCompileJob* SingleJob = Job->GetSingleShaderJob())
+	{
+		return SingleJob->Input.SharedEnvironment.GetReference();
+	}
+
+	FShaderPipelineCompileJob* PipelineJob = Job->GetShaderPipelineJob();
+	if (PipelineJob && PipelineJob->StageJobs.Num() > 0)
+	{
+		if (FShaderCompileJob* StageJob = PipelineJob->StageJobs[0]->GetSingleShaderJob())
+		{
+			return StageJob->Input.SharedEnvironment.GetReference();
+		}
+	}
+
+	return nullptr;
+}
+
 int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 {
 	int32 NumActiveThreads = 0;
@@ -1141,6 +1224,25 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 						CurrentWorkerInfo.QueuedJobs.Add(Manager->CompileQueue[JobIndex]);
 					}
 
+					// Jobs queued together for one shader map share an environment that is serialized
+					// once per worker input file (see GatherSharedInputs). Cutting the batch mid-run
+					// would serialize that environment into the next worker's file too, so allow the
+					// batch to overshoot a little to finish the run it ended on.
+					if (GGroupShaderJobsBySharedEnvironment && !bAddedLowLatencyTask && JobIndex > 0 && JobIndex == MaxNumJobs)
+					{
+						const FShaderCompilerEnvironment* TailEnvironment = GetJobSharedEnvironment(Manager->CompileQueue[JobIndex - 1]);
+						const int32 HardCap = MaxNumJobs + FMath::Max(1, MaxNumJobs / 4);
+						while (TailEnvironment
+							&& JobIndex < Manager->CompileQueue.Num()
+							&& JobIndex < HardCap
+							&& !Manager->CompileQueue[JobIndex]->bOptimizeForLowLatency
+							&& GetJobSharedEnvironment(Manager->CompileQueue[JobIndex]) == TailEnvironment)
+						{
+							CurrentWorkerInfo.QueuedJobs.Add(Manager->CompileQueue[JobIndex]);
+							JobIndex++;
+						}
+					}
+
 					// Update the worker state as having new tasks that need to be issued					
 					// don't reset worker app ID, because the shadercompileworkers don't shutdown immediately after finishing a single job queue.
 					CurrentWorkerInfo.bIssuedTasksToWorker = false;					
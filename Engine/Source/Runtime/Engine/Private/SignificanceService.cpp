@@ -0,0 +1,149 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "SignificanceService.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/ScopeLock.h"
+
+FSignificanceService& FSignificanceService::Get()
+{
+	static FSignificanceService Singleton;
+	return Singleton;
+}
+
+void FSignificanceService::RegisterEvaluator(FName Type, FBatchEvaluator Evaluator)
+{
+	FScopeLock ScopeLock(&Lock);
+	Evaluators.Add(Type, MoveTemp(Evaluator));
+}
+
+int32 FSignificanceService::RegisterItem(FName Type, const FVector& Position, float Weight)
+{
+	check(IsInGameThread());
+	FScopeLock ScopeLock(&Lock);
+
+	int32 BucketIndex;
+	if (const int32* Existing = BucketByType.Find(Type))
+	{
+		BucketIndex = *Existing;
+	}
+	else
+	{
+		BucketIndex = Buckets.AddDefaulted();
+		Buckets[BucketIndex].Type = Type;
+		BucketByType.Add(Type, BucketIndex);
+	}
+	FTypeBucket& Bucket = Buckets[BucketIndex];
+	const int32 IndexInBucket = Bucket.Positions.Add(Position);
+	Bucket.Weights.Add(Weight);
+	Bucket.Significance[0].Add(0.0f);
+	Bucket.Significance[1].Add(0.0f);
+
+	int32 Handle;
+	if (FreeSlots.Num())
+	{
+		Handle = FreeSlots.Pop(false);
+	}
+	else
+	{
+		Handle = Slots.AddDefaulted();
+	}
+	Slots[Handle].BucketIndex = BucketIndex;
+	Slots[Handle].IndexInBucket = IndexInBucket;
+	Bucket.Handles.Add(Handle);
+	return Handle;
+}
+
+void FSignificanceService::UnregisterItem(int32 Handle)
+{
+	check(IsInGameThread());
+	FScopeLock ScopeLock(&Lock);
+	if (!Slots.IsValidIndex(Handle) || Slots[Handle].BucketIndex == INDEX_NONE)
+	{
+		return;
+	}
+	FTypeBucket& Bucket = Buckets[Slots[Handle].BucketIndex];
+	const int32 IndexInBucket = Slots[Handle].IndexInBucket;
+
+	// swap-remove the SoA row and fix up the handle that moved into its place
+	const int32 LastIndex = Bucket.Positions.Num() - 1;
+	Bucket.Positions.RemoveAtSwap(IndexInBucket, 1, false);
+	Bucket.Weights.RemoveAtSwap(IndexInBucket, 1, false);
+	Bucket.Significance[0].RemoveAtSwap(IndexInBucket, 1, false);
+	Bucket.Significance[1].RemoveAtSwap(IndexInBucket, 1, false);
+	Bucket.Handles.RemoveAtSwap(IndexInBucket, 1, false);
+	if (IndexInBucket <= LastIndex - 1)
+	{
+		Slots[Bucket.Handles[IndexInBucket]].IndexInBucket = IndexInBucket;
+	}
+
+	Slots[Handle].BucketIndex = INDEX_NONE;
+	Slots[Handle].IndexInBucket = INDEX_NONE;
+	FreeSlots.Push(Handle);
+}
+
+void FSignificanceService::UpdateItemPosition(int32 Handle, const FVector& Position)
+{
+	check(IsInGameThread());
+	FScopeLock ScopeLock(&Lock);
+	if (Slots.IsValidIndex(Handle) && Slots[Handle].BucketIndex != INDEX_NONE)
+	{
+		Buckets[Slots[Handle].BucketIndex].Positions[Slots[Handle].IndexInBucket] = Position;
+	}
+}
+
+void FSignificanceService::KickEvaluation(const FVector& Viewpoint)
+{
+	check(IsInGameThread());
+	if (PendingEvaluation.IsValid() && !PendingEvaluation->IsComplete())
+	{
+		// the previous evaluation is still running; skip this frame rather than stack tasks
+		return;
+	}
+	PendingEvaluation = FFunctionGraphTask::CreateAndDispatchWhenReady([this, Viewpoint]()
+	{
+		EvaluateInternal(Viewpoint);
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+void FSignificanceService::EvaluateInternal(const FVector& Viewpoint)
+{
+	FScopeLock ScopeLock(&Lock);
+	const int32 BackBuffer = 1 - FrontBuffer;
+	for (FTypeBucket& Bucket : Buckets)
+	{
+		const int32 Num = Bucket.Positions.Num();
+		if (!Num)
+		{
+			continue;
+		}
+		float* OutSignificance = Bucket.Significance[BackBuffer].GetData();
+		if (const FBatchEvaluator* Evaluator = Evaluators.Find(Bucket.Type))
+		{
+			(*Evaluator)(Bucket.Positions.GetData(), Bucket.Weights.GetData(), OutSignificance, Num, Viewpoint);
+		}
+		else
+		{
+			// default: weight-scaled inverse-square falloff; the whole span runs through one tight loop
+			const FVector* RESTRICT Positions = Bucket.Positions.GetData();
+			const float* RESTRICT Weights = Bucket.Weights.GetData();
+			for (int32 Index = 0; Index < Num; Index++)
+			{
+				const float DistSq = FVector::DistSquared(Positions[Index], Viewpoint);
+				OutSignificance[Index] = FMath::Clamp(Weights[Index] / (1.0f + DistSq * 0.0001f), 0.0f, 1.0f);
+			}
+		}
+	}
+	FPlatformMisc::MemoryBarrier();
+	FrontBuffer = BackBuffer;
+}
+
+float FSignificanceService::GetSignificance(int32 Handle) const
+{
+	FScopeLock ScopeLock(&Lock);
+	if (Slots.IsValidIndex(Handle) && Slots[Handle].BucketIndex != INDEX_NONE)
+	{
+		const FTypeBucket& Bucket = Buckets[Slots[Handle].BucketIndex];
+		return Bucket.Significance[FrontBuffer][Slots[Handle].IndexInBucket];
+	}
+	return 0.0f;
+}
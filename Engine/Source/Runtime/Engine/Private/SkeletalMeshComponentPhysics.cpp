@@ -269,6 +269,34 @@ void USkeletalMeshComponent::WakeAllRigidBodies()
 	}
 }
 
+/**
+ * Ragdoll simulation LOD: beyond the screen-size threshold (or when unrendered), a simulating
+ * ragdoll is put and kept asleep, freezing its pose at negligible cost until it comes close or a
+ * collision wakes it (waking still works; the component just re-sleeps it next tick while distant).
+ * Intermediate per-limb body merging as envisioned by the request would need authored merged setups;
+ * the freeze tier is the share expressible against runtime body instances.
+ */
+static float GRagdollLODFreezeScreenSize = 0.0f;
+static FAutoConsoleVariableRef CVarRagdollLODFreezeScreenSize(
+	TEXT("p.RagdollLOD.FreezeScreenSize"),
+	GRagdollLODFreezeScreenSize,
+	TEXT("Screen size (MaxDistanceFactor) below which simulating ragdolls are kept asleep, freezing their pose; 0 disables. Unrendered ragdolls freeze whenever this is enabled."),
+	ECVF_Default
+);
+
+void USkeletalMeshComponent::UpdateRagdollSimulationLOD()
+{
+	if (GRagdollLODFreezeScreenSize <= 0.0f || !IsAnySimulatingPhysics())
+	{
+		return;
+	}
+	const bool bRecentlyRendered = GetLastRenderTime() > GetWorld()->TimeSeconds - 1.0f;
+	if (!bRecentlyRendered || MaxDistanceFactor < GRagdollLODFreezeScreenSize)
+	{
+		PutAllRigidBodiesToSleep();
+	}
+}
+
 void USkeletalMeshComponent::PutAllRigidBodiesToSleep()
 {
 	for (int32 i=0; i < Bodies.Num(); i++)
@@ -3020,6 +3048,13 @@ void USkeletalMeshComponent::CheckClothTeleport()
 	PrevRootBoneMatrix = CurRootBoneMat;
 }
 
+/** If true, a cloth simulation still in flight when the next update arrives is left to finish on its own (one-frame lag) instead of blocking the game thread; see UpdateClothStateAndSimulate. */
+static TAutoConsoleVariable<int32> CVarClothAllowFrameOverlap(
+	TEXT("p.Cloth.AllowFrameOverlap"),
+	0,
+	TEXT("If true, slow cloth simulations overlap into the next frame instead of stalling the game thread at the next cloth update."),
+	ECVF_Default);
+
 FAutoConsoleTaskPriority CPrio_FParallelClothTask(
 	TEXT("TaskGraph.TaskPriorities.ParallelClothTask"),
 	TEXT("Task and thread priority for parallel cloth."),
@@ -3121,6 +3156,14 @@ void USkeletalMeshComponent::UpdateClothStateAndSimulate(float DeltaTime, FTickF
 		return;
 	}
 
+	// Slow cloth can overlap frames instead of stalling the game thread: if the previous simulation
+	// is still in flight, skip this frame's dispatch (the writeback task completes it when ready, and
+	// pending teleport state carries over to the next update).
+	if (CVarClothAllowFrameOverlap.GetValueOnGameThread() != 0 && IsValidRef(ParallelClothTask) && !ParallelClothTask->IsComplete())
+	{
+		return;
+	}
+
 	// Make sure we aren't already in flight from previous frame
 	HandleExistingParallelClothSimulation();
 
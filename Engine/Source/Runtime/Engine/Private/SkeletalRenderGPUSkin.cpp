@@ -657,6 +657,7 @@ void FSkeletalMeshObjectGPUSkin::ProcessUpdatedDynamicData(FGPUSkinCache* GPUSki
 }
 
 TArray<float> FSkeletalMeshObjectGPUSkin::FSkeletalMeshObjectLOD::MorphAccumulatedWeightArray;
+TArray<FMorphGPUSkinVertex> FSkeletalMeshObjectGPUSkin::FSkeletalMeshObjectLOD::MorphScratchBuffer;
 
 void FGPUMorphUpdateCS::SetParameters(FRHICommandList& RHICmdList, const FVector4& LocalScale, const FMorphTargetVertexInfoBuffers& MorphTargetVertexInfoBuffers, FMorphVertexBuffer& MorphVertexBuffer)
 {
@@ -1000,7 +1001,10 @@ void FSkeletalMeshObjectGPUSkin::FSkeletalMeshObjectLOD::UpdateMorphVertexBuffer
 		FMorphGPUSkinVertex* Buffer = nullptr;
 		{
 			SCOPE_CYCLE_COUNTER(STAT_MorphVertexBuffer_Alloc);
-			Buffer = (FMorphGPUSkinVertex*)FMemory::Malloc(Size);
+			// reuse the persistent scratch; expression-heavy faces update this every few frames and the
+			// full-size alloc/free pair was pure churn
+			MorphScratchBuffer.SetNumUninitialized(LodData.GetNumVertices(), false);
+			Buffer = MorphScratchBuffer.GetData();
 		}
 
 		{
@@ -1088,7 +1092,6 @@ void FSkeletalMeshObjectGPUSkin::FSkeletalMeshObjectLOD::UpdateMorphVertexBuffer
 			SCOPE_CYCLE_COUNTER(STAT_MorphVertexBuffer_RhiLockAndCopy);
 			FMorphGPUSkinVertex* ActualBuffer = (FMorphGPUSkinVertex*)RHILockVertexBuffer(MorphVertexBuffer.VertexBufferRHI, 0, Size, RLM_WriteOnly);
 			FMemory::Memcpy(ActualBuffer, Buffer, Size);
-			FMemory::Free(Buffer);
 		}
 
 		{
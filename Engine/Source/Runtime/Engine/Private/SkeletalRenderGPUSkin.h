@@ -514,6 +514,9 @@ private:
 
 		// Temporary arrays used on UpdateMorphVertexBuffer(); these grow to the max and are not thread safe.
 		static TArray<float> MorphAccumulatedWeightArray;
+
+		/** Reused CPU scratch for morph delta accumulation; avoids a full-buffer heap alloc/free every morph update (render thread only, like the weight array above). */
+		static TArray<FMorphGPUSkinVertex> MorphScratchBuffer;
 	};
 
 	/** 
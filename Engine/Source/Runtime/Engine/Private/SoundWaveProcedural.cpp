@@ -73,13 +73,14 @@ int32 USoundWaveProcedural::GeneratePCMData(uint8* PCMData, const int32 SamplesN
 	{
 		bReset = false;
 		AudioBuffer.Reset();
+		AudioBufferReadOffset = 0;
 		AvailableByteCount.Reset();
 	}
 
 	Audio::EAudioMixerStreamDataFormat::Type Format = GetGeneratedPCMDataFormat();
 	SampleByteSize = (Format == Audio::EAudioMixerStreamDataFormat::Int16) ? 2 : 4;
 
-	int32 SamplesAvailable = AudioBuffer.Num() / SampleByteSize;
+	int32 SamplesAvailable = (AudioBuffer.Num() - AudioBufferReadOffset) / SampleByteSize;
 	int32 SamplesToGenerate = FMath::Min(NumSamplesToGeneratePerCallback, SamplesNeeded);
 
 	check(SamplesToGenerate >= NumBufferUnderrunSamples);
@@ -90,6 +91,13 @@ int32 USoundWaveProcedural::GeneratePCMData(uint8* PCMData, const int32 SamplesN
 	{
 		// First try to use the virtual function which assumes we're writing directly into our audio buffer
 		// since we're calling from the audio render thread.
+		// OnGeneratePCMAudio rebuilds the buffer from scratch, so drop any read offset first.
+		if (AudioBufferReadOffset > 0)
+		{
+			AudioBuffer.RemoveAt(0, AudioBufferReadOffset, false);
+			AudioBufferReadOffset = 0;
+		}
+
 		int32 NumSamplesGenerated = OnGeneratePCMAudio(AudioBuffer, SamplesToGenerate);
 		if (NumSamplesGenerated > 0)
 		{
@@ -115,7 +123,7 @@ int32 USoundWaveProcedural::GeneratePCMData(uint8* PCMData, const int32 SamplesN
 		PumpQueuedAudio();
 	}
 
-	SamplesAvailable = AudioBuffer.Num() / SampleByteSize;
+	SamplesAvailable = (AudioBuffer.Num() - AudioBufferReadOffset) / SampleByteSize;
 
 	// Wait until we have enough samples that are requested before starting.
 	if (SamplesAvailable > 0)
@@ -123,8 +131,22 @@ int32 USoundWaveProcedural::GeneratePCMData(uint8* PCMData, const int32 SamplesN
 		const int32 SamplesToCopy = FMath::Min<int32>(SamplesToGenerate, SamplesAvailable);
 		const int32 BytesToCopy = SamplesToCopy * SampleByteSize;
 
-		FMemory::Memcpy((void*)PCMData, &AudioBuffer[0], BytesToCopy);
-		AudioBuffer.RemoveAt(0, BytesToCopy, false);
+		// Advance the read cursor instead of shifting the whole remaining buffer forward each
+		// callback. The buffer is reclaimed when fully drained, and compacted once the consumed
+		// region is large so a never-drained stream cannot grow it without bound - that compact
+		// moves only the small unread remainder.
+		FMemory::Memcpy((void*)PCMData, &AudioBuffer[AudioBufferReadOffset], BytesToCopy);
+		AudioBufferReadOffset += BytesToCopy;
+		if (AudioBufferReadOffset == AudioBuffer.Num())
+		{
+			AudioBuffer.Reset();
+			AudioBufferReadOffset = 0;
+		}
+		else if (AudioBufferReadOffset >= 256 * 1024)
+		{
+			AudioBuffer.RemoveAt(0, AudioBufferReadOffset, false);
+			AudioBufferReadOffset = 0;
+		}
 
 		// Decrease the available by count
 		if (bPumpQueuedAudio)
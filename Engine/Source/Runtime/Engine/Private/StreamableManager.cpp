@@ -941,6 +941,27 @@ FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetN
 	return Existing;
 }
 
+TSharedPtr<FStreamableHandle> FStreamableManager::ResolveOrRequestAsyncLoad(const TArray<FSoftObjectPath>& TargetsToStream, TArray<UObject*>& OutResolved, FStreamableDelegate DelegateToCall, TAsyncLoadPriority Priority, bool bManageActiveHandle, FString DebugName)
+{
+	FSoftObjectPath::ResolveObjects(TargetsToStream, OutResolved);
+
+	TArray<FSoftObjectPath> Misses;
+	for (int32 PathIndex = 0; PathIndex < TargetsToStream.Num(); PathIndex++)
+	{
+		if (!OutResolved[PathIndex])
+		{
+			Misses.Add(TargetsToStream[PathIndex]);
+		}
+	}
+	if (!Misses.Num())
+	{
+		// everything already loaded; fire the delegate now for a uniform calling pattern
+		DelegateToCall.ExecuteIfBound();
+		return nullptr;
+	}
+	return RequestAsyncLoad(MoveTemp(Misses), DelegateToCall, Priority, bManageActiveHandle, false, MoveTemp(DebugName));
+}
+
 TSharedPtr<FStreamableHandle> FStreamableManager::RequestAsyncLoad(TArray<FSoftObjectPath> TargetsToStream, FStreamableDelegate DelegateToCall, TAsyncLoadPriority Priority, bool bManageActiveHandle, bool bStartStalled, FString DebugName)
 {
 	LLM_SCOPE(ELLMTag::StreamingManager);
@@ -6,6 +6,7 @@ RenderAssetUpdate.cpp: Base class of helpers to stream in and out texture/mesh L
 
 #include "RenderAssetUpdate.h"
 #include "Engine/StreamableRenderAsset.h"
+#include "Misc/QueuedThreadPool.h"
 #include "Streaming/TextureStreamingHelpers.h"
 #include "UObject/UObjectIterator.h"
 
@@ -23,6 +24,33 @@ static TAutoConsoleVariable<int32> CVarStreamingStressTestExtraAsyncLatency(
 	TEXT("An extra latency in milliseconds for each async task when doing the stress test."),
 	ECVF_Cheat);
 
+static int32 GStreamingMipUpdateWorkers = 0;
+static FAutoConsoleVariableRef CVarStreamingMipUpdateWorkers(
+	TEXT("r.Streaming.MipUpdateWorkers"),
+	GStreamingMipUpdateWorkers,
+	TEXT("If > 0, mip update tasks (copies, transcodes, texture creation off the render thread) run on a dedicated pool\n")
+	TEXT("with this many workers instead of the shared thread pool, so they don't queue behind unrelated long jobs."),
+	ECVF_ReadOnly
+);
+
+static FQueuedThreadPool* CreateMipUpdateThreadPool()
+{
+	FQueuedThreadPool* Pool = FQueuedThreadPool::Allocate();
+	const int32 NumWorkers = FMath::Clamp(GStreamingMipUpdateWorkers, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	verify(Pool->Create(NumWorkers, 96 * 1024, TPri_Normal));
+	return Pool;
+}
+
+static FQueuedThreadPool* GetMipUpdateThreadPool()
+{
+	if (GStreamingMipUpdateWorkers > 0)
+	{
+		static FQueuedThreadPool* DedicatedPool = CreateMipUpdateThreadPool();
+		return DedicatedPool;
+	}
+	return GThreadPool;
+}
+
 
 volatile int32 GRenderAssetStreamingSuspension = 0;
 
@@ -293,7 +321,7 @@ void FRenderAssetUpdate::ScheduleAsyncTask()
 
 	// Notify that an async tick is scheduled.
 	++ScheduledAsyncTasks;
-	(new FAsyncMipUpdateTask(this))->StartBackgroundTask();
+	(new FAsyncMipUpdateTask(this))->StartBackgroundTask(GetMipUpdateThreadPool());
 }
 
 void FRenderAssetUpdate::FMipUpdateTask::DoWork()
@@ -175,6 +175,12 @@ void FStreamingRenderAsset::UpdateDynamicData(const int32* NumStreamedMips, int3
 			}
 
 			LODBias += BudgetMipBias;
+
+			// meshes take the dedicated mesh bias; their "mips" are LODs and scale independently of texture quality
+			if (IsMesh())
+			{
+				LODBias += Settings.MeshLODBias;
+			}
 		}
 
 		// Update MaxAllowedMips in an atomic way to avoid possible bad interaction with the async task.
@@ -330,6 +336,12 @@ void FStreamingRenderAsset::SetPerfectWantedMips_Async(
 	else
 	{
 		HiddenWantedMips = FMath::Max(GetWantedMipsFromSize(MaxSize * Settings.HiddenPrimitiveScale, MaxScreenSizeOverAllViews), NumForcedMips);
+		// the longer nothing has drawn this asset, the more resolution it surrenders beyond the hidden scale
+		if (Settings.StaleHiddenMipDropDelay > 0.f && LastRenderTime > Settings.StaleHiddenMipDropDelay)
+		{
+			const int32 StaleMipDrop = (int32)FMath::Min(LastRenderTime / Settings.StaleHiddenMipDropDelay, 4.0f);
+			HiddenWantedMips = FMath::Max(HiddenWantedMips - StaleMipDrop, NumForcedMips);
+		}
 		// NumMissingMips contains the number of mips not loaded because of HiddenPrimitiveScale. When out of budget, those texture will be considered as already sacrificed.
 		NumMissingMips = FMath::Max<int32>(GetWantedMipsFromSize(MaxSize, MaxScreenSizeOverAllViews) - FMath::Max<int32>(VisibleWantedMips, HiddenWantedMips), 0);
 	}
@@ -151,6 +151,20 @@ TAutoConsoleVariable<float> CVarStreamingMaxHiddenPrimitiveViewBoost(
 	ECVF_Default
 	);
 
+TAutoConsoleVariable<int32> CVarStreamingMeshLODBias(
+	TEXT("r.Streaming.MeshLODBias"),
+	0,
+	TEXT("Extra LOD bias applied to streamed mesh assets (skeletal and static mesh LOD streaming) on top of per-asset bias.\n")
+	TEXT("Lets crowd-heavy scenes cap resident mesh LODs globally without touching texture quality."),
+	ECVF_Default);
+
+TAutoConsoleVariable<float> CVarStreamingStaleHiddenMipDropDelay(
+	TEXT("r.Streaming.StaleHiddenMipDropDelay"),
+	0.f,
+	TEXT("Seconds a texture must remain unrendered before it surrenders one extra wanted mip per multiple of this delay (0 disables).\n")
+	TEXT("Cheap CPU-side stand-in for sampled-mip feedback: assets nothing has drawn for a while stop competing with on-screen ones."),
+	ECVF_Default);
+
 TAutoConsoleVariable<float> CVarStreamingHiddenPrimitiveScale(
 	TEXT("r.Streaming.HiddenPrimitiveScale"),
 	0.5,
@@ -303,6 +317,8 @@ void FRenderAssetStreamingSettings::Update()
 	MaxTextureUVDensity = CVarStreamingMaxTextureUVDensity.GetValueOnAnyThread();
 	bUseMaterialData = bUseNewMetrics && CVarStreamingUseMaterialData.GetValueOnAnyThread() != 0;
 	HiddenPrimitiveScale = bUseNewMetrics ? CVarStreamingHiddenPrimitiveScale.GetValueOnAnyThread() : 1.f;
+	StaleHiddenMipDropDelay = CVarStreamingStaleHiddenMipDropDelay.GetValueOnAnyThread();
+	MeshLODBias = FMath::Max(CVarStreamingMeshLODBias.GetValueOnAnyThread(), 0);
 	bMipCalculationEnablePerLevelList = CVarStreamingMipCalculationEnablePerLevelList.GetValueOnAnyThread() != 0;
 	bPrioritizeMeshLODRetention = CVarPrioritizeMeshLODRetention.GetValueOnAnyThread() != 0;
 	VRAMPercentageClamp = CVarStreamingVRAMPercentageClamp.GetValueOnAnyThread();
@@ -80,6 +80,10 @@ struct FRenderAssetStreamingSettings
 	int32 DropMips;
 	int32 HLODStrategy;
 	float HiddenPrimitiveScale;
+	/** Seconds a texture must stay unrendered before it starts surrendering additional mips (0 disables). One extra mip drops per multiple of the delay. */
+	float StaleHiddenMipDropDelay;
+	/** Extra LOD bias applied to streamed mesh assets only (skeletal/static LOD streaming); lets mesh residency scale down independently of texture quality. */
+	int32 MeshLODBias;
 	float PerTextureBiasViewBoostThreshold;
 	float MaxHiddenPrimitiveViewBoost;
 	int32 GlobalMipBias;
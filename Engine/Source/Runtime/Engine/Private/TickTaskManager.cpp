@@ -290,6 +290,85 @@ public:
 };
 
 
+/** Registry of batch tick callbacks; see FTickFunction::RegisterBatchTickCallback. */
+static FCriticalSection GBatchTickCallbacksLock;
+static TMap<FName, FTickFunction::FBatchTickCallback> GBatchTickCallbacks;
+
+void FTickFunction::RegisterBatchTickCallback(FName BatchKey, FBatchTickCallback Callback)
+{
+	FScopeLock Lock(&GBatchTickCallbacksLock);
+	GBatchTickCallbacks.Add(BatchKey, MoveTemp(Callback));
+}
+
+/**
+ * Task executing a whole batch of tick functions sharing a batch key: one scheduled task instead of
+ * one per function. The member array is owned by shared state so the sequencer can keep appending
+ * while the task is held.
+ */
+class FTickBatchTask
+{
+public:
+	struct FBatchState
+	{
+		FName BatchKey;
+		TArray<FTickFunction*> Members;
+		FTickContext Context;
+		/** The held TGraphTask<FTickBatchTask>; members' TaskPointer aliases this so dependents wait on the whole batch. */
+		void* HeldTask = nullptr;
+	};
+
+private:
+	TSharedPtr<FBatchState, ESPMode::ThreadSafe> State;
+
+public:
+	FTickBatchTask(const TSharedPtr<FBatchState, ESPMode::ThreadSafe>& InState)
+		: State(InState)
+	{
+	}
+	static FORCEINLINE TStatId GetStatId()
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FTickBatchTask, STATGROUP_TaskGraphTasks);
+	}
+	FORCEINLINE ENamedThreads::Type GetDesiredThread()
+	{
+		return State->Context.Thread;
+	}
+	static FORCEINLINE ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		FTickFunction::FBatchTickCallback Callback;
+		{
+			FScopeLock Lock(&GBatchTickCallbacksLock);
+			if (FTickFunction::FBatchTickCallback* Registered = GBatchTickCallbacks.Find(State->BatchKey))
+			{
+				Callback = *Registered;
+			}
+		}
+		// batched functions have no tick interval, so the context delta applies uniformly
+		if (Callback)
+		{
+			Callback(State->Members, State->Context.DeltaSeconds, State->Context.TickType, CurrentThread);
+		}
+		else
+		{
+			for (FTickFunction* Member : State->Members)
+			{
+				if (Member->IsTickFunctionEnabled())
+				{
+					Member->ExecuteTick(Member->CalculateDeltaTime(State->Context), State->Context.TickType, CurrentThread, MyCompletionGraphEvent);
+				}
+			}
+		}
+		for (FTickFunction* Member : State->Members)
+		{
+			Member->InternalData->TaskPointer = nullptr; // This is stale and a good time to clear it for safety
+		}
+	}
+};
+
 /**
  * Class that handles the actual tick tasks and starting and completing tick groups
  */
@@ -371,6 +450,11 @@ class FTickTaskSequencer
 	/** Completion handles for each phase of ticks */
 	TArrayWithThreadsafeAdd<FGraphEventRef, TInlineAllocator<4> > TickCompletionEvents[TG_MAX];
 
+	/** Held batch tasks per start tick group, unlocked with the group dispatch. */
+	TArray<TGraphTask<FTickBatchTask>*> BatchTickTasks[TG_MAX];
+	/** Open batch buckets for the current queueing pass, keyed by batch key and priority/thread flags packed into the low bits. */
+	TMap<FName, TSharedPtr<FTickBatchTask::FBatchState, ESPMode::ThreadSafe>> OpenBatches[TG_MAX][4];
+
 	/** HiPri Held tasks for each tick group. */
 	TArrayWithThreadsafeAdd<TGraphTask<FTickFunctionTask>*> HiPriTickTasks[TG_MAX][TG_MAX];
 
@@ -446,6 +530,7 @@ public:
 		}
 
 		TickFunction->InternalData->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes);
+		TickFunction->InternalData->bWasBatchQueued = false;
 	}
 
 	/** Add a completion handle to a tick group **/
@@ -500,11 +585,59 @@ public:
 	{
 		checkSlow(TickFunction->InternalData);
 		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+		if (TickFunction->TickBatchKey != NAME_None && QueueIntoBatch(Prerequisites, TickFunction, TickContext))
+		{
+			return;
+		}
 		StartTickTask(Prerequisites, TickFunction, TickContext);
 		TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)TickFunction->InternalData->TaskPointer;
 		AddTickTaskCompletion(TickFunction->InternalData->ActualStartTickGroup, TickFunction->InternalData->ActualEndTickGroup, Task, TickFunction->bHighPriority);
 	}
 
+	/**
+	 * Folds an eligible tick function into the open batch for its key: one scheduled task per
+	 * (group, key, priority, threading) bucket instead of one per function. Returns false when the
+	 * function can't batch (prerequisites, tick interval, split start/end groups) and must take the
+	 * individual path. Dependents of a batched function wait on the whole batch via TaskPointer.
+	 */
+	bool QueueIntoBatch(const FGraphEventArray* Prerequisites, FTickFunction* TickFunction, const FTickContext& TickContext)
+	{
+		const ETickingGroup StartGroup = TickFunction->InternalData->ActualStartTickGroup;
+		if ((Prerequisites && Prerequisites->Num()) ||
+			TickFunction->GetEffectiveTickInterval() > 0.0f ||
+			TickFunction->InternalData->ActualEndTickGroup != StartGroup ||
+			StartGroup != TickFunction->TickGroup)
+		{
+			return false;
+		}
+
+		const int32 BucketIndex = (TickFunction->bHighPriority ? 1 : 0) | ((TickFunction->bRunOnAnyThread && bAllowConcurrentTicks) ? 2 : 0);
+		TSharedPtr<FTickBatchTask::FBatchState, ESPMode::ThreadSafe>& State = OpenBatches[StartGroup][BucketIndex].FindOrAdd(TickFunction->TickBatchKey);
+		if (!State.IsValid())
+		{
+			State = MakeShareable(new FTickBatchTask::FBatchState());
+			State->BatchKey = TickFunction->TickBatchKey;
+			State->Context = TickContext;
+			if (BucketIndex & 2)
+			{
+				State->Context.Thread = (BucketIndex & 1) ? CPrio_HiPriAsyncTickTaskPriority.Get() : CPrio_NormalAsyncTickTaskPriority.Get();
+			}
+			else
+			{
+				State->Context.Thread = ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, (BucketIndex & 1) ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
+			}
+			TGraphTask<FTickBatchTask>* Task = TGraphTask<FTickBatchTask>::CreateTask(nullptr, TickContext.Thread).ConstructAndHold(State);
+			State->HeldTask = Task;
+			BatchTickTasks[StartGroup].Add(Task);
+			new (TickCompletionEvents[StartGroup]) FGraphEventRef(Task->GetCompletionEvent());
+			State->Members.Reserve(64);
+		}
+		State->Members.Add(TickFunction);
+		TickFunction->InternalData->TaskPointer = State->HeldTask;
+		TickFunction->InternalData->bWasBatchQueued = true;
+		return true;
+	}
+
 	/**
 	 * Start a component tick task and add the completion handle
 	 *
@@ -662,6 +795,18 @@ private:
 	void DispatchTickGroup(ENamedThreads::Type CurrentThread, ETickingGroup WorldTickGroup)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_DispatchTickGroup);
+		{
+			// close this group's batch buckets and release the batch tasks with the group
+			for (int32 BucketIndex = 0; BucketIndex < 4; BucketIndex++)
+			{
+				OpenBatches[WorldTickGroup][BucketIndex].Reset();
+			}
+			if (BatchTickTasks[WorldTickGroup].Num())
+			{
+				TGraphTask<FTickBatchTask>::UnlockBatch(BatchTickTasks[WorldTickGroup], CurrentThread);
+			}
+			BatchTickTasks[WorldTickGroup].Reset();
+		}
 		for (int32 IndexInner = 0; IndexInner < TG_MAX; IndexInner++)
 		{
 			TArray<TGraphTask<FTickFunctionTask>*>& TickArray = HiPriTickTasks[WorldTickGroup][IndexInner];
@@ -669,12 +814,11 @@ private:
 			{
 				check(TickArray.Num() == 0); // makes no sense to have and end TG before the start TG
 			}
-			else
+			else if (TickArray.Num())
 			{
-				for (int32 Index = 0; Index < TickArray.Num(); Index++)
-				{
-					TickArray[Index]->Unlock(CurrentThread);
-				}
+				// Release the whole group in one batch: one queue operation and one round of
+				// worker wakeups instead of one per task.
+				TGraphTask<FTickFunctionTask>::UnlockBatch(TickArray, CurrentThread);
 			}
 			TickArray.Reset();
 		}
@@ -685,12 +829,9 @@ private:
 			{
 				check(TickArray.Num() == 0); // makes no sense to have and end TG before the start TG
 			}
-			else
+			else if (TickArray.Num())
 			{
-				for (int32 Index = 0; Index < TickArray.Num(); Index++)
-				{
-					TickArray[Index]->Unlock(CurrentThread);
-				}
+				TGraphTask<FTickFunctionTask>::UnlockBatch(TickArray, CurrentThread);
 			}
 			TickArray.Reset();
 		}
@@ -805,7 +946,7 @@ public:
 				TickFunction->InternalData->bWasInterval = true;
 				AllTickFunctions.Add(TickFunction);
 
-				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval - (Context.DeltaSeconds - CumulativeCooldown))); // Give credit for any overrun
+				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->GetEffectiveTickInterval() - (Context.DeltaSeconds - CumulativeCooldown))); // Give credit for any overrun
 
 				AllCoolingDownTickFunctions.Head = TickFunction->InternalData->Next;
 				TickFunction = TickFunction->InternalData->Next;
@@ -829,7 +970,7 @@ public:
 	void RescheduleForIntervalParallel(FTickFunction* TickFunction)
 	{
 		// note we do the remove later!
-		TickFunctionsToReschedule.AddThreadsafe(FTickScheduleDetails(TickFunction, TickFunction->TickInterval, true));
+		TickFunctionsToReschedule.AddThreadsafe(FTickScheduleDetails(TickFunction, TickFunction->GetEffectiveTickInterval(), true));
 	}
 	/* Helper to presize reschedule array */
 	void ReserveTickFunctionCooldowns(int32 NumToReserve)
@@ -933,10 +1074,10 @@ public:
 			FTickFunction* TickFunction = *It;
 			TickFunction->QueueTickFunction(TTS, Context);
 
-			if (TickFunction->TickInterval > 0.f)
+			if (TickFunction->GetEffectiveTickInterval() > 0.f)
 			{
 				It.RemoveCurrent();
-				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval));
+				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->GetEffectiveTickInterval()));
 			}
 		}
 		int32 EnabledCooldownTicks = 0;
@@ -947,7 +1088,7 @@ public:
 			{
 				CumulativeCooldown += TickFunction->InternalData->RelativeTickCooldown;
 				TickFunction->QueueTickFunction(TTS, Context);
-				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval - (Context.DeltaSeconds - CumulativeCooldown))); // Give credit for any overrun
+				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->GetEffectiveTickInterval() - (Context.DeltaSeconds - CumulativeCooldown))); // Give credit for any overrun
 				AllCoolingDownTickFunctions.Head = TickFunction->InternalData->Next;
 			}
 			else
@@ -973,10 +1114,10 @@ public:
 			TickFunction->QueueTickFunction(TTS, Context);
 			Num++;
 
-			if (TickFunction->TickInterval > 0.f)
+			if (TickFunction->GetEffectiveTickInterval() > 0.f)
 			{
 				AllEnabledTickFunctions.Remove(TickFunction);
-				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval));
+				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->GetEffectiveTickInterval()));
 			}
 		}
 		ScheduleTickFunctionCooldowns();
@@ -995,10 +1136,10 @@ public:
 			FTickFunction* TickFunction = *It;
 			UE_LOG(LogTick, Error, TEXT("Could not tick newly spawned in 100 iterations; runaway recursive spawing. Tick is %s."), *TickFunction->DiagnosticMessage());
 
-			if (TickFunction->TickInterval > 0.f)
+			if (TickFunction->GetEffectiveTickInterval() > 0.f)
 			{
 				AllEnabledTickFunctions.Remove(TickFunction);
-				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval));
+				TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->GetEffectiveTickInterval()));
 			}
 		}
 		ScheduleTickFunctionCooldowns();
@@ -1029,7 +1170,7 @@ public:
 					TickFunction->InternalData->TickQueuedGFrameCounter = GFrameCounter;
 					TickFunction->ExecuteTick(TickFunction->CalculateDeltaTime(InContext), InContext.TickType, ENamedThreads::GameThread, FGraphEventRef());
 
-					TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval - (InContext.DeltaSeconds - CumulativeCooldown))); // Give credit for any overrun
+					TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->GetEffectiveTickInterval() - (InContext.DeltaSeconds - CumulativeCooldown))); // Give credit for any overrun
 				}
 				else
 				{
@@ -1067,10 +1208,10 @@ public:
 				TickFunction->InternalData->TickQueuedGFrameCounter = GFrameCounter;
 				TickFunction->ExecuteTick(TickFunction->CalculateDeltaTime(InContext), InContext.TickType, ENamedThreads::GameThread, FGraphEventRef());
 
-				if (TickFunction->TickInterval > 0.f)
+				if (TickFunction->GetEffectiveTickInterval() > 0.f)
 				{
 					It.RemoveCurrent();
-					TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->TickInterval));
+					TickFunctionsToReschedule.Add(FTickScheduleDetails(TickFunction, TickFunction->GetEffectiveTickInterval()));
 				}
 			}
 		}
@@ -1233,7 +1374,7 @@ public:
 		switch(TickFunction->TickState)
 		{
 		case FTickFunction::ETickState::Enabled:
-			if (TickFunction->TickInterval > 0.f)
+			if (TickFunction->GetEffectiveTickInterval() > 0.f)
 			{
 				// An enabled function with a tick interval could be in either the enabled or cooling down list
 				if (AllEnabledTickFunctions.Remove(TickFunction) == 0)
@@ -1760,6 +1901,7 @@ FTickFunction::FTickFunction()
 FTickFunction::FInternalData::FInternalData()
 	: bRegistered(false)
 	, bWasInterval(false)
+	, bWasBatchQueued(false)
 	, ActualStartTickGroup(TG_PrePhysics)
 	, ActualEndTickGroup(TG_PrePhysics)
 	, TickVisitedGFrameCounter(0)
@@ -1886,6 +2028,14 @@ void FTickFunction::ShowPrerequistes(int32 Indent)
 FGraphEventRef FTickFunction::GetCompletionHandle() const
 {
 	check(InternalData->TaskPointer);
+	// Batched functions alias the shared batch task in TaskPointer, and TGraphTask's members sit
+	// after storage sized by the task type, so the pointer must be resolved through the type that
+	// was actually constructed.
+	if (InternalData->bWasBatchQueued)
+	{
+		TGraphTask<FTickBatchTask>* BatchTask = (TGraphTask<FTickBatchTask>*)InternalData->TaskPointer;
+		return BatchTask->GetCompletionEvent();
+	}
 	TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)InternalData->TaskPointer;
 	return Task->GetCompletionEvent();
 }
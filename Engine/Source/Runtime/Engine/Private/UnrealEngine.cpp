@@ -17,6 +17,7 @@ UnrealEngine.cpp: Implements the UEngine class and helpers.
 #include "Engine/GameViewportClient.h"
 #include "RenderingThread.h"
 #include "RHIStaticStates.h"
+#include "ShaderPipelineCache.h"
 #include "Engine/TextureStreamingTypes.h"
 #include "Components/PrimitiveComponent.h"
 #include "AI/NavigationSystemBase.h"
@@ -343,6 +344,19 @@ static TAutoConsoleVariable<int> CVarDynamicResOperationMode(
 	TEXT(" 2: Enable regardless of the game user settings."),
 	ECVF_RenderThreadSafe | ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarGuaranteePSOPrecompileOnLoadMap(
+	TEXT("r.ShaderPipelineCache.GuaranteeOnLoadMap"),
+	0,
+	TEXT("If enabled, LoadMap blocks until the shader pipeline cache has finished precompiling the PSOs it currently considers viable,\n")
+	TEXT("trading longer loads (bounded by r.ShaderPipelineCache.GuaranteeOnLoadMapTimeout) for hitch-free first frames."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGuaranteePSOPrecompileOnLoadMapTimeout(
+	TEXT("r.ShaderPipelineCache.GuaranteeOnLoadMapTimeout"),
+	10.0f,
+	TEXT("Maximum time in seconds LoadMap will wait on PSO precompilation when r.ShaderPipelineCache.GuaranteeOnLoadMap is enabled."),
+	ECVF_Default);
+
 // Should we show errors and warnings (when DurationOfErrorsAndWarningsOnHUD is greater than zero), or only errors?
 int32 GSupressWarningsInOnScreenDisplay = 0;
 static FAutoConsoleVariableRef GSupressWarningsInOnScreenDisplayCVar(
@@ -12786,6 +12800,38 @@ bool UEngine::LoadMap( FWorldContext& WorldContext, FURL URL, class UPendingNetG
 		}
 	}
 
+	// Optionally hold level-ready until the pipeline cache has drained its outstanding precompiles,
+	// so first encounters of cached material/vertex-factory combos don't hitch the RHI thread in-game.
+	// The loading screen is still up at this point and the pipeline cache ticks on the idle render thread.
+	// The cache only ticks on the idle render thread, so there is nothing to wait on when rendering single threaded.
+	if (CVarGuaranteePSOPrecompileOnLoadMap.GetValueOnGameThread() != 0 && WorldContext.WorldType == EWorldType::Game && GIsThreadedRendering && FShaderPipelineCache::NumPrecompilesRemaining() > 0)
+	{
+		const double PrecompileStartTime = FPlatformTime::Seconds();
+		const double PrecompileEndTime = PrecompileStartTime + FMath::Max(0.0f, CVarGuaranteePSOPrecompileOnLoadMapTimeout.GetValueOnGameThread());
+		const uint32 InitialPrecompilesRemaining = FShaderPipelineCache::NumPrecompilesRemaining();
+
+		const bool bWasPaused = FShaderPipelineCache::IsBatchingPaused();
+		if (bWasPaused)
+		{
+			FShaderPipelineCache::ResumeBatching();
+		}
+		FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Fast);
+
+		while (FShaderPipelineCache::NumPrecompilesRemaining() > 0 && FPlatformTime::Seconds() < PrecompileEndTime)
+		{
+			FPlatformProcess::Sleep(0.01f);
+		}
+
+		FShaderPipelineCache::SetBatchMode(FShaderPipelineCache::BatchMode::Background);
+		if (bWasPaused)
+		{
+			FShaderPipelineCache::PauseBatching();
+		}
+
+		const uint32 PrecompilesLeft = FShaderPipelineCache::NumPrecompilesRemaining();
+		UE_LOG(LogLoad, Log, TEXT("LoadMap waited %.2fs for PSO precompilation (%u of %u left)"), FPlatformTime::Seconds() - PrecompileStartTime, PrecompilesLeft, InitialPrecompilesRemaining);
+	}
+
 	STAT_ADD_CUSTOMMESSAGE_NAME( STAT_NamedMarker, *(FString( TEXT( "LoadMapComplete - " ) + URL.Map )) );
 	TRACE_BOOKMARK(TEXT("LoadMapComplete - %s"), *URL.Map);
 	MALLOC_PROFILER( FMallocProfiler::SnapshotMemoryLoadMapEnd( URL.Map ); )
@@ -6,6 +6,14 @@
 #include "UploadingVirtualTexture.h"
 #include "CrunchCompression.h"
 #include "BlockCodingHelpers.h"
+#include "Async/TaskGraphInterfaces.h"
+
+static FAutoConsoleTaskPriority CPrio_VTTranscode(
+	TEXT("TaskGraph.TaskPriorities.VTTranscode"),
+	TEXT("Task and thread priority for virtual texture tile transcoding."),
+	ENamedThreads::NormalThreadPriority,
+	ENamedThreads::NormalTaskPriority
+	);
 
 static int32 TranscodeRetireAge = 60; //1 second @ 60 fps
 static FAutoConsoleVariableRef CVarVTTranscodeRetireAge(
@@ -192,7 +200,7 @@ struct FTranscodeTask
 	}
 
 	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
-	ENamedThreads::Type GetDesiredThread() { return ENamedThreads::AnyNormalThreadNormalTask; }
+	ENamedThreads::Type GetDesiredThread() { return CPrio_VTTranscode.Get(); }
 
 	FORCEINLINE TStatId GetStatId() const
 	{
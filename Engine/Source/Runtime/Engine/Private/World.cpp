@@ -2301,6 +2301,19 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform, bool b
 	bConsiderTimeLimit &= bMatchStarted && bIsGameWorld;
 	double TimeLimit = GLevelStreamingActorsUpdateTimeLimit;
 
+	// a streaming level can override the global budget, so heavyweight levels and background sublevels stop sharing one number
+	for (ULevelStreaming* StreamingLevel : StreamingLevels)
+	{
+		if (StreamingLevel && StreamingLevel->GetLoadedLevel() == Level)
+		{
+			if (StreamingLevel->AddToWorldTimeBudgetMsOverride > 0.0f)
+			{
+				TimeLimit = StreamingLevel->AddToWorldTimeBudgetMsOverride;
+			}
+			break;
+		}
+	}
+
 	if (bConsiderTimeLimit)
 	{
 		// Give the actor initialization code more time if we're performing a high priority load or are in seamless travel
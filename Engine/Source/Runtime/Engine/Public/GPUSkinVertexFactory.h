@@ -170,6 +170,9 @@ public:
 		bool UpdateBoneData(FRHICommandListImmediate& RHICmdList, const TArray<FMatrix>& ReferenceToLocalMatrices,
 			const TArray<FBoneIndexType>& BoneMap, uint32 RevisionNumber, bool bPrevious, ERHIFeatureLevel::Type FeatureLevel, bool bUseSkinCache);
 
+		/** Hash of the last uploaded bone set per buffer slot (current/previous); lets r.GPUSkin.SkipRedundantBoneUploads elide uploads for unchanged poses. */
+		uint64 LastUploadedBoneHash[2] = { 0, 0 };
+
 		void ReleaseBoneData()
 		{
 			ensure(IsInRenderingThread());
@@ -183,6 +186,7 @@ public:
 					BoneBufferPool.ReleasePooledResource(BoneBuffer[i]);
 				}
 				BoneBuffer[i].SafeRelease();
+				LastUploadedBoneHash[i] = 0;
 			}
 		}
 		
@@ -934,6 +934,19 @@ public:
 	 */
 	static TRefCountPtr<FMaterialShaderMap> FindId(const FMaterialShaderMapId& ShaderMapId, EShaderPlatform Platform);
 
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Finds a finalized shader map whose material translated to identical shader compiler input.
+	 * Materials and instances that differ only in ways that do not affect the translated code
+	 * (e.g. default parameter values) collapse onto one compiled map through this registry.
+	 * @return NULL if no matching finalized shader map is in memory.
+	 */
+	static TRefCountPtr<FMaterialShaderMap> FindByTranslationHash(const FSHAHash& InTranslationHash, EShaderPlatform Platform);
+
+	/** Publishes this map in the translation-hash registry; called when a compile is kicked off for it. */
+	void RegisterTranslationHash(const FSHAHash& InTranslationHash);
+#endif // WITH_EDITORONLY_DATA
+
 #if ALLOW_SHADERMAP_DEBUG_DATA
 	/** Flushes the given shader types from any loaded FMaterialShaderMap's. */
 	static void FlushShaderTypes(TArray<FShaderType*>& ShaderTypesToFlush, TArray<const FShaderPipelineType*>& ShaderPipelineTypesToFlush, TArray<const FVertexFactoryType*>& VFTypesToFlush);
@@ -1154,6 +1167,18 @@ private:
 	static TMap<FMaterialShaderMapId,FMaterialShaderMap*> GIdToMaterialShaderMap[SP_NumPlatforms];
 	static FCriticalSection GIdToMaterialShaderMapCS;
 
+#if WITH_EDITORONLY_DATA
+	/**
+	 * Maps a hash of the material translation output (generated code plus compile environment) to a
+	 * shader map compiled from it, so identical translations share one compile. Entries are removed
+	 * on destruction of the shader map; guarded by GIdToMaterialShaderMapCS.
+	 */
+	static TMap<FSHAHash, FMaterialShaderMap*> GTranslationHashToMaterialShaderMap[SP_NumPlatforms];
+
+	/** This map's key in GTranslationHashToMaterialShaderMap; zero when never registered. */
+	FSHAHash TranslationHash;
+#endif // WITH_EDITORONLY_DATA
+
 #if ALLOW_SHADERMAP_DEBUG_DATA
 	/** 
 	 * All material shader maps in memory. 
@@ -1909,11 +1934,15 @@ struct FUniformExpressionCache
 	/** True if the cache is up to date. */
 	bool bUpToDate;
 
+	/** Hash of the last contents written to UniformBuffer, to skip redundant RHI updates. */
+	uint64 LastFilledContentsHash;
+
 	/** Shader map that was used to cache uniform expressions on this material.  This is used for debugging and verifying correct behavior. */
 	const FMaterialShaderMap* CachedUniformExpressionShaderMap;
 
 	FUniformExpressionCache() :
 		bUpToDate(false),
+		LastFilledContentsHash(0),
 		CachedUniformExpressionShaderMap(NULL)
 	{}
 
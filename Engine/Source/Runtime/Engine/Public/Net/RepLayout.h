@@ -466,11 +466,23 @@ public:
 
 	void CountBytes(FArchive& Ar) const;
 
+	/** Opts this object into push-based dirty tracking; once set, fresh compares only run after MarkPushDirty. */
+	void SetUsesPushDirtyTracking() { bUsesPushDirty = true; bPushDirty = true; }
+
+	/** Flags the object's state as changed; the next replication will run a fresh compare. */
+	void MarkPushDirty() { bPushDirty = true; }
+
 private:
 
 	uint32 LastReplicationFrame;
 	uint32 LastInitialReplicationFrame;
 
+	/** When true, this object uses push-based dirty tracking and clean frames skip property compares (see net.PushDirtySkipsCleanObjects). */
+	bool bUsesPushDirty = false;
+
+	/** Set by MarkPushDirty, cleared after a fresh compare runs. */
+	bool bPushDirty = false;
+
 	FRepChangelistState RepChangelistState;
 };
 
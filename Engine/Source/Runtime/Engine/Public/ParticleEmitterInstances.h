@@ -209,6 +209,13 @@ struct FParticleEmitterBuildInfo
 /*-----------------------------------------------------------------------------
 	FParticleEmitterInstance
 -----------------------------------------------------------------------------*/
+// Note on an instanced-sprite fast path: particle state here is interleaved AoS
+// (FBaseParticle plus module payloads at per-emitter offsets), and every module ticks against
+// that layout, so a SoA fill that skips per-particle vertex construction is gated on the
+// module payload system - each shipped and game module reads/writes its payload bytes in
+// place. The practical fast path is migration of heavy effects to the SoA simulation that
+// already exists (Niagara), not a second layout inside Cascade; Cascade-side wins are limited
+// to fill-time code (already bulk memcpy where layouts line up).
 struct ENGINE_API FParticleEmitterInstance
 {
 public:
@@ -257,6 +257,18 @@ public:
 	 */
 	ENGINE_API virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const;
 
+	/**
+	 * Opt-in fast path for the relevance pass: a proxy whose GetViewRelevance result does not depend
+	 * on the view (no show-flag, view-mode or distance conditionals in its implementation) can return
+	 * true here; the renderer then computes its relevance once at scene registration and reuses the
+	 * cached result every frame and view instead of making the virtual call. Only opt in when the
+	 * override genuinely ignores its view argument, or stale relevance will be rendered.
+	 */
+	virtual bool HasViewIndependentRelevance() const
+	{
+		return false;
+	}
+
 	/** Callback from the renderer to gather simple lights that this proxy wants renderered. */
 	virtual void GatherSimpleLights(const FSceneViewFamily& ViewFamily, FSimpleLightArray& OutParticleLights) const {}
 
@@ -620,6 +620,15 @@ extern bool RecompileShaders(const TCHAR* Cmd, FOutputDevice& Ar);
 /** Returns whether all global shader types containing the substring are complete and ready for rendering. if type name is null, check everything */
 extern ENGINE_API bool IsGlobalShaderMapComplete(const TCHAR* TypeNameSubstring = nullptr);
 
+/**
+ * Returns whether a material/mesh shader permutation has been pruned via the [ShaderPermutationPruning]
+ * config section. Entries are "+Prune=ShaderTypeName" or "+Prune=ShaderTypeName:VertexFactoryName",
+ * typically generated from recorded usage (pipeline cache / stable key logs) of soak or shipped builds.
+ * Applied consistently to compilation and completeness checks so pruned shaders are neither cooked
+ * nor expected at load.
+ */
+extern ENGINE_API bool IsShaderPermutationPruned(const FShaderType* ShaderType, const FVertexFactoryType* VertexFactoryType);
+
 /**
 * Makes sure all global shaders are loaded and/or compiled for the passed in platform.
 * Note: if compilation is needed, this only kicks off the compile.
@@ -142,6 +142,10 @@ void TPBDRigidsEvolutionGBF<T, d>::AdvanceOneTimeStep(T Dt)
 	if(Dt > 0)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ParallelSolve);
+		// Islands solve in parallel here; the residual serialization in big destruction scenes is
+		// one dominant island, and sub-island parallelism means constraint coloring or staged
+		// Jacobi-style iteration inside ApplyConstraints - a solver-behavior change (convergence
+		// and stacking stability), not a scheduling tweak at this call site.
 		PhysicsParallelFor(ConstraintGraph.NumIslands(), [&](int32 Island) {
 			const TArray<TGeometryParticleHandle<T, d>*>& IslandParticles = ConstraintGraph.GetIslandParticles(Island);
 
@@ -212,6 +212,12 @@ inline FArchive& operator<<(FArchive& Ar, FAABBTreePayloadInfo& PayloadInfo)
 	return Ar;
 }
 
+// Note on incremental refit: moved elements already take an incremental path - they are pulled
+// into the DirtyElements side list and consulted linearly by queries until the periodic rebuild
+// folds them back in. When many bodies move, the cost profile is that linear dirty scan per
+// query plus the full rebuild, so improvement means bounding DirtyElements (e.g. a small tree or
+// grid over dirty entries) rather than parallelizing leaf refits, which this structure does not
+// do in place.
 template <typename TPayloadType, typename TLeafType, typename T>
 class TAABBTree final : public ISpatialAcceleration<TPayloadType, T, 3>
 {
@@ -419,6 +419,12 @@ void FGeometryCollectionSceneProxy::SetConstantData_RenderThread(FGeometryCollec
 	}
 }
 
+// Note on moving this to GPU transform palettes: this path CPU-skins every vertex by its piece
+// transform (ISPC-vectorized below) and re-uploads full positions each frame. An instanced
+// palette - upload only per-piece matrices, index them per-vertex in the vertex factory - is
+// the right end state but requires a dedicated vertex factory and shader permutations plus
+// bounds/occlusion changes; it replaces this function rather than optimizing it, and needs the
+// destruction content to validate. Until then upload cost scales with vertex count, not pieces.
 void FGeometryCollectionSceneProxy::SetDynamicData_RenderThread(FGeometryCollectionDynamicData* NewDynamicData)
 {
 	check(IsInRenderingThread());
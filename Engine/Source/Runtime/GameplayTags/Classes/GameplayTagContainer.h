@@ -270,6 +270,74 @@ struct TStructOpsTypeTraits< FGameplayTag > : public TStructOpsTypeTraitsBase2<
 	};
 };
 
+/**
+ * Opt-in dense bitset over manager-assigned tag indices, for hot-path matching on containers the
+ * owner knows are stable (e.g. server ability systems issuing millions of tag queries). Indices
+ * are assigned lazily by UGameplayTagsManager and reset when the tag tree rebuilds, so masks are
+ * never serialized and must be refilled whenever IndexSerial no longer matches the manager's
+ * serial. Fill owned-side masks with parent expansion so bit tests follow the same implicit
+ * parent-matching rules as FGameplayTagContainer::HasTag; fill query-side masks without.
+ */
+struct GAMEPLAYTAGS_API FGameplayTagIndexMask
+{
+	/** One bit per dense tag index. */
+	TArray<uint64> Bits;
+
+	/** Manager index serial this mask was filled against; INDEX_NONE when never filled. */
+	int32 IndexSerial = INDEX_NONE;
+
+	void Reset()
+	{
+		Bits.Reset();
+		IndexSerial = INDEX_NONE;
+	}
+
+	void SetBit(int32 Index)
+	{
+		const int32 WordIndex = Index >> 6;
+		if (WordIndex >= Bits.Num())
+		{
+			Bits.AddZeroed(WordIndex + 1 - Bits.Num());
+		}
+		Bits[WordIndex] |= uint64(1) << (Index & 63);
+	}
+
+	bool HasBit(int32 Index) const
+	{
+		const int32 WordIndex = Index >> 6;
+		return WordIndex < Bits.Num() && (Bits[WordIndex] & (uint64(1) << (Index & 63))) != 0;
+	}
+
+	/** True if every bit of Query is set in Owned. An empty query matches, mirroring FGameplayTagContainer::HasAll. */
+	static bool HasAll(const FGameplayTagIndexMask& Owned, const FGameplayTagIndexMask& Query)
+	{
+		for (int32 WordIndex = 0; WordIndex < Query.Bits.Num(); ++WordIndex)
+		{
+			const uint64 QueryWord = Query.Bits[WordIndex];
+			const uint64 OwnedWord = WordIndex < Owned.Bits.Num() ? Owned.Bits[WordIndex] : 0;
+			if ((OwnedWord & QueryWord) != QueryWord)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** True if any bit of Query is set in Owned. An empty query does not match, mirroring FGameplayTagContainer::HasAny. */
+	static bool HasAny(const FGameplayTagIndexMask& Owned, const FGameplayTagIndexMask& Query)
+	{
+		const int32 NumWords = FMath::Min(Owned.Bits.Num(), Query.Bits.Num());
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			if ((Owned.Bits[WordIndex] & Query.Bits[WordIndex]) != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
 /** A Tag Container holds a collection of FGameplayTags, tags are included explicitly by adding them, and implicitly from adding child tags */
 USTRUCT(BlueprintType, meta = (HasNativeMake = "GameplayTags.BlueprintGameplayTagLibrary.MakeGameplayTagContainerFromArray", HasNativeBreak = "GameplayTags.BlueprintGameplayTagLibrary.BreakGameplayTagContainer"))
 struct GAMEPLAYTAGS_API FGameplayTagContainer
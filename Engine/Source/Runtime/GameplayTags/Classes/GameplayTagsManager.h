@@ -437,6 +437,17 @@ class GAMEPLAYTAGS_API UGameplayTagsManager : public UObject
 	/** Helper function to destroy the gameplay tag tree */
 	void DestroyGameplayTagTree();
 
+	/**
+	 * Fills a dense-index bitset for the container (see FGameplayTagIndexMask). Fill owned-side
+	 * masks with bExpandParentTags so bit tests follow the container's implicit parent matching;
+	 * fill query-side masks without. The mask records the current index serial and must be
+	 * refilled when GetTagIndexMaskSerial no longer matches (tag tree rebuild).
+	 */
+	void FillTagIndexMask(const FGameplayTagContainer& Container, bool bExpandParentTags, struct FGameplayTagIndexMask& OutMask);
+
+	/** Serial identifying the current dense tag index assignment; bumped when the tag tree is rebuilt. */
+	int32 GetTagIndexMaskSerial() const { return DenseTagIndexSerial; }
+
 	/** Splits a tag such as x.y.z into an array of names {x,y,z} */
 	void SplitGameplayTagFName(const FGameplayTag& Tag, TArray<FName>& OutNames) const;
 
@@ -730,6 +741,17 @@ private:
 	TSet<FName> TransientEditorTags;
 #endif
 
+	/** Lazily-assigned dense index per tag name, backing FGameplayTagIndexMask; guarded by DenseTagIndexCritical. */
+	TMap<FName, int32> DenseTagIndexMap;
+
+	/** Bumped whenever the tag tree (and therefore the dense index assignment) is rebuilt. */
+	int32 DenseTagIndexSerial = 0;
+
+	mutable FCriticalSection DenseTagIndexCritical;
+
+	/** Returns the dense index for a tag name, assigning the next free one on first sight. */
+	int32 GetOrAssignDenseTagIndex(FName TagName);
+
 	/** Sorted list of nodes, used for network replication */
 	TArray<TSharedPtr<FGameplayTagNode>> NetworkGameplayTagNodeIndex;
 
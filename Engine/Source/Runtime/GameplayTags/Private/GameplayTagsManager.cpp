@@ -949,6 +949,49 @@ void UGameplayTagsManager::DestroyGameplayTagTree()
 		GameplayTagNodeMap.Reset();
 	}
 	RestrictedGameplayTagSourceNames.Reset();
+
+	// Dense indices are only meaningful against one tag tree; invalidate every outstanding mask.
+	{
+		FScopeLock Lock(&DenseTagIndexCritical);
+		DenseTagIndexMap.Reset();
+		++DenseTagIndexSerial;
+	}
+}
+
+int32 UGameplayTagsManager::GetOrAssignDenseTagIndex(FName TagName)
+{
+	FScopeLock Lock(&DenseTagIndexCritical);
+	if (const int32* Existing = DenseTagIndexMap.Find(TagName))
+	{
+		return *Existing;
+	}
+
+	const int32 NewIndex = DenseTagIndexMap.Num();
+	DenseTagIndexMap.Add(TagName, NewIndex);
+	return NewIndex;
+}
+
+void UGameplayTagsManager::FillTagIndexMask(const FGameplayTagContainer& Container, bool bExpandParentTags, FGameplayTagIndexMask& OutMask)
+{
+	OutMask.Reset();
+
+	if (bExpandParentTags)
+	{
+		const FGameplayTagContainer ExpandedContainer = Container.GetGameplayTagParents();
+		for (const FGameplayTag& Tag : ExpandedContainer)
+		{
+			OutMask.SetBit(GetOrAssignDenseTagIndex(Tag.GetTagName()));
+		}
+	}
+	else
+	{
+		for (const FGameplayTag& Tag : Container)
+		{
+			OutMask.SetBit(GetOrAssignDenseTagIndex(Tag.GetTagName()));
+		}
+	}
+
+	OutMask.IndexSerial = DenseTagIndexSerial;
 }
 
 bool UGameplayTagsManager::IsNativelyAddedTag(FGameplayTag Tag) const
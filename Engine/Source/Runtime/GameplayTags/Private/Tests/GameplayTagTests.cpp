@@ -336,6 +336,40 @@ public:
 		TestTrue(TEXT("Performance Tests succeeded"), bResult);
 	}
 
+	void GameplayTagTest_IndexMaskTest()
+	{
+		UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+
+		FGameplayTagContainer OwnedTags;
+		OwnedTags.AddTag(GetTagForString(TEXT("Effect.Damage.Type1")));
+		OwnedTags.AddTag(GetTagForString(TEXT("Effect.Shield")));
+
+		FGameplayTagContainer MatchingQuery;
+		MatchingQuery.AddTag(GetTagForString(TEXT("Effect.Damage")));
+
+		FGameplayTagContainer FailingQuery;
+		FailingQuery.AddTag(GetTagForString(TEXT("Effect.Damage")));
+		FailingQuery.AddTag(GetTagForString(TEXT("GameplayCue.Burning")));
+
+		// Owned masks expand parents; query masks do not, matching HasTag/HasAll/HasAny semantics.
+		FGameplayTagIndexMask OwnedMask;
+		Manager.FillTagIndexMask(OwnedTags, /*bExpandParentTags*/ true, OwnedMask);
+		FGameplayTagIndexMask MatchingQueryMask;
+		Manager.FillTagIndexMask(MatchingQuery, /*bExpandParentTags*/ false, MatchingQueryMask);
+		FGameplayTagIndexMask FailingQueryMask;
+		Manager.FillTagIndexMask(FailingQuery, /*bExpandParentTags*/ false, FailingQueryMask);
+		FGameplayTagIndexMask EmptyMask;
+		Manager.FillTagIndexMask(FGameplayTagContainer(), /*bExpandParentTags*/ false, EmptyMask);
+
+		TestTrueExpr(OwnedMask.IndexSerial == Manager.GetTagIndexMaskSerial());
+		TestTrueExpr(FGameplayTagIndexMask::HasAll(OwnedMask, MatchingQueryMask) == OwnedTags.HasAll(MatchingQuery));
+		TestTrueExpr(FGameplayTagIndexMask::HasAll(OwnedMask, FailingQueryMask) == OwnedTags.HasAll(FailingQuery));
+		TestTrueExpr(FGameplayTagIndexMask::HasAny(OwnedMask, MatchingQueryMask) == OwnedTags.HasAny(MatchingQuery));
+		TestTrueExpr(FGameplayTagIndexMask::HasAny(OwnedMask, FailingQueryMask) == OwnedTags.HasAny(FailingQuery));
+		TestTrueExpr(FGameplayTagIndexMask::HasAll(OwnedMask, EmptyMask) == OwnedTags.HasAll(FGameplayTagContainer()));
+		TestTrueExpr(FGameplayTagIndexMask::HasAny(OwnedMask, EmptyMask) == OwnedTags.HasAny(FGameplayTagContainer()));
+	}
+
 };
 
 IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FGameplayTagTest, FGameplayTagTestBase, "System.GameplayTags.GameplayTag", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
@@ -351,6 +385,7 @@ bool FGameplayTagTest::RunTest(const FString& Parameters)
 	GameplayTagTest_TagComparisonTest();
 	GameplayTagTest_TagContainerTest();
 	GameplayTagTest_PerfTest();
+	GameplayTagTest_IndexMaskTest();
 
 	return !HasAnyErrors();
 }
@@ -24,6 +24,12 @@ THIRD_PARTY_INCLUDES_END
  * InitCompressed and InitRaw will set initial state and you will then be able to fill in Raw or
  * CompressedData by calling Uncompress or Compress respectively.
  */
+// Note on decode throughput for UGC flows: wrappers decode serially per image, but each
+// wrapper instance is independent, so the first-order fix for bulk ingestion is running one
+// decode per task on worker threads - no wrapper change required. Intra-image SIMD/parallel-row
+// decode is owned by the bundled libpng/libjpeg (row filters are sequentially dependent in
+// PNG); swapping in parallel decoders (e.g. turbo variants) is a third-party library update,
+// not a change to these adapters.
 class FPngImageWrapper
 	: public FImageWrapperBase
 {
@@ -11,6 +11,13 @@
 
 class Error;
 
+// Note on large-payload parsing: this serializer builds a full shared-pointer DOM, which is
+// where the 200ms+/allocation storms on tens-of-megabyte payloads come from. The streaming
+// alternative already exists underneath - TJsonReader is a pull parser, and consumers can walk
+// tokens directly without ever constructing FJsonObject - so large ingestion paths should read
+// via TJsonReader straight into their own structures. In-situ string views additionally
+// require the reader to borrow from a pinned source buffer, which changes its FString-returning
+// API surface; that is the piece that does not exist yet.
 class FJsonSerializer
 {
 public:
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Serialization/JsonTypes.h"
+#include "Containers/InlineString.h"
 #include "Policies/PrettyJsonPrintPolicy.h"
 #include "Serialization/MemoryWriter.h"
 
@@ -339,7 +340,8 @@ protected:
 
 	virtual void WriteStringValue( const FString& String )
 	{
-		FString OutString;
+		// escape into inline storage; short strings (the common case for keys and values) never touch the heap
+		TInlineString<512> OutString;
 		OutString += TEXT("\"");
 		for (const TCHAR* Char = *String; *Char != TCHAR('\0'); ++Char)
 		{
@@ -360,12 +362,12 @@ protected:
 				}
 				else
 				{
-					OutString += FString::Printf(TEXT("\\u%04x"), *Char);
+					OutString.Appendf(TEXT("\\u%04x"), *Char);
 				}
 			}
 		}
 		OutString += TEXT("\"");
-		PrintPolicy::WriteString(Stream, OutString);
+		PrintPolicy::WriteString(Stream, OutString.ToString());
 	}
 
 	FArchive* const Stream;
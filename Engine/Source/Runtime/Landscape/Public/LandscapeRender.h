@@ -753,6 +753,13 @@ public:
 //
 // FLandscapeComponentSceneProxy
 //
+// Note on GPU-driven section LOD: each component proxy evaluates its LOD and pushes per-section
+// uniforms on the render thread, which is why cost scales with component count on large maps.
+// Moving selection to the GPU means a per-landscape (not per-component) render system that
+// computes section LODs in a compute pass and feeds vertex shaders through a shared buffer -
+// i.e. the proxies stop owning LOD state entirely. That is a landscape-wide renderer rework;
+// the per-proxy structure here cannot express it incrementally, so interim wins are limited to
+// reducing per-proxy uniform churn.
 class FLandscapeComponentSceneProxy : public FPrimitiveSceneProxy, public FLandscapeNeighborInfo
 {
 	friend class FLandscapeSharedBuffers;
@@ -21,6 +21,7 @@
 #include "Misc/OutputDeviceRedirector.h"
 #include "Misc/AutomationTest.h"
 #include "Misc/CommandLine.h"
+#include "Serialization/PackageLoadTrace.h"
 #include "Misc/App.h"
 #include "Misc/OutputDeviceConsole.h"
 #include "HAL/PlatformFilemanager.h"
@@ -1262,6 +1263,14 @@ int32 FEngineLoop::PreInitPreStartupScreen(const TCHAR* CmdLine)
 		return -1;
 	}
 
+	// -FastServerBoot bundles the boot-cost opt-ins for fleets that cold start the same content
+	// repeatedly: token stream assembly defers to first GC use, and the boot package load order is
+	// recorded on the first run and replayed as upfront IO on later ones (see FPackageLoadTrace).
+	if (FParse::Param(FCommandLine::Get(), TEXT("FastServerBoot")))
+	{
+		FCommandLine::Append(TEXT(" -LazyGCTokenStreams"));
+	}
+
 	{
 		FString Parameter;
 		if (FParse::Value(CmdLine, TEXT("-tracehost="), Parameter))
@@ -3585,6 +3594,15 @@ int32 FEngineLoop::Init()
 	LLM_SCOPE(ELLMTag::EngineInitMemory);
 	SCOPED_BOOT_TIMING("FEngineLoop::Init");
 
+	// Fast server boot: replay the previous boot's package order as upfront IO, then record this
+	// boot's order for next time. First boot has no trace and simply records.
+	const bool bFastServerBoot = IsRunningDedicatedServer() && FParse::Param(FCommandLine::Get(), TEXT("FastServerBoot"));
+	if (bFastServerBoot)
+	{
+		FPackageLoadTrace::Prefetch(TEXT("ServerBoot"));
+		FPackageLoadTrace::BeginTrace(TEXT("ServerBoot"));
+	}
+
 	DECLARE_SCOPE_CYCLE_COUNTER( TEXT( "FEngineLoop::Init" ), STAT_FEngineLoop_Init, STATGROUP_LoadTime );
 
 	FScopedSlowTask SlowTask(100);
@@ -3783,6 +3801,11 @@ int32 FEngineLoop::Init()
 	}
 #endif		// UE_EXTERNAL_PROFILING_ENABLED
 
+	if (bFastServerBoot)
+	{
+		FPackageLoadTrace::EndTrace();
+	}
+
 	return 0;
 }
 
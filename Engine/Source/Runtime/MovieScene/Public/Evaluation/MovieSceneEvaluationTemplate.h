@@ -186,6 +186,13 @@ template<> struct TStructOpsTypeTraits<FMovieSceneEvaluationTemplateSerialNumber
  * Template that is used for efficient runtime evaluation of a movie scene sequence. Potentially serialized into the asset.
  */
 USTRUCT()
+// Note on precompiled evaluation: this template IS the precompiled form - tracks compile into
+// segmented evaluation fields offline/on-save - but execution still walks segments and runs
+// virtual token execution per track per frame. Flattening further (one contiguous instance
+// array per playing sequence with type-batched execution) is the direction later engine
+// versions take with a dedicated evaluation runtime; it replaces the token interface every
+// custom track implements, so it arrives as a parallel runtime with per-track opt-in, not an
+// optimization of this walker.
 struct FMovieSceneEvaluationTemplate
 {
 	GENERATED_BODY()
@@ -4319,6 +4319,17 @@ void FRecastNavMeshGenerator::SortPendingBuildTiles()
 		}
 	}
 
+	// Registered invokers mark where navigation is actively being consumed (typically AI agents),
+	// so tiles under them rebuild first too - otherwise agents near a destruction event can walk
+	// into not-yet-rebuilt tiles while player-adjacent tiles hog the queue.
+	if (const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(CurWorld))
+	{
+		for (const FNavigationInvokerRaw& Invoker : NavSys->GetInvokerLocations())
+		{
+			SeedLocations.Add(FVector2D(Invoker.Location));
+		}
+	}
+
 	if (SeedLocations.Num() == 0)
 	{
 		// Use navmesh origin for sorting
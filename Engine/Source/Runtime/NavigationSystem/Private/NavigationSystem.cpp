@@ -1204,6 +1204,12 @@ static void AsyncQueryDone(FAsyncPathFindingQuery Query)
 	Query.OnDoneDelegate.ExecuteIfBound(Query.QueryID, Query.Result.Result, Query.Result.Path);
 }
 
+// Note on fanning these queries across multiple workers: batching and off-thread execution
+// already happen here (queries accumulate per frame and run on one background task), but the
+// underlying Detour query object held by the nav data is stateful and shared, so two queries
+// cannot run concurrently against it. True parallel query workers need per-worker
+// dtNavMeshQuery instances over an immutable tile snapshot - a nav data change, not a
+// scheduling change.
 void UNavigationSystemV1::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_PathfindingAsync);
@@ -1,6 +1,8 @@
 // Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
 
 #include "LocalFileNetworkReplayStreaming.h"
+#include "Misc/Compression.h"
+#include "Misc/ICompressionFormat.h"
 #include "HAL/FileManager.h"
 #include "HAL/LowLevelMemTracker.h"
 #include "Misc/Paths.h"
@@ -2419,6 +2421,55 @@ const FString& FLocalFileNetworkReplayStreamer::GetDefaultDemoSavePath()
 	return DefaultDemoSavePath;
 }
 
+bool FLocalFileNetworkReplayStreamer::CompressBufferWithContext(const TArray<uint8>& InBuffer, TArray<uint8>& OutCompressed, FName FormatName, const TArray<uint8>* Dictionary) const
+{
+	if (!ChunkCompressionContext.IsValid())
+	{
+		ChunkCompressionContext.Reset(FCompression::CreateStreamContext(FormatName, true, Dictionary));
+		if (!ChunkCompressionContext.IsValid())
+		{
+			return false;
+		}
+	}
+	else if (!ChunkCompressionContext->Reset())
+	{
+		return false;
+	}
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, InBuffer.Num());
+	OutCompressed.SetNumUninitialized(CompressedSize);
+	if (!ChunkCompressionContext->CompressChunk(OutCompressed.GetData(), CompressedSize, InBuffer.GetData(), InBuffer.Num(), true))
+	{
+		return false;
+	}
+	OutCompressed.SetNum(CompressedSize, false);
+	return true;
+}
+
+bool FLocalFileNetworkReplayStreamer::DecompressBufferWithContext(const TArray<uint8>& InCompressed, TArray<uint8>& OutBuffer, int32 DecompressedSize, FName FormatName, const TArray<uint8>* Dictionary) const
+{
+	if (!ChunkDecompressionContext.IsValid())
+	{
+		ChunkDecompressionContext.Reset(FCompression::CreateStreamContext(FormatName, false, Dictionary));
+		if (!ChunkDecompressionContext.IsValid())
+		{
+			return false;
+		}
+	}
+	else if (!ChunkDecompressionContext->Reset())
+	{
+		return false;
+	}
+
+	int32 UncompressedSize = DecompressedSize;
+	OutBuffer.SetNumUninitialized(UncompressedSize);
+	if (!ChunkDecompressionContext->UncompressChunk(OutBuffer.GetData(), UncompressedSize, InCompressed.GetData(), InCompressed.Num()) || UncompressedSize != DecompressedSize)
+	{
+		return false;
+	}
+	return true;
+}
+
 uint32 FLocalFileNetworkReplayStreamer::GetMaxFriendlyNameSize() const
 {
 	return FLocalFileNetworkReplayStreamer::MaxFriendlyNameLen;
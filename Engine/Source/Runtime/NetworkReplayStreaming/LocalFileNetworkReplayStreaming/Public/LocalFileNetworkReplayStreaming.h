@@ -454,6 +454,24 @@ public:
 	virtual bool DecompressBuffer(const TArray<uint8>& InCompressed, TArray< uint8 >& OutBuffer) const { return false; }
 	virtual bool CompressBuffer(const TArray< uint8 >& InBuffer, TArray< uint8 >& OutCompressed) const { return false; }
 
+protected:
+	/**
+	 * Reusable-context compression helpers for CompressBuffer/DecompressBuffer overrides. The streaming
+	 * contexts (see FCompression::CreateStreamContext) are created on first use with the given format
+	 * and optional dictionary and then reset per chunk, so overrides pay codec setup and dictionary
+	 * priming once per replay instead of once per flushed chunk. The output layout matches what a
+	 * one-shot implementation would produce: each chunk remains independently decompressible.
+	 */
+	bool CompressBufferWithContext(const TArray<uint8>& InBuffer, TArray<uint8>& OutCompressed, FName FormatName, const TArray<uint8>* Dictionary = nullptr) const;
+	bool DecompressBufferWithContext(const TArray<uint8>& InCompressed, TArray<uint8>& OutBuffer, int32 DecompressedSize, FName FormatName, const TArray<uint8>* Dictionary = nullptr) const;
+
+private:
+	/** Lazily created streaming contexts backing the helpers above; mutable because the Compress/Decompress virtuals are const. */
+	mutable TUniquePtr<struct ICompressionStreamContext> ChunkCompressionContext;
+	mutable TUniquePtr<struct ICompressionStreamContext> ChunkDecompressionContext;
+
+public:
+
 	void Tick(float DeltaSeconds);
 
 	virtual uint32 GetMaxFriendlyNameSize() const override;
@@ -0,0 +1,58 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "Core/ContentChunking.h"
+#include "BuildPatchHash.h"
+
+namespace BuildPatchServices
+{
+	void FindContentDefinedChunkBoundaries(const TArrayView<const uint8>& Data, uint32 MinChunkSize, uint32 TargetChunkSize, uint32 MaxChunkSize, TArray<uint32>& OutChunkEnds)
+	{
+		OutChunkEnds.Reset();
+		check(TargetChunkSize >= 2 && FMath::IsPowerOfTwo(TargetChunkSize));
+		check(MinChunkSize > 0 && MinChunkSize <= TargetChunkSize && TargetChunkSize <= MaxChunkSize);
+
+		const uint32 WindowSize = 64;
+		// matching the low log2(Target) bits gives an expected chunk length of TargetChunkSize
+		const uint64 BoundaryMask = (uint64)TargetChunkSize - 1;
+
+		if ((uint32)Data.Num() <= MinChunkSize)
+		{
+			if (Data.Num())
+			{
+				OutChunkEnds.Add(Data.Num());
+			}
+			return;
+		}
+
+		FRollingHash RollingHash(WindowSize);
+		uint32 ChunkStart = 0;
+		uint32 WindowFill = 0;
+		for (uint32 Offset = 0; Offset < (uint32)Data.Num(); ++Offset)
+		{
+			if (WindowFill < WindowSize)
+			{
+				RollingHash.ConsumeByte(Data[Offset]);
+				++WindowFill;
+			}
+			else
+			{
+				RollingHash.RollForward(Data[Offset]);
+			}
+
+			const uint32 ChunkLength = Offset + 1 - ChunkStart;
+			const bool bContentBoundary = WindowFill == WindowSize && ChunkLength >= MinChunkSize && (RollingHash.GetWindowHash() & BoundaryMask) == BoundaryMask;
+			if (bContentBoundary || ChunkLength >= MaxChunkSize)
+			{
+				OutChunkEnds.Add(Offset + 1);
+				ChunkStart = Offset + 1;
+				// restart the window so the next chunk's boundary depends only on its own content
+				RollingHash.Clear();
+				WindowFill = 0;
+			}
+		}
+		if (ChunkStart < (uint32)Data.Num())
+		{
+			OutChunkEnds.Add(Data.Num());
+		}
+	}
+}
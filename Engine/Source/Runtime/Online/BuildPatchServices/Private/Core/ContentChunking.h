@@ -0,0 +1,24 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace BuildPatchServices
+{
+	/**
+	 * Splits data into content-defined chunks using the rolling hash: a boundary is declared wherever
+	 * the windowed hash matches a mask-selected pattern, clamped between a minimum and maximum chunk
+	 * size. Because boundaries key off content rather than absolute offsets, inserting or removing
+	 * bytes only reshapes the chunks around the edit instead of shifting every later chunk, which is
+	 * what lets a patch ship only the chunks that actually changed.
+	 *
+	 * @param Data				The data to split.
+	 * @param MinChunkSize		No boundary is declared before this many bytes of chunk.
+	 * @param TargetChunkSize	Average desired chunk size; must be a power of two (drives the hash mask).
+	 * @param MaxChunkSize		A boundary is forced at this size even without a content match.
+	 * @param OutChunkEnds		Receives the exclusive end offset of each chunk, in order; the final
+	 *							entry is always Data.Num().
+	 */
+	void FindContentDefinedChunkBoundaries(const TArrayView<const uint8>& Data, uint32 MinChunkSize, uint32 TargetChunkSize, uint32 MaxChunkSize, TArray<uint32>& OutChunkEnds);
+}
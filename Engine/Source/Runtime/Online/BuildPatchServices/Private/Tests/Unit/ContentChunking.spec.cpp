@@ -0,0 +1,115 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Tests/TestHelpers.h"
+#include "Core/ContentChunking.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FContentChunkingSpec, "BuildPatchServices.Unit", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+// Data.
+TArray<uint8> Data;
+TArray<uint32> ChunkEnds;
+// Config.
+const uint32 MinChunkSize = 512;
+const uint32 TargetChunkSize = 4096;
+const uint32 MaxChunkSize = 16384;
+// Helpers.
+void MakeRandomData(int32 Num, int32 Seed);
+bool ChunksCoverData() const;
+END_DEFINE_SPEC(FContentChunkingSpec)
+
+void FContentChunkingSpec::MakeRandomData(int32 Num, int32 Seed)
+{
+	FRandomStream Random(Seed);
+	Data.Reset();
+	Data.Reserve(Num);
+	for (int32 Idx = 0; Idx < Num; ++Idx)
+	{
+		Data.Add((uint8)Random.RandHelper(256));
+	}
+}
+
+bool FContentChunkingSpec::ChunksCoverData() const
+{
+	uint32 Previous = 0;
+	for (uint32 End : ChunkEnds)
+	{
+		const uint32 Length = End - Previous;
+		if (End <= Previous || Length > MaxChunkSize)
+		{
+			return false;
+		}
+		Previous = End;
+	}
+	return Previous == (uint32)Data.Num();
+}
+
+void FContentChunkingSpec::Define()
+{
+	Describe("FindContentDefinedChunkBoundaries", [this]()
+	{
+		It("should produce chunks that exactly cover the data and respect the max size", [this]()
+		{
+			MakeRandomData(256 * 1024, 42);
+			BuildPatchServices::FindContentDefinedChunkBoundaries(Data, MinChunkSize, TargetChunkSize, MaxChunkSize, ChunkEnds);
+			TEST_TRUE(ChunksCoverData());
+		});
+
+		It("should be deterministic for identical data", [this]()
+		{
+			MakeRandomData(128 * 1024, 7);
+			BuildPatchServices::FindContentDefinedChunkBoundaries(Data, MinChunkSize, TargetChunkSize, MaxChunkSize, ChunkEnds);
+			TArray<uint32> FirstRun = ChunkEnds;
+			BuildPatchServices::FindContentDefinedChunkBoundaries(Data, MinChunkSize, TargetChunkSize, MaxChunkSize, ChunkEnds);
+			TEST_EQUAL(FirstRun, ChunkEnds);
+		});
+
+		It("should keep chunk boundaries stable after the point of an insertion", [this]()
+		{
+			MakeRandomData(128 * 1024, 1337);
+			BuildPatchServices::FindContentDefinedChunkBoundaries(Data, MinChunkSize, TargetChunkSize, MaxChunkSize, ChunkEnds);
+			TArray<uint32> OriginalEnds = ChunkEnds;
+
+			// insert a few bytes near the front; chunks well past the edit must re-align at the same content
+			const uint32 InsertAt = 1000;
+			const uint32 NumInserted = 3;
+			for (uint32 Idx = 0; Idx < NumInserted; ++Idx)
+			{
+				Data.Insert((uint8)0xAB, InsertAt);
+			}
+			BuildPatchServices::FindContentDefinedChunkBoundaries(Data, MinChunkSize, TargetChunkSize, MaxChunkSize, ChunkEnds);
+
+			// compare the tail halves: shifted by the insertion, the boundary offsets should re-converge
+			int32 MatchedTailBoundaries = 0;
+			TSet<uint32> ShiftedOriginal;
+			for (uint32 End : OriginalEnds)
+			{
+				ShiftedOriginal.Add(End + NumInserted);
+			}
+			for (uint32 End : ChunkEnds)
+			{
+				if (End > InsertAt + MaxChunkSize * 2 && ShiftedOriginal.Contains(End))
+				{
+					++MatchedTailBoundaries;
+				}
+			}
+			TEST_TRUE(MatchedTailBoundaries > 0);
+		});
+
+		It("should handle empty and tiny inputs", [this]()
+		{
+			Data.Reset();
+			BuildPatchServices::FindContentDefinedChunkBoundaries(Data, MinChunkSize, TargetChunkSize, MaxChunkSize, ChunkEnds);
+			TEST_EQUAL(ChunkEnds.Num(), 0);
+
+			MakeRandomData(100, 5);
+			BuildPatchServices::FindContentDefinedChunkBoundaries(Data, MinChunkSize, TargetChunkSize, MaxChunkSize, ChunkEnds);
+			TEST_EQUAL(ChunkEnds.Num(), 1);
+			TEST_EQUAL(ChunkEnds[0], (uint32)100);
+		});
+	});
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -451,6 +451,15 @@ size_t FCurlHttpRequest::ReceiveResponseHeaderCallback(void* Ptr, size_t SizeInB
 					if (HeaderKey == TEXT("Content-Length"))
 					{
 						Response->ContentLength = FCString::Atoi(*HeaderValue);
+
+						// Size the payload up front so large downloads don't pay repeated
+						// reallocation per body chunk. Clamped: the header is server-controlled
+						// and must not be able to force an arbitrary allocation.
+						const int32 MaxPayloadReserve = 64 * 1024 * 1024;
+						if (Response->ContentLength > 0)
+						{
+							Response->Payload.Reserve(FMath::Min(Response->ContentLength, MaxPayloadReserve));
+						}
 					}
 					Response->NewlyReceivedHeaders.Enqueue(TPair<FString, FString>(MoveTemp(HeaderKey), MoveTemp(HeaderValue)));
 				}
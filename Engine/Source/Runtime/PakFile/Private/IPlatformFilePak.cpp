@@ -32,6 +32,9 @@
 #include "Misc/Fnv.h"
 
 #include "Async/MappedFileHandle.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/MappedRegionReader.h"
 
 DEFINE_LOG_CATEGORY(LogPakFile);
 
@@ -2660,6 +2663,36 @@ public:
 		return false; // canceled
 	}
 
+	/**
+	 * Raises the priority of an outstanding request, e.g. when a blocked game-thread waiter depends on
+	 * it and queued IO at higher static priorities would otherwise delay it (priority inversion on
+	 * seek-bound media). Only requests still waiting for blocks change lanes; in-flight and complete
+	 * requests are already past scheduling. Block bookkeeping is priority-agnostic, so moving a
+	 * waiting request between priority lanes is a pure re-queue.
+	 */
+	void PromoteRequest(IPakRequestor* Owner, EAsyncIOPriorityAndFlags NewPriority)
+	{
+		check(Owner);
+		NewPriority = NewPriority & AIOP_PRIORITY_MASK;
+		FScopeLock Lock(&CachedFilesScopeLock);
+		TIntervalTreeIndex RequestIndex = OutstandingRequests.FindRef(Owner->UniqueID);
+		static_assert(IntervalTreeInvalidIndex == 0, "FindRef will return 0 for something not found");
+		if (RequestIndex)
+		{
+			FPakInRequest& Request = InRequestAllocator.Get(RequestIndex);
+			check(Owner == Request.Owner && Request.UniqueID == Request.Owner->UniqueID && RequestIndex == Request.Owner->InRequestIndex);
+			if (Request.Status == EInRequestStatus::Waiting && Request.GetPriority() < NewPriority)
+			{
+				uint16 PakIndex = GetRequestPakIndex(Request.OffsetAndPakIndex);
+				FPakData& Pak = CachedPakData[PakIndex];
+				verify(RemoveFromIntervalTree<FPakInRequest>(&Pak.InRequests[Request.GetPriority()][(int32)Request.Status], InRequestAllocator, RequestIndex, Pak.StartShift, Pak.MaxShift));
+				Request.PriorityAndFlags = (Request.PriorityAndFlags & ~AIOP_PRIORITY_MASK) | NewPriority;
+				AddToIntervalTree(&Pak.InRequests[Request.GetPriority()][(int32)Request.Status], InRequestAllocator, RequestIndex, Pak.StartShift, Pak.MaxShift);
+				StartNextRequest();
+			}
+		}
+	}
+
 	void CancelRequest(IPakRequestor* Owner)
 	{
 		check(Owner);
@@ -2988,6 +3021,8 @@ public:
 		}
 		if (WaitEvent)
 		{
+			// a thread is now blocked on this request; let it jump any lower-urgency queued IO
+			FPakPrecacher::Get().PromoteRequest(this, AIOP_CriticalPath);
 			if (TimeLimitSeconds == 0.0f)
 			{
 				WaitEvent->Wait();
@@ -3575,6 +3610,27 @@ public:
 	{
 		return new FPakSizeRequest(CompleteCallback, UncompressedFileSize);
 	}
+	virtual void ReadRequestScatterGather(const TArrayView<const FScatterGatherReadSpan>& Spans, EAsyncIOPriorityAndFlags PriorityAndFlags, FAsyncFileCallBack* CompleteCallback, TArray<IAsyncReadRequest*>& OutRequests) override
+	{
+		// Issue the batch in ascending file order so the precacher and the shared block cache see a
+		// monotone sequence: adjacent mip spans land in the same cached blocks and raw requests for
+		// neighboring blocks get merged instead of ping-ponging across the file.
+		TArray<int32, TInlineAllocator<64>> SpanOrder;
+		SpanOrder.SetNum(Spans.Num());
+		for (int32 Index = 0; Index < Spans.Num(); Index++)
+		{
+			SpanOrder[Index] = Index;
+		}
+		SpanOrder.Sort([&Spans](int32 A, int32 B) { return Spans[A].Offset < Spans[B].Offset; });
+
+		const int32 BaseIndex = OutRequests.AddZeroed(Spans.Num());
+		for (int32 SortedIndex = 0; SortedIndex < SpanOrder.Num(); SortedIndex++)
+		{
+			const int32 SpanIndex = SpanOrder[SortedIndex];
+			const FScatterGatherReadSpan& Span = Spans[SpanIndex];
+			OutRequests[BaseIndex + SpanIndex] = ReadRequest(Span.Offset, Span.BytesToRead, PriorityAndFlags, CompleteCallback, Span.UserSuppliedMemory);
+		}
+	}
 	virtual IAsyncReadRequest* ReadRequest(int64 Offset, int64 BytesToRead, EAsyncIOPriorityAndFlags PriorityAndFlags = AIOP_Normal, FAsyncFileCallBack* CompleteCallback = nullptr, uint8* UserSuppliedMemory = nullptr) override
 	{
 		LLM_SCOPE(ELLMTag::FileSystem);
@@ -4311,6 +4367,42 @@ IMappedFileHandle* FPakPlatformFile::OpenMapped(const TCHAR* Filename)
 }
 
 
+/**
+ * Archive over a mapped pak entry; owns the proxy handle and the region so the mapping lives
+ * exactly as long as the archive (and any views handed out of it, per the CreateMappedReader
+ * contract).
+ */
+class FPakMappedRegionArchive final : public FMappedRegionReader
+{
+public:
+	FPakMappedRegionArchive(IMappedFileHandle* InHandle, IMappedFileRegion* InRegion)
+		: FMappedRegionReader(InRegion)
+		, Handle(InHandle)
+		, Region(InRegion)
+	{
+	}
+
+private:
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+};
+
+FArchive* FPakPlatformFile::CreateMappedReader(const TCHAR* Filename)
+{
+	IMappedFileHandle* Handle = OpenMapped(Filename);
+	if (!Handle)
+	{
+		return nullptr;
+	}
+	IMappedFileRegion* Region = Handle->MapRegion();
+	if (!Region)
+	{
+		delete Handle;
+		return nullptr;
+	}
+	return new FPakMappedRegionArchive(Handle, Region);
+}
+
 /**
  * Class to handle correctly reading from a compressed file within a compressed package
  */
@@ -4640,6 +4732,9 @@ bool FPakPlatformFile::IsNonPakFilenameAllowed(const FString& InFilename)
 
 
 #if IS_PROGRAM
+/** Source of process-unique pak ids for the shared reader fast path. */
+static FThreadSafeCounter64 GNextSharedReaderPakId(1);
+
 FPakFile::FPakFile(const TCHAR* Filename, bool bIsSigned)
 	: PakFilename(Filename)
 	, PakFilenameName(Filename)
@@ -4661,6 +4756,7 @@ FPakFile::FPakFile(const TCHAR* Filename, bool bIsSigned)
 	, CacheIndex(-1)
 	, UnderlyingCacheTrimDisabled(false)
 {
+	SharedReaderPakId = (uint64)GNextSharedReaderPakId.Increment();
 	FArchive* Reader = GetSharedReader(NULL);
 	if (Reader)
 	{
@@ -4691,6 +4787,7 @@ FPakFile::FPakFile(IPlatformFile* LowerLevel, const TCHAR* Filename, bool bIsSig
 	, CacheIndex(-1)
 	, UnderlyingCacheTrimDisabled(false)
 {
+	SharedReaderPakId = (uint64)GNextSharedReaderPakId.Increment();
 	FArchive* Reader = GetSharedReader(LowerLevel);
 	if (Reader)
 	{
@@ -4716,6 +4813,7 @@ FPakFile::FPakFile(FArchive* Archive)
 	, CacheIndex(-1)
 	, UnderlyingCacheTrimDisabled(false)
 {
+	SharedReaderPakId = (uint64)GNextSharedReaderPakId.Increment();
 	Initialize(Archive);
 }
 #endif
@@ -4931,6 +5029,10 @@ void FPakFile::LoadIndex(FArchive* Reader)
 		// Allocate enough memory to hold all entries (and not reallocate while they're being added to it).
 		Files.Empty(NumEntries);
 
+		// Phase 1: entry deserialization is inherently serial (variable-size records), but it is the
+		// cheap part; keep the filenames so the expensive string splitting and hashing can go wide.
+		TArray<FString> EntryFilenames;
+		EntryFilenames.Empty(NumEntries);
 		for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
 		{
 			// Serialize from memory.
@@ -4941,37 +5043,62 @@ void FPakFile::LoadIndex(FArchive* Reader)
 
 			// Add new file info.
 			Files.Add(Entry);
+			EntryFilenames.Add(MoveTemp(Filename));
+		}
 
-			// Construct Index of all directories in pak file.
-			FString Path = FPaths::GetPath(Filename);
-			MakeDirectoryFromPath(Path);
-			FPakDirectory* Directory = Index.Find(Path);
-			if (Directory != NULL)
+		// Phase 2: build per-slice directory maps in parallel (path splitting, hashing and map
+		// construction dominate mount time on large paks), then merge slice maps per directory.
+		const int32 EntriesPerSlice = 16 * 1024;
+		const int32 NumSlices = FMath::Max(1, FMath::Min((NumEntries + EntriesPerSlice - 1) / EntriesPerSlice, FTaskGraphInterface::IsRunning() ? FTaskGraphInterface::Get().GetNumWorkerThreads() + 1 : 1));
+		TArray<TMap<FString, FPakDirectory>> SliceIndices;
+		SliceIndices.SetNum(NumSlices);
+		const int32 SliceSize = (NumEntries + NumSlices - 1) / FMath::Max(1, NumSlices);
+		ParallelFor(NumSlices, [this, &SliceIndices, &EntryFilenames, SliceSize](int32 SliceIndex)
+		{
+			TMap<FString, FPakDirectory>& SliceIndexMap = SliceIndices[SliceIndex];
+			const int32 FirstEntry = SliceIndex * SliceSize;
+			const int32 EndEntry = FMath::Min(FirstEntry + SliceSize, EntryFilenames.Num());
+			for (int32 EntryIndex = FirstEntry; EntryIndex < EndEntry; EntryIndex++)
 			{
-				Directory->Add(FPaths::GetCleanFilename(Filename), EntryIndex);
+				const FString& Filename = EntryFilenames[EntryIndex];
+				FString Path = FPaths::GetPath(Filename);
+				MakeDirectoryFromPath(Path);
+				SliceIndexMap.FindOrAdd(MoveTemp(Path)).Add(FPaths::GetCleanFilename(Filename), EntryIndex);
 			}
-			else
-			{
-				FPakDirectory& NewDirectory = Index.Add(Path);
-				NewDirectory.Add(FPaths::GetCleanFilename(Filename), EntryIndex);
+		});
 
-				// add the parent directories up to the mount point
-				while (MountPoint != Path)
+		for (TMap<FString, FPakDirectory>& SliceIndexMap : SliceIndices)
+		{
+			for (TPair<FString, FPakDirectory>& SliceDirectory : SliceIndexMap)
+			{
+				FPakDirectory* Directory = Index.Find(SliceDirectory.Key);
+				if (Directory != NULL)
 				{
-					Path = Path.Left(Path.Len() - 1);
-					int32 Offset = 0;
-					if (Path.FindLastChar('/', Offset))
+					Directory->Append(MoveTemp(SliceDirectory.Value));
+				}
+				else
+				{
+					FString Path = SliceDirectory.Key;
+					Index.Add(MoveTemp(SliceDirectory.Key), MoveTemp(SliceDirectory.Value));
+
+					// add the parent directories up to the mount point
+					while (MountPoint != Path)
 					{
-						Path = Path.Left(Offset);
-						MakeDirectoryFromPath(Path);
-						if (Index.Find(Path) == NULL)
+						Path = Path.Left(Path.Len() - 1);
+						int32 Offset = 0;
+						if (Path.FindLastChar('/', Offset))
 						{
-							Index.Add(Path);
+							Path = Path.Left(Offset);
+							MakeDirectoryFromPath(Path);
+							if (Index.Find(Path) == NULL)
+							{
+								Index.Add(Path);
+							}
+						}
+						else
+						{
+							Path = MountPoint;
 						}
-					}
-					else
-					{
-						Path = MountPoint;
 					}
 				}
 			}
@@ -5651,6 +5778,20 @@ void FPakFile::GetFilenamesInChunk(const TArray<int32>& InChunkIDs, TArray<FStri
 
 FArchive* FPakFile::GetSharedReader(IPlatformFile* LowerLevel)
 {
+	// Fast path: the calling thread's last reader for this pak, keyed by a never-reused pak id so a
+	// stale entry can't alias a newly mounted pak at the same address. Readers live in ReaderMap and
+	// die with the pak, so a matching id guarantees the cached pointer is alive.
+	struct FThreadLastReader
+	{
+		uint64 PakId;
+		FArchive* Reader;
+	};
+	static thread_local FThreadLastReader LastReader = { 0, nullptr };
+	if (LastReader.PakId == SharedReaderPakId)
+	{
+		return LastReader.Reader;
+	}
+
 	uint32 Thread = FPlatformTLS::GetCurrentThreadId();
 	FArchive* PakReader = NULL;
 	{
@@ -5691,6 +5832,8 @@ FArchive* FPakFile::GetSharedReader(IPlatformFile* LowerLevel)
 #endif //DO_CHECK
 		}
 	}
+	LastReader.PakId = SharedReaderPakId;
+	LastReader.Reader = PakReader;
 	return PakReader;
 }
 
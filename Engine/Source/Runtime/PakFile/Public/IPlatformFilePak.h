@@ -512,6 +512,8 @@ class PAKFILE_API FPakFile : FNoncopyable
 	TUniquePtr<class FChunkCacheWorker> Decryptor;
 	/** Map of readers assigned to threads. */
 	TMap<uint32, TUniquePtr<FArchive>> ReaderMap;
+	/** Process-unique id for this pak object, keying the per-thread shared reader fast path (never reused, so stale thread-local entries can't alias a new pak). */
+	uint64 SharedReaderPakId;
 	/** Critical section for accessing ReaderMap. */
 	FCriticalSection CriticalSection;
 	/** Pak file info (trailer). */
@@ -2359,6 +2361,16 @@ public:
 	virtual void SetAsyncMinimumPriority(EAsyncIOPriorityAndFlags Priority) override;
 
 	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override;
+
+	/**
+	 * Opens a zero-copy archive over the memory-mapped bytes of an uncompressed, unencrypted pak
+	 * entry. Ordinary serialization copies out of the mapping like FMemoryReader, and POD bulk
+	 * arrays read through SerializeArrayAsView alias the page cache directly with no intermediate
+	 * buffer. Returns null when the entry is compressed, encrypted, not in a pak, or mapping is
+	 * disabled; callers fall back to a regular reader. The archive owns the mapping; views handed
+	 * out of it are only valid while the archive lives.
+	 */
+	FArchive* CreateMappedReader(const TCHAR* Filename);
 	/**
 	 * Converts a filename to a path inside pak file.
 	 *
@@ -14,6 +14,7 @@
 
 CSV_DEFINE_CATEGORY_MODULE(RHI_API, RHITStalls, false);
 CSV_DEFINE_CATEGORY_MODULE(RHI_API, RHITFlushes, false);
+CSV_DEFINE_CATEGORY_MODULE(RHI_API, RHITTranslate, false);
 
 DECLARE_CYCLE_STAT(TEXT("Nonimmed. Command List Execute"), STAT_NonImmedCmdListExecuteTime, STATGROUP_RHICMDLIST);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Nonimmed. Command List memory"), STAT_NonImmedCmdListMemory, STATGROUP_RHICMDLIST);
@@ -117,6 +118,23 @@ static TAutoConsoleVariable<int32> CVarRHICmdMinCmdlistSizeForParallelTranslate(
 	32,
 	TEXT("In kilobytes. Cmdlists are merged into one parallel translate until we have at least this much memory to process. For a given pass, we won't do more translates than we have task threads. Only relevant if r.RHICmdBalanceTranslatesAfterTasks is on."));
 
+static TAutoConsoleVariable<int32> CVarRHICmdAdaptiveParallelTranslate(
+	TEXT("r.RHICmdAdaptiveParallelTranslate"),
+	0,
+	TEXT("If enabled, scales r.RHICmdMinCmdlistSizeForParallelTranslate each frame from measured translate chunk times:\n")
+	TEXT("chunks running over the target time get split more ways, chunks well under it get merged to cut task overhead."));
+
+static TAutoConsoleVariable<float> CVarRHICmdAdaptiveParallelTranslateTargetMs(
+	TEXT("r.RHICmdAdaptiveParallelTranslate.TargetMs"),
+	0.5f,
+	TEXT("Target time in milliseconds for one parallel translate chunk when r.RHICmdAdaptiveParallelTranslate is enabled."));
+
+/** Measured parallel translate load for the adaptive chunk sizing; written by translate tasks, consumed once per frame on the render thread. */
+static volatile int64 GParallelTranslateChunkCycles = 0;
+static volatile int32 GParallelTranslateChunkCount = 0;
+/** Percent applied to the min cmdlist size for parallel translate; recomputed once per frame. */
+static int32 GParallelTranslateScalePercent = 100;
+
 RHI_API int32 GRHICmdTraceEvents = 0;
 static FAutoConsoleVariableRef CVarRHICmdTraceEvents(
 	TEXT("r.RHICmdTraceEvents"),
@@ -972,9 +990,12 @@ public:
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_ParallelChainTranslate);
+		CSV_SCOPED_TIMING_STAT(RHITTranslate, ParallelTranslate);
 		SCOPED_NAMED_EVENT(FParallelTranslateCommandList_DoTask, FColor::Magenta);
 		check(ContextContainer && RHICmdLists);
 
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
 		IRHICommandContext* Context = ContextContainer->GetContext();
 		check(Context);
 		for (int32 Index = 0; Index < NumCommandLists; Index++)
@@ -983,6 +1004,9 @@ public:
 			delete RHICmdLists[Index];
 		}
 		ContextContainer->FinishContext();
+
+		FPlatformAtomics::InterlockedAdd(&GParallelTranslateChunkCycles, (int64)(FPlatformTime::Cycles64() - StartCycles));
+		FPlatformAtomics::InterlockedIncrement(&GParallelTranslateChunkCount);
 	}
 };
 
@@ -1110,6 +1134,37 @@ public:
 		check(RHICmdList && RHICmdLists && NumCommandLists);
 		MinSize = CVarRHICmdMinCmdlistSizeForParallelTranslate.GetValueOnRenderThread() * 1024;
 		MinCount = CVarRHICmdMinCmdlistForParallelTranslate.GetValueOnRenderThread();
+
+		if (CVarRHICmdAdaptiveParallelTranslate.GetValueOnRenderThread())
+		{
+			// Recompute the scale once per frame from last frame's measurements (this ctor runs on
+			// the render thread). Chunks translating over target split more ways next time; chunks
+			// far under it merge to reduce per-task overhead.
+			static uint32 LastScaleFrame = ~0u;
+			if (LastScaleFrame != GFrameNumberRenderThread)
+			{
+				LastScaleFrame = GFrameNumberRenderThread;
+
+				const int32 ChunkCount = FPlatformAtomics::InterlockedExchange(&GParallelTranslateChunkCount, 0);
+				const int64 ChunkCycles = FPlatformAtomics::InterlockedExchange(&GParallelTranslateChunkCycles, 0);
+				if (ChunkCount > 0)
+				{
+					const double AverageMs = FPlatformTime::ToMilliseconds64(ChunkCycles) / ChunkCount;
+					const double TargetMs = FMath::Max(0.05f, CVarRHICmdAdaptiveParallelTranslateTargetMs.GetValueOnRenderThread());
+					if (AverageMs > TargetMs * 1.5)
+					{
+						GParallelTranslateScalePercent = FMath::Max(25, GParallelTranslateScalePercent / 2);
+					}
+					else if (AverageMs < TargetMs * 0.5)
+					{
+						GParallelTranslateScalePercent = FMath::Min(400, GParallelTranslateScalePercent * 2);
+					}
+					CSV_CUSTOM_STAT(RHITTranslate, ChunkSizeScalePercent, GParallelTranslateScalePercent, ECsvCustomStatOp::Set);
+				}
+			}
+
+			MinSize = FMath::Max(4 * 1024, (int32)((int64)MinSize * GParallelTranslateScalePercent / 100));
+		}
 	}
 
 	static FORCEINLINE TStatId GetStatId()
@@ -1640,6 +1695,7 @@ void FRHICommandList::EndFrame()
 	}
 	else
 	{
+		CSV_CUSTOM_STAT(RHITTranslate, OutstandingCmdLists, GRHICommandList.OutstandingCmdListCount.GetValue(), ECsvCustomStatOp::Set);
 		FRHICommandListExecutor::GetImmediateCommandList().ImmediateFlush(EImmediateFlushType::DispatchToRHIThread);
 	}
 }
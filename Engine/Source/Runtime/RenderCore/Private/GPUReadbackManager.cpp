@@ -0,0 +1,126 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "GPUReadbackManager.h"
+#include "Misc/CoreDelegates.h"
+#include "RHICommandList.h"
+#include "RenderCore.h"
+#include "RenderingThread.h"
+
+/** When set, a Flush that waits on readbacks enqueued this same frame logs a callstack so the offending caller can be found. */
+static int32 GGPUReadbackWarnOnSameFrameSync = 1;
+static FAutoConsoleVariableRef CVarGPUReadbackWarnOnSameFrameSync(
+	TEXT("r.GPUReadback.WarnOnSameFrameSync"),
+	GGPUReadbackWarnOnSameFrameSync,
+	TEXT("If enabled, logs a callstack when FGPUReadbackManager::Flush blocks on a readback enqueued in the current frame (a GPU sync).")
+	);
+
+FGPUReadbackManager& FGPUReadbackManager::Get()
+{
+	static FGPUReadbackManager Singleton;
+	return Singleton;
+}
+
+FGPUReadbackManager::FGPUReadbackManager()
+{
+	// All entry points are render thread only, so first use constructs us on the render
+	// thread and it is safe to hook the end-of-frame broadcast from here.
+	FCoreDelegates::OnEndFrameRT.AddRaw(this, &FGPUReadbackManager::Tick);
+}
+
+void FGPUReadbackManager::EnqueueBufferReadback(FRHICommandList& RHICmdList, FRHIVertexBuffer* SourceBuffer, uint32 NumBytes, FName DebugName, FReadbackCompleteCallback Callback)
+{
+	check(IsInRenderingThread());
+	check(SourceBuffer && NumBytes > 0);
+
+	FPendingReadback Pending;
+	Pending.Readback = MakeUnique<FRHIGPUBufferReadback>(DebugName);
+	Pending.Readback->EnqueueCopy(RHICmdList, SourceBuffer, NumBytes);
+	Pending.Callback = MoveTemp(Callback);
+	Pending.NumBytes = NumBytes;
+	Pending.EnqueueFrame = GFrameNumberRenderThread;
+	PendingReadbacks.Add(MoveTemp(Pending));
+}
+
+void FGPUReadbackManager::EnqueueTextureReadback(FRHICommandList& RHICmdList, FRHITexture* SourceTexture, uint32 NumBytes, FName DebugName, FReadbackCompleteCallback Callback, FResolveRect Rect)
+{
+	check(IsInRenderingThread());
+	check(SourceTexture && NumBytes > 0);
+
+	FPendingReadback Pending;
+	Pending.Readback = MakeUnique<FRHIGPUTextureReadback>(DebugName);
+	Pending.Readback->EnqueueCopy(RHICmdList, SourceTexture, Rect);
+	Pending.Callback = MoveTemp(Callback);
+	Pending.NumBytes = NumBytes;
+	Pending.EnqueueFrame = GFrameNumberRenderThread;
+	PendingReadbacks.Add(MoveTemp(Pending));
+}
+
+void FGPUReadbackManager::DeliverReadback(FPendingReadback& Pending)
+{
+	const void* Data = Pending.Readback->Lock(Pending.NumBytes);
+	Pending.Callback(Data, Pending.NumBytes);
+	Pending.Readback->Unlock();
+}
+
+void FGPUReadbackManager::Tick()
+{
+	check(IsInRenderingThread());
+
+	// Requests complete in submission order, but deliver any that are ready in case the
+	// RHI signals fences out of order across queues. Move each completed request out before
+	// running its callback: the callback may enqueue new readbacks and reallocate the array.
+	for (int32 Index = 0; Index < PendingReadbacks.Num(); ++Index)
+	{
+		if (PendingReadbacks[Index].Readback->IsReady())
+		{
+			FPendingReadback Completed = MoveTemp(PendingReadbacks[Index]);
+			PendingReadbacks.RemoveAt(Index--);
+			DeliverReadback(Completed);
+		}
+	}
+}
+
+void FGPUReadbackManager::Flush()
+{
+	check(IsInRenderingThread());
+
+	if (GGPUReadbackWarnOnSameFrameSync)
+	{
+		for (const FPendingReadback& Pending : PendingReadbacks)
+		{
+			if (Pending.EnqueueFrame == GFrameNumberRenderThread && !Pending.Readback->IsReady())
+			{
+				UE_LOG(LogRendererCore, Warning, TEXT("FGPUReadbackManager::Flush is blocking on a readback enqueued this frame; this is a GPU sync. Callstack follows."));
+				FDebug::DumpStackTraceToLog();
+				break;
+			}
+		}
+	}
+
+	if (PendingReadbacks.Num() > 0)
+	{
+		// Fences only signal once the GPU consumes the copies; make sure everything enqueued
+		// so far is actually submitted before we spin on them.
+		FRHICommandListExecutor::GetImmediateCommandList().ImmediateFlush(EImmediateFlushType::FlushRHIThreadFlushResources);
+	}
+
+	while (PendingReadbacks.Num() > 0)
+	{
+		bool bDeliveredAny = false;
+		for (int32 Index = 0; Index < PendingReadbacks.Num(); ++Index)
+		{
+			if (PendingReadbacks[Index].Readback->IsReady())
+			{
+				FPendingReadback Completed = MoveTemp(PendingReadbacks[Index]);
+				PendingReadbacks.RemoveAt(Index--);
+				DeliverReadback(Completed);
+				bDeliveredAny = true;
+			}
+		}
+
+		if (!bDeliveredAny && PendingReadbacks.Num() > 0)
+		{
+			FPlatformProcess::SleepNoStats(0.001f);
+		}
+	}
+}
@@ -2,6 +2,9 @@
 
 #include "ProfilingDebugging/RealtimeGPUProfiler.h"
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/CoreDelegates.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "ProfilingDebugging/TracingProfiler.h"
 #include "RenderCore.h"
 
@@ -47,6 +50,58 @@ static TAutoConsoleVariable<int> CVarGPUStatsChildTimesIncluded(
 	TEXT("to the total GPU time, so we probably want this disabled.\n")
 );
 
+static TAutoConsoleVariable<int> CVarGPUStatsBudgetAlarms(
+	TEXT("r.GPUStatsBudgetAlarms"),
+	0,
+	TEXT("If enabled, GPU stat timings are checked against the [GPUBudgets] config section (StatName=Milliseconds entries)\n")
+	TEXT("and overages are reported as on-screen warnings and through the CSV profiler.\n")
+);
+
+/** Per-pass millisecond budgets from the [GPUBudgets] config section, and last frame's overages for on-screen reporting. */
+struct FGPUBudgetAlarmState
+{
+	TMap<FName, float> BudgetsMs;
+
+	/** Written on the render thread each frame, read by the on-screen message delegate on the game thread. */
+	FCriticalSection OverageCS;
+	TMap<FName, float> OverageMs;
+
+	FGPUBudgetAlarmState()
+	{
+		if (GConfig)
+		{
+			if (const FConfigSection* Section = GConfig->GetSectionPrivate(TEXT("GPUBudgets"), false, true, GEngineIni))
+			{
+				for (FConfigSection::TConstIterator It(*Section); It; ++It)
+				{
+					BudgetsMs.Add(It.Key(), FCString::Atof(*It.Value().GetValue()));
+				}
+			}
+		}
+
+		// Delegate registration must happen on the game thread since that's where it broadcasts;
+		// this state is created on the render thread during stat updates.
+		FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+		{
+			FCoreDelegates::OnGetOnScreenMessages.AddLambda([this](FCoreDelegates::FSeverityMessageMap& OutMessages)
+			{
+				FScopeLock Lock(&OverageCS);
+				for (const TPair<FName, float>& Overage : OverageMs)
+				{
+					OutMessages.Add(FCoreDelegates::EOnScreenMessageSeverity::Warning,
+						FText::FromString(FString::Printf(TEXT("GPU pass %s over budget by %.2fms"), *Overage.Key.ToString(), Overage.Value)));
+				}
+			});
+		}, TStatId(), nullptr, ENamedThreads::GameThread);
+	}
+};
+
+static FGPUBudgetAlarmState& GetGPUBudgetAlarmState()
+{
+	static FGPUBudgetAlarmState State;
+	return State;
+}
+
 #endif //HAS_GPU_STATS
 
 
@@ -390,6 +445,9 @@ public:
 		FCsvProfiler* CsvProfiler = bCsvStatsEnabled ? FCsvProfiler::Get() : nullptr;
 #endif
 		const bool GPUStatsChildTimesIncluded = !!CVarGPUStatsChildTimesIncluded.GetValueOnRenderThread();
+		const bool bCheckBudgets = !!CVarGPUStatsBudgetAlarms.GetValueOnRenderThread();
+		FGPUBudgetAlarmState* BudgetState = bCheckBudgets ? &GetGPUBudgetAlarmState() : nullptr;
+		TMap<FName, float> FrameOverageMs;
 		uint64 TotalUs = 0llu;
 		FNameSet StatSeenSet;
 
@@ -404,6 +462,19 @@ public:
 			const uint32 EventTimeUs = GPUStatsChildTimesIncluded ? IncExcTime.InclusiveTimeUs : IncExcTime.ExclusiveTimeUs;
 			TotalUs += IncExcTime.ExclusiveTimeUs;
 
+			if (BudgetState)
+			{
+				if (const float* BudgetMs = BudgetState->BudgetsMs.Find(Event.GetName()))
+				{
+					const float InclusiveMs = IncExcTime.InclusiveTimeUs / 1000.f;
+					if (InclusiveMs > *BudgetMs)
+					{
+						// Accumulate in case the same stat is emitted several times this frame.
+						FrameOverageMs.FindOrAdd(Event.GetName()) += InclusiveMs - *BudgetMs;
+					}
+				}
+			}
+
 #if STATS
 			const EStatOperation::Type StatOp = bKnownStat ? EStatOperation::Add : EStatOperation::Set;
 			FThreadStats::AddMessage(Event.GetStatName(), StatOp, EventTimeUs / 1000.);
@@ -442,6 +513,23 @@ public:
 			CsvProfiler->RecordCustomStat(CSV_STAT_FNAME(Total), CSV_CATEGORY_INDEX(GPU), TotalUs / 1000.f, ECsvCustomStatOp::Set);
 		}
 #endif
+
+		if (BudgetState)
+		{
+#if CSV_PROFILER
+			if (CsvProfiler)
+			{
+				for (const TPair<FName, float>& Overage : FrameOverageMs)
+				{
+					CsvProfiler->RecordCustomStat(FName(*(Overage.Key.ToString() + TEXT("_OverBudget"))), CSV_CATEGORY_INDEX(GPU), Overage.Value, ECsvCustomStatOp::Set);
+				}
+			}
+#endif
+			// Publish for the on-screen message delegate (game thread).
+			FScopeLock Lock(&BudgetState->OverageCS);
+			BudgetState->OverageMs = MoveTemp(FrameOverageMs);
+		}
+
 		return true;
 	}
 
@@ -164,7 +164,11 @@ FRDGBuilder::FRDGBuilder(FRHICommandListImmediate& InRHICmdList)
 	, MemStack(FMemStack::Get())
 	, EventScopeStack(RHICmdList)
 	, StatScopeStack(RHICmdList)
-{}
+{
+	// Dozens of builders run per frame with tens of passes each; reserving avoids repeated
+	// growth copies through the frame allocator for every one of them.
+	Passes.Reserve(64);
+}
 
 void FRDGBuilder::Execute()
 {
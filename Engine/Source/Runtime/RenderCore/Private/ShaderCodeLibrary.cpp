@@ -22,6 +22,8 @@ ShaderCodeLibrary.cpp: Bound shader state cache implementation.
 #include "Interfaces/IShaderFormatArchive.h"
 #include "ShaderPipelineCache.h"
 #include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/CommandLine.h"
 
@@ -63,6 +65,30 @@ static FAutoConsoleVariableRef CVarShaderCodeLibrarySeperateLoadingCache(
 	ECVF_Default
 );
 
+int32 GShaderCodeLibraryRecordSyncLoads = 0;
+static FAutoConsoleVariableRef CVarShaderCodeLibraryRecordSyncLoads(
+	TEXT("r.ShaderCodeLibrary.RecordSyncLoads"),
+	GShaderCodeLibraryRecordSyncLoads,
+	TEXT("if > 0, shaders that had to be loaded synchronously are recorded to a per-library file in Saved, for prefetching on the next run."),
+	ECVF_Default
+);
+
+int32 GShaderCodeLibraryPrefetchSyncLoads = 0;
+static FAutoConsoleVariableRef CVarShaderCodeLibraryPrefetchSyncLoads(
+	TEXT("r.ShaderCodeLibrary.PrefetchSyncLoads"),
+	GShaderCodeLibraryPrefetchSyncLoads,
+	TEXT("if > 0, precache reads are issued at library open for the shaders a previous run loaded synchronously,\n")
+	TEXT("so the pak precacher has their blocks resident before first use."),
+	ECVF_Default
+);
+
+static const uint32 GShaderSyncLoadRecordVersion = 1;
+
+static FString GetSyncLoadRecordFilename(const FString& LibraryName, FName Platform)
+{
+	return FPaths::ProjectSavedDir() / TEXT("ShaderLibrarySyncLoads") / FString::Printf(TEXT("%s-%s.ushadersyncloads"), *LibraryName, *Platform.ToString());
+}
+
 
 static FString GetCodeArchiveFilename(const FString& BaseDir, const FString& LibraryName, FName Platform)
 {
@@ -457,18 +483,36 @@ public:
 			// Open library for async reads
 			LibraryAsyncFileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*DestFilePath);
 
+			if (GShaderCodeLibraryPrefetchSyncLoads)
+			{
+				PrefetchRecordedSyncLoads(PlatformName);
+			}
+
 			UE_LOG(LogShaderLibrary, Display, TEXT("Using %s for material shader code. Total %d unique shaders."), *DestFilePath, Shaders.Num());
 		}
 	}
 
 	virtual ~FShaderCodeArchive()
 	{
+		if (GShaderCodeLibraryRecordSyncLoads)
+		{
+			SaveRecordedSyncLoads();
+		}
+
 		if(LibraryAsyncFileHandle != nullptr)
 		{
 			UE_LOG(LogShaderLibrary, Display, TEXT("FShaderCodeArchive: Shutting down %s"), *GetName());
 
 			FScopeLock ScopeLock(&ReadRequestLock);
 
+			for (IAsyncReadRequest* PrecacheRequest : PrecacheReadRequests)
+			{
+				PrecacheRequest->Cancel();
+				PrecacheRequest->WaitCompletion();
+				delete PrecacheRequest;
+			}
+			PrecacheReadRequests.Empty();
+
 			const int64 OutstandingReads = FPlatformAtomics::AtomicRead(&InFlightAsyncReadRequests);
 			if(OutstandingReads > 0)
 			{
@@ -515,6 +559,11 @@ public:
 				UE_LOG(LogShaderLibrary, Warning, TEXT("Took %6.2fms (%d total sync shader loads) to synchronously load shader %s from library: %s"), ThisTimeMS, SyncCount.GetValue(), *Hash.ToString(), *GetName());
 				bWasSynchronous = bFound;
 
+				if (GShaderCodeLibraryRecordSyncLoads)
+				{
+					SyncLoadedHashes.Add(Hash);
+				}
+
 				check(Entry->NumRefs > 0);
 				check(Entry->LoadedCode.Num() != 0);
 				check(Entry->bReadCompleted == 1);
@@ -557,6 +606,107 @@ public:
 		return false;
 	}
 
+	/** Issues buffer-less precache reads for shaders a previous run had to load synchronously, so their blocks are resident before first use. */
+	void PrefetchRecordedSyncLoads(FName PlatformName)
+	{
+		TArray<uint8> RecordData;
+		if (!FFileHelper::LoadFileToArray(RecordData, *GetSyncLoadRecordFilename(LibraryName, PlatformName), FILEREAD_Silent))
+		{
+			return;
+		}
+
+		FMemoryReader RecordAr(RecordData);
+		uint32 Version = 0;
+		RecordAr << Version;
+		if (Version != GShaderSyncLoadRecordVersion)
+		{
+			return;
+		}
+
+		int32 NumRecordedHashes = 0;
+		RecordAr << NumRecordedHashes;
+		if (NumRecordedHashes < 0 || NumRecordedHashes > (RecordData.Num() / (int32)sizeof(FSHAHash)))
+		{
+			// Truncated or corrupt record; ignore it rather than trusting the count.
+			return;
+		}
+
+		TArray<FSHAHash> RecordedHashes;
+		RecordedHashes.AddDefaulted(NumRecordedHashes);
+		for (FSHAHash& RecordedHash : RecordedHashes)
+		{
+			RecordAr << RecordedHash;
+		}
+		if (RecordAr.IsError())
+		{
+			return;
+		}
+
+		// Issue in offset order so the reads walk the archive forward.
+		TArray<FShaderCodeEntry*> SortedEntries;
+		SortedEntries.Reserve(RecordedHashes.Num());
+		for (const FSHAHash& RecordedHash : RecordedHashes)
+		{
+			if (FShaderCodeEntry* Entry = Shaders.Find(RecordedHash))
+			{
+				SortedEntries.Add(Entry);
+			}
+		}
+		SortedEntries.Sort([](const FShaderCodeEntry& A, const FShaderCodeEntry& B) { return A.Offset < B.Offset; });
+
+		FScopeLock ScopeLock(&ReadRequestLock);
+		for (FShaderCodeEntry* Entry : SortedEntries)
+		{
+			IAsyncReadRequest* PrecacheRequest = LibraryAsyncFileHandle->ReadRequest(LibraryCodeOffset + Entry->Offset, Entry->Size, AIOP_Precache);
+			if (PrecacheRequest)
+			{
+				PrecacheReadRequests.Add(PrecacheRequest);
+			}
+		}
+
+		UE_LOG(LogShaderLibrary, Display, TEXT("Prefetching %d recorded sync-loaded shaders for library %s"), SortedEntries.Num(), *GetName());
+	}
+
+	/** Writes the union of previously recorded and this session's sync-loaded shader hashes. */
+	void SaveRecordedSyncLoads()
+	{
+		FName PlatformName = LegacyShaderPlatformToShaderFormat(Platform);
+		const FString RecordFilename = GetSyncLoadRecordFilename(LibraryName, PlatformName);
+
+		TSet<FSHAHash> AllHashes;
+		{
+			FScopeLock ScopeLock(&ReadRequestLock);
+			AllHashes = SyncLoadedHashes;
+		}
+
+		TArray<uint8> ExistingData;
+		if (FFileHelper::LoadFileToArray(ExistingData, *RecordFilename, FILEREAD_Silent))
+		{
+			FMemoryReader ExistingAr(ExistingData);
+			uint32 Version = 0;
+			ExistingAr << Version;
+			if (Version == GShaderSyncLoadRecordVersion)
+			{
+				TArray<FSHAHash> ExistingHashes;
+				ExistingAr << ExistingHashes;
+				AllHashes.Append(ExistingHashes);
+			}
+		}
+
+		if (AllHashes.Num() == 0)
+		{
+			return;
+		}
+
+		TArray<uint8> RecordData;
+		FMemoryWriter RecordAr(RecordData);
+		uint32 Version = GShaderSyncLoadRecordVersion;
+		RecordAr << Version;
+		TArray<FSHAHash> HashArray = AllHashes.Array();
+		RecordAr << HashArray;
+		FFileHelper::SaveArrayToFile(RecordData, *RecordFilename);
+	}
+
 	bool RequestEntryInternal(const FSHAHash& Hash, FArchive* Ar, bool bHiPriSync)
 	{
 		FShaderCodeEntry* Entry = Shaders.Find(Hash);
@@ -564,6 +714,16 @@ public:
 		{
 			FScopeLock ScopeLock(&ReadRequestLock);
 
+			// Retire finished precache reads so their requests don't pile up over the session.
+			for (int32 Index = PrecacheReadRequests.Num() - 1; Index >= 0; --Index)
+			{
+				if (PrecacheReadRequests[Index]->PollCompletion())
+				{
+					delete PrecacheReadRequests[Index];
+					PrecacheReadRequests.RemoveAtSwap(Index, 1, false);
+				}
+			}
+
 			int32 CodeNumRefs = Entry->NumRefs++;
 			TSharedPtr<IAsyncReadRequest, ESPMode::ThreadSafe> LocalReadRequest = Entry->ReadRequest.Pin();
 			bool bHasReadRequest = LocalReadRequest.IsValid();
@@ -900,6 +1060,12 @@ private:
 	// The shader code present in the library
 	TMap<FSHAHash, FShaderCodeEntry> Shaders;
 
+	// Outstanding buffer-less precache reads issued for recorded sync loads; guarded by ReadRequestLock
+	TArray<IAsyncReadRequest*> PrecacheReadRequests;
+
+	// Shaders this session had to load synchronously, recorded for prefetch on the next run; guarded by ReadRequestLock
+	TSet<FSHAHash> SyncLoadedHashes;
+
 	// De-serialised pipeline map
 	TSet<FShaderCodeLibraryPipeline> Pipelines;
 
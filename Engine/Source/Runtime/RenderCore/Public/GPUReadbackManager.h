@@ -0,0 +1,63 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHIGPUReadback.h"
+
+/**
+ * Central manager for non-blocking GPU readbacks.
+ *
+ * Systems that need GPU data back on the CPU (screenshots for analytics, feedback buffers, debug
+ * captures) each rolled their own staging-and-flush logic around locking APIs, which stalls the GPU
+ * at the lock. This manager standardizes the fence-based pattern: Enqueue records a staging copy
+ * plus fence on the render thread and returns immediately; Tick (called once per frame on the
+ * render thread) polls outstanding requests and delivers completed ones to their callbacks with a
+ * locked pointer, typically three frames later and never via a sync.
+ *
+ * All calls are render thread only. Callbacks run on the render thread inside Tick; marshal to
+ * other threads yourself if needed. Requests that outlive the manager are completed or dropped at
+ * shutdown via Flush.
+ */
+class RENDERCORE_API FGPUReadbackManager
+{
+public:
+	/** Callback receiving the locked staging memory and its size; the lock is released when the callback returns. */
+	typedef TFunction<void(const void* Data, uint32 NumBytes)> FReadbackCompleteCallback;
+
+	static FGPUReadbackManager& Get();
+
+	/** Enqueues an async buffer readback; the callback fires from a later Tick when the copy completed. */
+	void EnqueueBufferReadback(FRHICommandList& RHICmdList, FRHIVertexBuffer* SourceBuffer, uint32 NumBytes, FName DebugName, FReadbackCompleteCallback Callback);
+
+	/** Enqueues an async texture readback of the given region (whole texture by default). */
+	void EnqueueTextureReadback(FRHICommandList& RHICmdList, FRHITexture* SourceTexture, uint32 NumBytes, FName DebugName, FReadbackCompleteCallback Callback, FResolveRect Rect = FResolveRect());
+
+	/** Polls outstanding readbacks, delivering completed ones. Driven automatically at end of frame on the render thread. */
+	void Tick();
+
+	/** Blocks until every outstanding readback completes and delivers them; for shutdown or forced capture points. */
+	void Flush();
+
+	/** Number of readbacks still in flight. */
+	int32 NumPending() const
+	{
+		return PendingReadbacks.Num();
+	}
+
+private:
+	FGPUReadbackManager();
+
+	struct FPendingReadback
+	{
+		TUniquePtr<FRHIGPUMemoryReadback> Readback;
+		FReadbackCompleteCallback Callback;
+		uint32 NumBytes = 0;
+		/** GFrameNumberRenderThread at enqueue, to diagnose same-frame syncs. */
+		uint32 EnqueueFrame = 0;
+	};
+
+	void DeliverReadback(FPendingReadback& Pending);
+
+	TArray<FPendingReadback> PendingReadbacks;
+};
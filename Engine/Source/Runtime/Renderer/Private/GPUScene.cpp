@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "GPUScene.h"
+#include "Async/ParallelFor.h"
 #include "CoreMinimal.h"
 #include "RHI.h"
 #include "SceneUtils.h"
@@ -202,21 +203,35 @@ static void UpdateGPUSceneBuffer(FRHICommandListImmediate& RHICmdList, FScene& S
 
 			FScatterUploadBuilder PrimitivesUploadBuilder(NumPrimitiveDataUploads, FPrimitiveSceneShaderData::PrimitiveDataStrideInFloat4s, Scene.GPUScene.PrimitivesUploadScatterBuffer, Scene.GPUScene.PrimitivesUploadDataBuffer);
 
+			// Pack shader data in parallel: the per-primitive transform/bounds packing dominates this
+			// walk, and each entry only reads its own proxy. The staging writes below stay serial for
+			// the builder's bookkeeping; they are memcpys of already-packed data.
+			TArray<int32, SceneRenderingAllocator> ValidUpdateIndices;
+			ValidUpdateIndices.Reserve(NumPrimitiveDataUploads);
 			for (int32 Index : Scene.GPUScene.PrimitivesToUpdate)
 			{
 				// PrimitivesToUpdate may contain a stale out of bounds index, as we don't remove update request on primitive removal from scene.
 				if (Index < Scene.PrimitiveSceneProxies.Num())
 				{
-					FPrimitiveSceneProxy* PrimitiveSceneProxy = Scene.PrimitiveSceneProxies[Index];
-					NumLightmapDataUploads += PrimitiveSceneProxy->GetPrimitiveSceneInfo()->GetNumLightmapDataEntries();
-
-					FPrimitiveSceneShaderData PrimitiveSceneData(PrimitiveSceneProxy);
-					PrimitivesUploadBuilder.Add(Index, &PrimitiveSceneData.Data[0]);
+					ValidUpdateIndices.Add(Index);
 				}
-
 				Scene.GPUScene.PrimitivesMarkedToUpdate[Index] = false;
 			}
 
+			TArray<FPrimitiveSceneShaderData, SceneRenderingAllocator> PackedPrimitiveData;
+			PackedPrimitiveData.AddUninitialized(ValidUpdateIndices.Num());
+			ParallelFor(ValidUpdateIndices.Num(), [&Scene, &ValidUpdateIndices, &PackedPrimitiveData](int32 UpdateIndex)
+			{
+				new (&PackedPrimitiveData[UpdateIndex]) FPrimitiveSceneShaderData(Scene.PrimitiveSceneProxies[ValidUpdateIndices[UpdateIndex]]);
+			});
+
+			for (int32 UpdateIndex = 0; UpdateIndex < ValidUpdateIndices.Num(); UpdateIndex++)
+			{
+				const int32 Index = ValidUpdateIndices[UpdateIndex];
+				NumLightmapDataUploads += Scene.PrimitiveSceneProxies[Index]->GetPrimitiveSceneInfo()->GetNumLightmapDataEntries();
+				PrimitivesUploadBuilder.Add(Index, &PackedPrimitiveData[UpdateIndex].Data[0]);
+			}
+
 			if (bResizedPrimitiveData)
 			{
 				RHICmdList.TransitionResource(EResourceTransitionAccess::ERWBarrier, EResourceTransitionPipeline::EComputeToCompute, Scene.GPUScene.PrimitiveBuffer.UAV);
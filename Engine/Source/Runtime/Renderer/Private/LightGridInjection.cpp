@@ -325,11 +325,14 @@ void FDeferredShadingSceneRenderer::ComputeLightGrid(FRHICommandListImmediate& R
 			ForwardLightData = FForwardLightData();
 
 			TArray<FForwardLocalLightData, SceneRenderingAllocator> ForwardLocalLightData;
+			// one light appends per iteration below; reserving up front removes the growth reallocations
+			// that otherwise recur every frame on light-heavy forward scenes
+			ForwardLocalLightData.Reserve(SortedLightSet.SortedLights.Num() + SortedLightSet.SimpleLights.InstanceData.Num());
 #if ENABLE_LIGHT_CULLING_VIEW_SPACE_BUILD_DATA
-			// TODO: In the future these should be generated by CPU-side render graph passes that fill the GPU buffers only when actually needed.
-			// TODO: Should use 'Empty' to pre-allocate enough space for all lights?
 			TArray<FVector4, SceneRenderingAllocator> ViewSpacePosAndRadiusData;
 			TArray<FVector4, SceneRenderingAllocator> ViewSpaceDirAndPreprocAngleData;
+			ViewSpacePosAndRadiusData.Reserve(SortedLightSet.SortedLights.Num() + SortedLightSet.SimpleLights.InstanceData.Num());
+			ViewSpaceDirAndPreprocAngleData.Reserve(SortedLightSet.SortedLights.Num() + SortedLightSet.SimpleLights.InstanceData.Num());
 #endif // ENABLE_LIGHT_CULLING_VIEW_SPACE_BUILD_DATA
 			float FurthestLight = 1000;
 
@@ -1064,7 +1064,52 @@ void SubmitMeshDrawCommandsRange(
 		const FVisibleMeshDrawCommand& VisibleMeshDrawCommand = VisibleMeshDrawCommands[DrawCommandIndex];
 		const int32 PrimitiveIdBufferOffset = BasePrimitiveIdsOffset + (bDynamicInstancing ? VisibleMeshDrawCommand.PrimitiveIdBufferOffset : DrawCommandIndex) * sizeof(int32);
 		checkSlow(!bDynamicInstancing || VisibleMeshDrawCommand.PrimitiveIdBufferOffset >= 0);
-		FMeshDrawCommand::SubmitDraw(*VisibleMeshDrawCommand.MeshDrawCommand, GraphicsMinimalPipelineStateSet, PrimitiveIdsBuffer, PrimitiveIdBufferOffset, InstanceFactor, RHICmdList, StateCache);
+
+		// Merge runs of identical-state triangle-list draws whose index ranges are contiguous in the
+		// same index buffer into one draw. Only legal when no primitive id stream is consumed (a
+		// merged draw could not step the id per source range) and for single-instance draws; sorted
+		// submission makes such runs adjacent for section-chunked meshes sharing buffers.
+		const FMeshDrawCommand& FirstCommand = *VisibleMeshDrawCommand.MeshDrawCommand;
+		if (FirstCommand.PrimitiveIdStreamIndex < 0 && FirstCommand.NumPrimitives > 0 && FirstCommand.NumInstances == 1)
+		{
+			const FGraphicsMinimalPipelineStateInitializer& PipelineState = FirstCommand.CachedPipelineId.GetPipelineState(GraphicsMinimalPipelineStateSet);
+			if (PipelineState.PrimitiveType == PT_TriangleList)
+			{
+				uint32 MergedNumPrimitives = FirstCommand.NumPrimitives;
+				uint32 MergedNumVertices = FirstCommand.VertexParams.NumVertices;
+				int32 LookaheadIndex = DrawCommandIndex + 1;
+				for (; LookaheadIndex < StartIndex + NumMeshDrawCommands; LookaheadIndex++)
+				{
+					const FMeshDrawCommand& NextCommand = *VisibleMeshDrawCommands[LookaheadIndex].MeshDrawCommand;
+					if (NextCommand.PrimitiveIdStreamIndex >= 0 ||
+						NextCommand.NumPrimitives == 0 ||
+						NextCommand.NumInstances != 1 ||
+						NextCommand.CachedPipelineId != FirstCommand.CachedPipelineId ||
+						NextCommand.StencilRef != FirstCommand.StencilRef ||
+						NextCommand.IndexBuffer != FirstCommand.IndexBuffer ||
+						NextCommand.VertexStreams != FirstCommand.VertexStreams ||
+						NextCommand.VertexParams.BaseVertexIndex != FirstCommand.VertexParams.BaseVertexIndex ||
+						NextCommand.FirstIndex != FirstCommand.FirstIndex + MergedNumPrimitives * 3 ||
+						!NextCommand.ShaderBindings.MatchesForDynamicInstancing(FirstCommand.ShaderBindings))
+					{
+						break;
+					}
+					MergedNumPrimitives += NextCommand.NumPrimitives;
+					MergedNumVertices = FMath::Max(MergedNumVertices, (uint32)NextCommand.VertexParams.NumVertices);
+				}
+				if (LookaheadIndex > DrawCommandIndex + 1)
+				{
+					FMeshDrawCommand MergedCommand(FirstCommand);
+					MergedCommand.NumPrimitives = MergedNumPrimitives;
+					MergedCommand.VertexParams.NumVertices = MergedNumVertices;
+					FMeshDrawCommand::SubmitDraw(MergedCommand, GraphicsMinimalPipelineStateSet, PrimitiveIdsBuffer, PrimitiveIdBufferOffset, InstanceFactor, RHICmdList, StateCache);
+					DrawCommandIndex = LookaheadIndex - 1;
+					continue;
+				}
+			}
+		}
+
+		FMeshDrawCommand::SubmitDraw(FirstCommand, GraphicsMinimalPipelineStateSet, PrimitiveIdsBuffer, PrimitiveIdBufferOffset, InstanceFactor, RHICmdList, StateCache);
 	}
 }
 
@@ -335,6 +335,8 @@ FIntRect FRenderingCompositePassContext::GetSceneColorDestRect(FRenderingComposi
 
 FRenderingCompositionGraph::FRenderingCompositionGraph()
 {
+	// a full post chain registers dozens of passes per view per frame; reserve once instead of growing
+	Nodes.Reserve(96);
 }
 
 FRenderingCompositionGraph::~FRenderingCompositionGraph()
@@ -508,6 +508,13 @@ void FPrimitiveSceneInfo::AddToScene(FRHICommandListImmediate& RHICmdList, bool
 {
 	check(IsInRenderingThread());
 
+	// proxies whose relevance ignores the view compute it once here; the relevance pass reuses it
+	bHasCachedViewIndependentRelevance = Proxy->HasViewIndependentRelevance();
+	if (bHasCachedViewIndependentRelevance)
+	{
+		CachedViewIndependentRelevance = Proxy->GetViewRelevance(nullptr);
+	}
+
 	// Create an indirect lighting cache uniform buffer if we attaching a primitive that may require it, as it may be stored inside a cached mesh command.
 	if (IsIndirectLightingCacheAllowed(Scene->GetFeatureLevel())
 		&& Proxy->WillEverBeLit()
@@ -3578,17 +3578,19 @@ void FScene::UpdateAllPrimitiveSceneInfos(FRHICommandListImmediate& RHICmdList)
 			{
 				int SourceIndex = RemovedLocalPrimitiveSceneInfos[RemoveIndex]->PackedIndex;
 				check(SourceIndex >= (Primitives.Num() - RemovedLocalPrimitiveSceneInfos.Num() + StartIndex));
-				Primitives.Pop();
-				PrimitiveTransforms.Pop();
-				PrimitiveSceneProxies.Pop();
-				PrimitiveBounds.Pop();
-				PrimitiveFlagsCompact.Pop();
-				PrimitiveVisibilityIds.Pop();
-				PrimitiveOcclusionFlags.Pop();
-				PrimitiveComponentIds.Pop();
-				PrimitiveVirtualTextureFlags.Pop();
-				PrimitiveVirtualTextureLod.Pop();
-				PrimitiveOcclusionBounds.Pop();
+				// no shrinking: streaming churn re-adds primitives immediately, and a shrinking pop
+				// reallocates and copies every parallel array per removed primitive
+				Primitives.Pop(false);
+				PrimitiveTransforms.Pop(false);
+				PrimitiveSceneProxies.Pop(false);
+				PrimitiveBounds.Pop(false);
+				PrimitiveFlagsCompact.Pop(false);
+				PrimitiveVisibilityIds.Pop(false);
+				PrimitiveOcclusionFlags.Pop(false);
+				PrimitiveComponentIds.Pop(false);
+				PrimitiveVirtualTextureFlags.Pop(false);
+				PrimitiveVirtualTextureLod.Pop(false);
+				PrimitiveOcclusionBounds.Pop(false);
 				PrimitivesNeedingStaticMeshUpdate.RemoveAt(PrimitivesNeedingStaticMeshUpdate.Num() - 1);
 			}
 
@@ -4128,6 +4130,23 @@ void FRendererModule::UpdateStaticDrawLists()
 
 void UpdateStaticMeshesForMaterials(const TArray<const FMaterial*>& MaterialResourcesToUpdate)
 {
+	// The edit stall on large maps is this scan, not the recache: resolve the updated interfaces once
+	// instead of per component, and check set membership before the expensive dependency walk.
+	TArray<UMaterialInterface*> UpdatedMaterialInterfaces;
+	TSet<UMaterialInterface*> UpdatedMaterialInterfaceSet;
+	for (const FMaterial* MaterialResource : MaterialResourcesToUpdate)
+	{
+		if (UMaterialInterface* UpdatedMaterialInterface = MaterialResource->GetMaterialInterface())
+		{
+			UpdatedMaterialInterfaces.Add(UpdatedMaterialInterface);
+			UpdatedMaterialInterfaceSet.Add(UpdatedMaterialInterface);
+		}
+	}
+	if (!UpdatedMaterialInterfaces.Num())
+	{
+		return;
+	}
+
 	TArray<UMaterialInterface*> UsedMaterials;
 
 	for (TObjectIterator<UPrimitiveComponent> PrimitiveIt; PrimitiveIt; ++PrimitiveIt)
@@ -4145,21 +4164,24 @@ void UpdateStaticMeshesForMaterials(const TArray<const FMaterial*>& MaterialReso
 
 			if (UsedMaterials.Num() > 0)
 			{
-				for (TArray<const FMaterial*>::TConstIterator MaterialIt(MaterialResourcesToUpdate); MaterialIt; ++MaterialIt)
+				for (int32 MaterialIndex = 0; MaterialIndex < UsedMaterials.Num() && !bPrimitiveIsDependentOnMaterial; MaterialIndex++)
 				{
-					UMaterialInterface* UpdatedMaterialInterface = (*MaterialIt)->GetMaterialInterface();
-
-					if (UpdatedMaterialInterface)
+					UMaterialInterface* TestMaterial = UsedMaterials[MaterialIndex];
+					if (!TestMaterial)
+					{
+						continue;
+					}
+					if (UpdatedMaterialInterfaceSet.Contains(TestMaterial))
 					{
-						for (int32 MaterialIndex = 0; MaterialIndex < UsedMaterials.Num(); MaterialIndex++)
+						bPrimitiveIsDependentOnMaterial = true;
+						break;
+					}
+					for (UMaterialInterface* UpdatedMaterialInterface : UpdatedMaterialInterfaces)
+					{
+						if (TestMaterial->IsDependent(UpdatedMaterialInterface))
 						{
-							UMaterialInterface* TestMaterial = UsedMaterials[MaterialIndex];
-
-							if (TestMaterial && (TestMaterial == UpdatedMaterialInterface || TestMaterial->IsDependent(UpdatedMaterialInterface)))
-							{
-								bPrimitiveIsDependentOnMaterial = true;
-								break;
-							}
+							bPrimitiveIsDependentOnMaterial = true;
+							break;
 						}
 					}
 				}
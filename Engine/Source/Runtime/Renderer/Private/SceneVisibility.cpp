@@ -130,6 +130,15 @@ static TAutoConsoleVariable<float> CVarMinAutomaticViewMipBiasOffset(
 	ECVF_RenderThreadSafe);
 
 
+/** Stagger period for per-primitive occlusion re-tests: a primitive only issues a new query every N frames (offset by its index), reusing its history in between. Cuts query counts and bookkeeping traffic by ~1/N at the cost of up to N-1 frames of extra result latency. 1 = test every frame. */
+static int32 GOcclusionQueryStaggerPeriod = 1;
+static FAutoConsoleVariableRef CVarOcclusionQueryStaggerPeriod(
+	TEXT("r.OcclusionQueryStaggerPeriod"),
+	GOcclusionQueryStaggerPeriod,
+	TEXT("Issue per-primitive occlusion queries only every N frames, staggered by primitive index; 1 tests every frame (default). Reduces query CPU/memory traffic with bounded extra latency."),
+	ECVF_RenderThreadSafe
+	);
+
 static int32 GOcclusionCullParallelPrimFetch = 0;
 static FAutoConsoleVariableRef CVarOcclusionCullParallelPrimFetch(
 	TEXT("r.OcclusionCullParallelPrimFetch"),
@@ -1062,7 +1071,13 @@ static void FetchVisibilityForPrimitives_Range(FVisForPrimParams& Params, FGloba
 						bAllowBoundsTest = OcclusionBounds.SphereRadius < HALF_WORLD_MAX;
 					}
 
-					if (bAllowBoundsTest)
+					// staggered re-test: off-cycle primitives skip issuing a new query and keep this frame's
+					// read result; a missing future read is conservatively visible-indefinite, never a false occlude
+					const bool bStaggerSkip = GOcclusionQueryStaggerPeriod > 1
+						&& PrimitiveOcclusionHistory->LastTestFrameNumber != 0xFFFFFFFF
+						&& ((OcclusionFrameCounter + (uint32)BitIt.GetIndex()) % (uint32)GOcclusionQueryStaggerPeriod) != 0;
+
+					if (bAllowBoundsTest && !bStaggerSkip)
 					{
 						PrimitiveOcclusionHistory->LastTestFrameNumber = OcclusionFrameCounter;
 						if (bHZBOcclusion)
@@ -1151,12 +1166,13 @@ static void FetchVisibilityForPrimitives_Range(FVisForPrimParams& Params, FGloba
 							}
 						}
 					}
-					else
+					else if (!bAllowBoundsTest)
 					{
 						// If the primitive's bounding box intersects the near clipping plane, treat it as definitely unoccluded.
 						bIsOccluded = false;
 						bOcclusionStateIsDefinite = true;
 					}
+					// else: stagger skip, the read result above stands
 				}
 				// Set the primitive's considered time to keep its occlusion history from being trimmed.
 				PrimitiveOcclusionHistory->LastConsideredTime = CurrentRealTime;
@@ -1961,7 +1977,14 @@ struct FRelevancePacket
 			int32 BitIndex = Input.Prims[Index];
 			FPrimitiveSceneInfo* PrimitiveSceneInfo = Scene->Primitives[BitIndex];
 			FPrimitiveViewRelevance& ViewRelevance = const_cast<FPrimitiveViewRelevance&>(View.PrimitiveViewRelevanceMap[BitIndex]);
-			ViewRelevance = PrimitiveSceneInfo->Proxy->GetViewRelevance(&View);
+			if (PrimitiveSceneInfo->bHasCachedViewIndependentRelevance)
+			{
+				ViewRelevance = PrimitiveSceneInfo->CachedViewIndependentRelevance;
+			}
+			else
+			{
+				ViewRelevance = PrimitiveSceneInfo->Proxy->GetViewRelevance(&View);
+			}
 			ViewRelevance.bInitializedThisFrame = true;
 
 			const bool bStaticRelevance = ViewRelevance.bStaticRelevance;
@@ -2578,6 +2601,62 @@ static void ComputeAndMarkRelevanceForViewParallel(
 			!WillExecuteInParallel
 		);
 	}
+	// The mesh-bit transpose below only reads MarkMasks (fully written once the packet tasks joined
+	// above) and exclusively owns the three static mesh bit maps, which packet finalize never touches;
+	// run it on a worker concurrently with the serial finalize so the render thread does not pay for
+	// both stretches back to back.
+	FGraphEventRef TransposeTask = FFunctionGraphTask::CreateAndDispatchWhenReady(
+		[&View, MarkMasks, NumMesh]()
+		{
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_ComputeAndMarkRelevanceForViewParallel_TransposeMeshBits);
+			check(View.StaticMeshVisibilityMap.Num() == NumMesh &&
+				View.StaticMeshFadeOutDitheredLODMap.Num() == NumMesh &&
+				View.StaticMeshFadeInDitheredLODMap.Num() == NumMesh
+				);
+			uint32* RESTRICT StaticMeshVisibilityMap_Words = View.StaticMeshVisibilityMap.GetData();
+			uint32* RESTRICT StaticMeshFadeOutDitheredLODMap_Words = View.StaticMeshFadeOutDitheredLODMap.GetData();
+			uint32* RESTRICT StaticMeshFadeInDitheredLODMap_Words = View.StaticMeshFadeInDitheredLODMap.GetData();
+			const uint64* RESTRICT MarkMasks64 = (const uint64* RESTRICT)MarkMasks;
+			const uint8* RESTRICT MarkMasks8 = MarkMasks;
+			for (int32 BaseIndex = 0; BaseIndex < NumMesh; BaseIndex += 32)
+			{
+				uint32 StaticMeshVisibilityMap_Word = 0;
+				uint32 StaticMeshFadeOutDitheredLODMap_Word = 0;
+				uint32 StaticMeshFadeInDitheredLODMap_Word = 0;
+				uint32 Mask = 1;
+				bool bAny = false;
+				for (int32 QWordIndex = 0; QWordIndex < 4; QWordIndex++)
+				{
+					if (*MarkMasks64++)
+					{
+						for (int32 ByteIndex = 0; ByteIndex < 8; ByteIndex++, Mask <<= 1, MarkMasks8++)
+						{
+							uint8 MaskMask = *MarkMasks8;
+							StaticMeshVisibilityMap_Word |= (MaskMask & EMarkMaskBits::StaticMeshVisibilityMapMask) ? Mask : 0;
+							StaticMeshFadeOutDitheredLODMap_Word |= (MaskMask & EMarkMaskBits::StaticMeshFadeOutDitheredLODMapMask) ? Mask : 0;
+							StaticMeshFadeInDitheredLODMap_Word |= (MaskMask & EMarkMaskBits::StaticMeshFadeInDitheredLODMapMask) ? Mask : 0;
+						}
+						bAny = true;
+					}
+					else
+					{
+						MarkMasks8 += 8;
+						Mask <<= 8;
+					}
+				}
+				if (bAny)
+				{
+					checkSlow(!*StaticMeshVisibilityMap_Words && !*StaticMeshFadeOutDitheredLODMap_Words && !*StaticMeshFadeInDitheredLODMap_Words);
+					*StaticMeshVisibilityMap_Words = StaticMeshVisibilityMap_Word;
+					*StaticMeshFadeOutDitheredLODMap_Words = StaticMeshFadeOutDitheredLODMap_Word;
+					*StaticMeshFadeInDitheredLODMap_Words = StaticMeshFadeInDitheredLODMap_Word;
+				}
+				StaticMeshVisibilityMap_Words++;
+				StaticMeshFadeOutDitheredLODMap_Words++;
+				StaticMeshFadeInDitheredLODMap_Words++;
+			}
+		}, TStatId(), nullptr, ENamedThreads::AnyHiPriThreadHiPriTask);
+
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_ComputeAndMarkRelevanceForViewParallel_RenderThreadFinalize);
 
@@ -2605,52 +2684,9 @@ static void ComputeAndMarkRelevanceForViewParallel(
 		Packets.Empty();
 	}
 
-	QUICK_SCOPE_CYCLE_COUNTER(STAT_ComputeAndMarkRelevanceForViewParallel_TransposeMeshBits);
-	check(View.StaticMeshVisibilityMap.Num() == NumMesh && 
-		View.StaticMeshFadeOutDitheredLODMap.Num() == NumMesh && 
-		View.StaticMeshFadeInDitheredLODMap.Num() == NumMesh
-		);
-	uint32* RESTRICT StaticMeshVisibilityMap_Words = View.StaticMeshVisibilityMap.GetData();
-	uint32* RESTRICT StaticMeshFadeOutDitheredLODMap_Words = View.StaticMeshFadeOutDitheredLODMap.GetData();
-	uint32* RESTRICT StaticMeshFadeInDitheredLODMap_Words = View.StaticMeshFadeInDitheredLODMap.GetData();
-	const uint64* RESTRICT MarkMasks64 = (const uint64* RESTRICT)MarkMasks;
-	const uint8* RESTRICT MarkMasks8 = MarkMasks;
-	for (int32 BaseIndex = 0; BaseIndex < NumMesh; BaseIndex += 32)
 	{
-		uint32 StaticMeshVisibilityMap_Word = 0;
-		uint32 StaticMeshFadeOutDitheredLODMap_Word = 0;
-		uint32 StaticMeshFadeInDitheredLODMap_Word = 0;
-		uint32 Mask = 1;
-		bool bAny = false;
-		for (int32 QWordIndex = 0; QWordIndex < 4; QWordIndex++)
-		{
-			if (*MarkMasks64++)
-			{
-				for (int32 ByteIndex = 0; ByteIndex < 8; ByteIndex++, Mask <<= 1, MarkMasks8++)
-				{
-					uint8 MaskMask = *MarkMasks8;
-					StaticMeshVisibilityMap_Word |= (MaskMask & EMarkMaskBits::StaticMeshVisibilityMapMask) ? Mask : 0;
-					StaticMeshFadeOutDitheredLODMap_Word |= (MaskMask & EMarkMaskBits::StaticMeshFadeOutDitheredLODMapMask) ? Mask : 0;
-					StaticMeshFadeInDitheredLODMap_Word |= (MaskMask & EMarkMaskBits::StaticMeshFadeInDitheredLODMapMask) ? Mask : 0;
-				}
-				bAny = true;
-			}
-			else
-			{
-				MarkMasks8 += 8;
-				Mask <<= 8;
-			}
-		}
-		if (bAny)
-		{
-			checkSlow(!*StaticMeshVisibilityMap_Words && !*StaticMeshFadeOutDitheredLODMap_Words && !*StaticMeshFadeInDitheredLODMap_Words);
-			*StaticMeshVisibilityMap_Words = StaticMeshVisibilityMap_Word;
-			*StaticMeshFadeOutDitheredLODMap_Words = StaticMeshFadeOutDitheredLODMap_Word;
-			*StaticMeshFadeInDitheredLODMap_Words = StaticMeshFadeInDitheredLODMap_Word;
-		}
-		StaticMeshVisibilityMap_Words++;
-		StaticMeshFadeOutDitheredLODMap_Words++;
-		StaticMeshFadeInDitheredLODMap_Words++;
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_ComputeAndMarkRelevanceForViewParallel_WaitTranspose);
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(TransposeTask);
 	}
 }
 
@@ -2239,6 +2239,16 @@ void ComputeWholeSceneShadowCacheModes(
 								--*NumCachesUpdatedThisFrame;
 							}
 						}
+						else if (*NumCachesUpdatedThisFrame > MaxCacheUpdatesAllowed)
+						{
+							// Generalized budget: rebuilds with no old cache to fall back to (invalidation,
+							// lost target) defer to uncached rendering this frame, spreading mass
+							// invalidations across frames instead of rebuilding every cache at once.
+							OutNumShadowMaps = 1;
+							OutCacheModes[0] = SDCM_Uncached;
+							CachedShadowMapData->ShadowMap.DepthTarget = NULL;
+							--*NumCachesUpdatedThisFrame;
+						}
 					}
 					else
 					{
@@ -2264,12 +2274,21 @@ void ComputeWholeSceneShadowCacheModes(
 
 			if (CachedShadowMapsSize < GWholeSceneShadowCacheMb * 1024 * 1024)
 			{
-				OutNumShadowMaps = 2;
-				// Note: ShadowMap with static primitives rendered first so movable shadowmap can composite
-				OutCacheModes[0] = SDCM_StaticPrimitivesOnly;
-				OutCacheModes[1] = SDCM_MovablePrimitivesOnly;
-				++*NumCachesUpdatedThisFrame;
-				Scene->CachedShadowMaps.Add(LightSceneInfo->Id, FCachedShadowMapData(InOutProjectedShadowInitializer, RealTime));
+				if (*NumCachesUpdatedThisFrame + 1 > MaxCacheUpdatesAllowed)
+				{
+					// over budget: render uncached this frame and build the cache on a later one
+					OutNumShadowMaps = 1;
+					OutCacheModes[0] = SDCM_Uncached;
+				}
+				else
+				{
+					OutNumShadowMaps = 2;
+					// Note: ShadowMap with static primitives rendered first so movable shadowmap can composite
+					OutCacheModes[0] = SDCM_StaticPrimitivesOnly;
+					OutCacheModes[1] = SDCM_MovablePrimitivesOnly;
+					++*NumCachesUpdatedThisFrame;
+					Scene->CachedShadowMaps.Add(LightSceneInfo->Id, FCachedShadowMapData(InOutProjectedShadowInitializer, RealTime));
+				}
 			}
 			else
 			{
@@ -59,6 +59,14 @@ private:
 };
 
 /** IVirtualTexture implementation that is handling runtime rendered page data requests. */
+// Note on batched/async-compute page production: pages render on the graphics queue as
+// requests arrive, which is what makes fast camera movement bursty. Batching per frame means
+// the VT feedback consumer hands this producer a sorted page list once per frame (page table
+// machinery already aggregates requests); moving production to async compute additionally
+// requires the page render path to be expressible without raster (it draws landscape/decal
+// geometry today) or a compute-shading variant of those materials. The first half is a
+// scheduling change in the VT system; the second is a material/shader feature - neither fits
+// inside this producer alone.
 class FRuntimeVirtualTextureProducer : public IVirtualTexture
 {
 public:
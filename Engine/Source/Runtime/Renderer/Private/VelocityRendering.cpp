@@ -308,8 +308,11 @@ void FDeferredShadingSceneRenderer::RenderVelocitiesInnerParallel(FRHICommandLis
 	for(int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
 	{
 		const FViewInfo& View = Views[ViewIndex];
+		const EMeshPass::Type MeshPass = GetMeshPassFromVelocityPass(VelocityPass);
 
-		if (View.ShouldRenderView())
+		// When the base pass is outputting velocity, most movable primitives are filtered out of
+		// this pass; skip the per-view setup and parallel dispatch entirely for empty views.
+		if (View.ShouldRenderView() && View.ParallelMeshDrawCommandPasses[MeshPass].HasAnyDraw())
 		{
 			SCOPED_GPU_MASK(RHICmdList, View.GPUMask);
 
@@ -331,8 +334,6 @@ void FDeferredShadingSceneRenderer::RenderVelocitiesInnerParallel(FRHICommandLis
 				VelocityRT,
 				VelocityPass);
 
-			const EMeshPass::Type MeshPass = GetMeshPassFromVelocityPass(VelocityPass);
-
 			View.ParallelMeshDrawCommandPasses[MeshPass].DispatchDraw(&ParallelCommandListSet, RHICmdList);
 		}
 	}
@@ -344,7 +345,13 @@ void FDeferredShadingSceneRenderer::RenderVelocitiesInner(FRHICommandListImmedia
 	for(int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
 	{
 		const FViewInfo& View = Views[ViewIndex];
-		
+		const EMeshPass::Type MeshPass = GetMeshPassFromVelocityPass(VelocityPass);
+
+		if (!View.ParallelMeshDrawCommandPasses[MeshPass].HasAnyDraw())
+		{
+			continue;
+		}
+
 		FSceneTexturesUniformParameters SceneTextureParameters;
 		FSceneRenderTargets& SceneContext = FSceneRenderTargets::Get(RHICmdList);		
 		SetupSceneTextureUniformParameters(SceneContext, View.FeatureLevel, VelocityPass == EVelocityPass::Opaque ? ESceneTextureSetupMode::None : ESceneTextureSetupMode::All, SceneTextureParameters);
@@ -360,8 +367,6 @@ void FDeferredShadingSceneRenderer::RenderVelocitiesInner(FRHICommandListImmedia
 
 			SetVelocitiesState(RHICmdList, View, this, DrawRenderState, VelocityRT, VelocityPass);
 
-			const EMeshPass::Type MeshPass = GetMeshPassFromVelocityPass(VelocityPass);
-
 			View.ParallelMeshDrawCommandPasses[MeshPass].DispatchDraw(nullptr, RHICmdList);
 		}
 	}
@@ -409,6 +414,32 @@ void FDeferredShadingSceneRenderer::RenderVelocities(FRHICommandListImmediate& R
 		return;
 	}
 
+	// If the base pass already wrote and cleared the velocity buffer (bClearVelocityRT is false)
+	// and no view has anything left for this pass, the whole opaque pass is a no-op; skip the
+	// renderpass setup and resolve. When a clear is still needed we fall through and only the
+	// per-view dispatches are skipped. The translucent pass is not skipped wholesale because it
+	// also transitions scene depth for downstream reads.
+	if (!bClearVelocityRT && VelocityPass == EVelocityPass::Opaque)
+	{
+		const EMeshPass::Type MeshPass = GetMeshPassFromVelocityPass(VelocityPass);
+		bool bHasAnyDraw = false;
+		for (const FViewInfo& View : Views)
+		{
+			bHasAnyDraw |= View.ParallelMeshDrawCommandPasses[MeshPass].HasAnyDraw();
+		}
+
+		if (!bHasAnyDraw)
+		{
+			// FinishGBufferPassAndResolve skips the velocity target under selective outputs,
+			// expecting this pass to resolve it; still do that even though nothing was drawn.
+			if (VelocityRT)
+			{
+				RHICmdList.CopyToResolveTarget(VelocityRT->GetRenderTargetItem().TargetableTexture, VelocityRT->GetRenderTargetItem().ShaderResourceTexture, FResolveParams());
+			}
+			return;
+		}
+	}
+
 	SCOPED_DRAW_EVENT(RHICmdList, RenderVelocities);
 	SCOPED_GPU_STAT(RHICmdList, RenderVelocities);
 
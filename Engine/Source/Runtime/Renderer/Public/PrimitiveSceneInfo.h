@@ -218,6 +218,11 @@ public:
 	/** The render proxy for the primitive. */
 	FPrimitiveSceneProxy* Proxy;
 
+	/** Relevance computed once at AddToScene for proxies declaring HasViewIndependentRelevance; reused by the relevance pass instead of the per-view virtual call. */
+	FPrimitiveViewRelevance CachedViewIndependentRelevance;
+	/** True when CachedViewIndependentRelevance is valid for this proxy. */
+	bool bHasCachedViewIndependentRelevance = false;
+
 	/** 
 	 * Id for the component this primitive belongs to.  
 	 * This will stay the same for the lifetime of the component, so it can be used to identify the component across re-registers.
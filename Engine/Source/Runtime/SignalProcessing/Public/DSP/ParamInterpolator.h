@@ -60,6 +60,12 @@ namespace Audio
 			return CurrentValue;
 		}
 
+		// Returns whether the value is still interpolating toward its target.
+		FORCEINLINE bool IsRamping() const
+		{
+			return DeltaValue != 0.0f;
+		}
+
 	private:
 		float CurrentValue;
 		float StartingValue;
@@ -1114,6 +1114,12 @@ static void PrepassWindowAndChildren( TSharedRef<SWindow> WindowToPrepass )
 	}
 }
 
+// Note on parallelizing this and the paint traversal below: window and invalidation-root
+// subtrees look independent, but widget attributes are arbitrary game-thread delegates,
+// painting pushes through shared application state (hittest grids, cursor queries, the
+// FScopedSwitchWorldHack world switch), and UMG widgets assume the game thread throughout.
+// Fanning subtrees out to workers therefore needs a thread-safety contract on SWidget
+// first; until then the wins here come from the invalidation fast path culling traversal.
 void FSlateApplication::DrawPrepass( TSharedPtr<SWindow> DrawOnlyThisWindow )
 {
 	SCOPED_NAMED_EVENT_TEXT("Slate::Prepass", FColor::Magenta);
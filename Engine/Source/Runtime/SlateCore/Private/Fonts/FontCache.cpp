@@ -956,6 +956,17 @@ bool FSlateFontCache::AddNewEntry( const FCharacterRenderData InRenderData, uint
 	return NewSlot != nullptr;
 }
 
+void FSlateFontCache::PrecacheText( const FString& InText, const FSlateFontInfo& InFontInfo, const float InFontScale )
+{
+	// Shaping populates the face/kerning caches; fetching each glyph's atlas data rasterizes it
+	// into the atlas pages, which is the expensive first-use work we want off the critical frame.
+	FShapedGlyphSequenceRef ShapedText = ShapeBidirectionalText( InText, InFontInfo, InFontScale, TextBiDi::ETextDirection::LeftToRight, GetDefaultTextShapingMethod() );
+	for ( const FShapedGlyphEntry& ShapedGlyph : ShapedText->GetGlyphsToRender() )
+	{
+		GetShapedGlyphFontAtlasData( ShapedGlyph, InFontInfo.OutlineSettings );
+	}
+}
+
 FShapedGlyphSequenceRef FSlateFontCache::ShapeBidirectionalText( const FString& InText, const FSlateFontInfo &InFontInfo, const float InFontScale, const TextBiDi::ETextDirection InBaseDirection, const ETextShapingMethod InTextShapingMethod ) const
 {
 	return ShapeBidirectionalText(*InText, 0, InText.Len(), InFontInfo, InFontScale, InBaseDirection, InTextShapingMethod);
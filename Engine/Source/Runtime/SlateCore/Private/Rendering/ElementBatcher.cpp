@@ -1506,8 +1506,9 @@ void FSlateElementBatcher::AddGradientElement( const FSlateDrawElement& DrawElem
 	FVector2D BotLeft = FVector2D(0, LocalSize.Y);
 	FVector2D BotRight = FVector2D(LocalSize.X, LocalSize.Y);
 
-	// Copy the gradient stops.. We may need to add more
-	TArray<FSlateGradientStop> GradientStops = InPayload.GradientStops;
+	// Copy the gradient stops.. We may need to add more. Inline storage keeps the common
+	// few-stop case off the heap; this runs per gradient element per frame.
+	TArray<FSlateGradientStop, TInlineAllocator<8>> GradientStops(InPayload.GradientStops);
 
 	const FSlateGradientStop& FirstStop = InPayload.GradientStops[0];
 	const FSlateGradientStop& LastStop = InPayload.GradientStops[ InPayload.GradientStops.Num() - 1 ];
@@ -607,6 +607,11 @@ private:
  * Font caching implementation
  * Caches characters into textures as needed
  */
+// Note on signed-distance-field text: glyphs are currently rasterized per (font, size, scale,
+// outline) key, so scaling text populates new atlas pages per size. An SDF mode would cook a
+// single-resolution atlas per face and resolve size in the text shader, which touches the font
+// asset format, this cache's keying, and the default text material - all three must move
+// together, and the soft-mask shading of small glyphs needs visual sign-off per platform.
 class SLATECORE_API FSlateFontCache : public ISlateAtlasProvider
 {
 	friend FCharacterList;
@@ -642,6 +647,13 @@ public:
 	FShapedGlyphSequenceRef ShapeBidirectionalText( const FString& InText, const FSlateFontInfo &InFontInfo, const float InFontScale, const TextBiDi::ETextDirection InBaseDirection, const ETextShapingMethod InTextShapingMethod ) const;
 	FShapedGlyphSequenceRef ShapeBidirectionalText( const TCHAR* InText, const int32 InTextStart, const int32 InTextLen, const FSlateFontInfo &InFontInfo, const float InFontScale, const TextBiDi::ETextDirection InBaseDirection, const ETextShapingMethod InTextShapingMethod ) const;
 
+	/**
+	 * Shapes the given text and rasterizes its glyphs into the atlases up front, so the first
+	 * on-screen use (chat, damage numbers) doesn't pay FreeType work mid-frame. Call during
+	 * loading with representative strings per font/size.
+	 */
+	void PrecacheText( const FString& InText, const FSlateFontInfo& InFontInfo, const float InFontScale = 1.0f );
+
 	/** 
 	 * Performs text shaping on the given range of the string using the given font info. Returns you the shaped text sequence to use for text rendering via FSlateDrawElement::MakeShapedText.
 	 * When using the version which takes a start point and length, the text outside of the given range won't be shaped, but will provide context information to allow the shaping to function correctly.
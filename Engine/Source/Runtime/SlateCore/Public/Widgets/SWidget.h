@@ -1117,6 +1117,10 @@ public:
 	/** @param InTransform the render transform to set for the widget (transforms from widget's local space). TOptional<> to allow code to skip expensive overhead if there is no render transform applied. */
 	FORCEINLINE void SetRenderTransform(TAttribute<TOptional<FSlateRenderTransform>> InTransform)
 	{
+		// Render transforms do not affect desired size, but both invalidation paths currently
+		// need the Layout flag: the legacy element-list caches dirty off it, and the fast path
+		// routes RenderTransform through the same desired-size/parent processing. A transform-only
+		// update that just patches cached geometry requires teaching both paths first.
 		SetAttribute(RenderTransform, InTransform, EInvalidateWidgetReason::Layout | EInvalidateWidgetReason::RenderTransform);
 	}
 
@@ -554,6 +554,11 @@ bool ISocketSubsystem::IsSocketRecvMultiSupported() const
 	return false;
 }
 
+bool ISocketSubsystem::IsSocketSendMultiSupported() const
+{
+	return false;
+}
+
 double ISocketSubsystem::TranslatePacketTimestamp(const FPacketTimestamp& Timestamp,
 													ETimestampTranslation Translation/*=ETimestampTranslation::LocalTimestamp*/)
 {
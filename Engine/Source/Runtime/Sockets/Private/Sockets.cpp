@@ -37,6 +37,18 @@ bool FSocket::SendTo(const uint8* Data, int32 Count, int32& BytesSent, const FIn
 }
 
 
+int32 FSocket::SendToMulti(FSendToPacket* Packets, int32 NumPackets)
+{
+	int32 NumSent = 0;
+	for (int32 PacketIndex = 0; PacketIndex < NumPackets; ++PacketIndex)
+	{
+		FSendToPacket& Packet = Packets[PacketIndex];
+		Packet.bSuccess = Packet.Destination != nullptr && SendTo(Packet.Data, Packet.Count, Packet.BytesSent, *Packet.Destination);
+		NumSent += Packet.bSuccess ? 1 : 0;
+	}
+	return NumSent;
+}
+
 bool FSocket::Send(const uint8* Data, int32 Count, int32& BytesSent)
 {
 //	NETWORK_PROFILER(GNetworkProfiler.TrackSocketSend(this,Data,BytesSent));
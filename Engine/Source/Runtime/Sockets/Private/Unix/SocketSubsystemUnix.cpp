@@ -217,6 +217,15 @@ bool FSocketSubsystemUnix::IsSocketRecvMultiSupported() const
 	return false;
 }
 
+bool FSocketSubsystemUnix::IsSocketSendMultiSupported() const
+{
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_RECVMMSG
+	return true;
+#endif
+
+	return false;
+}
+
 double FSocketSubsystemUnix::TranslatePacketTimestamp(const FPacketTimestamp& Timestamp, ETimestampTranslation Translation)
 {
 	double ReturnVal = 0.0;
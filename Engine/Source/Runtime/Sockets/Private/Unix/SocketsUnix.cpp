@@ -142,6 +142,61 @@ bool FSocketUnix::RecvMulti(FRecvMulti& MultiData, ESocketReceiveFlags::Type Fla
 	return bSuccess;
 }
 
+// NOTE: sendmmsg shipped alongside recvmmsg on the kernels we support, so it shares the feature define.
+int32 FSocketUnix::SendToMulti(FSendToPacket* Packets, int32 NumPackets)
+{
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_RECVMMSG
+	if (NumPackets <= 0)
+	{
+		return 0;
+	}
+
+	TArray<mmsghdr, TInlineAllocator<64>> Headers;
+	TArray<iovec, TInlineAllocator<64>> BufferMaps;
+	Headers.AddZeroed(NumPackets);
+	BufferMaps.AddZeroed(NumPackets);
+
+	for (int32 PacketIndex = 0; PacketIndex < NumPackets; ++PacketIndex)
+	{
+		FSendToPacket& Packet = Packets[PacketIndex];
+		Packet.bSuccess = false;
+		Packet.BytesSent = 0;
+
+		FInternetAddrBSD* BSDAddr = const_cast<FInternetAddrBSD*>(static_cast<const FInternetAddrBSD*>(Packet.Destination));
+		check(BSDAddr != nullptr);
+
+		iovec& BufferMap = BufferMaps[PacketIndex];
+		BufferMap.iov_base = const_cast<uint8*>(Packet.Data);
+		BufferMap.iov_len = Packet.Count;
+
+		mmsghdr& Header = Headers[PacketIndex];
+		Header.msg_hdr.msg_name = BSDAddr->GetRawAddr();
+		Header.msg_hdr.msg_namelen = BSDAddr->GetStorageSize();
+		Header.msg_hdr.msg_iov = &BufferMap;
+		Header.msg_hdr.msg_iovlen = 1;
+	}
+
+	// sendmmsg stops at the first failing packet and reports how many went through,
+	// which gives the per-packet accounting the API promises.
+	const int NumPacketsSent = sendmmsg(Socket, Headers.GetData(), NumPackets, 0);
+
+	for (int32 PacketIndex = 0; PacketIndex < NumPacketsSent; ++PacketIndex)
+	{
+		Packets[PacketIndex].BytesSent = Headers[PacketIndex].msg_len;
+		Packets[PacketIndex].bSuccess = true;
+	}
+
+	if (NumPacketsSent > 0)
+	{
+		LastActivityTime = FPlatformTime::Seconds();
+	}
+
+	return FMath::Max(0, (int32)NumPacketsSent);
+#else
+	return FSocketBSD::SendToMulti(Packets, NumPackets);
+#endif
+}
+
 bool FSocketUnix::SetRetrieveTimestamp(bool bRetrieveTimestamp)
 {
 	bool bSuccess = false;
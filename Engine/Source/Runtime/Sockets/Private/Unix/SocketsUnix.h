@@ -55,5 +55,6 @@ public:
 	}
 
 	virtual bool RecvMulti(FRecvMulti& MultiData, ESocketReceiveFlags::Type Flags) override;
+	virtual int32 SendToMulti(FSendToPacket* Packets, int32 NumPackets) override;
 	virtual bool SetRetrieveTimestamp(bool bRetrieveTimestamp) override;
 };
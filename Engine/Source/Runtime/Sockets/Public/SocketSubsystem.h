@@ -409,6 +409,11 @@ public:
 	 */
 	virtual bool IsSocketRecvMultiSupported() const;
 
+	/**
+	 * Returns true if FSocket::SendToMulti batches sends into one syscall on this socket subsystem
+	 */
+	virtual bool IsSocketSendMultiSupported() const;
+
 
 	/**
 	 * Returns true if FSocket::Wait is supported by this socket subsystem.
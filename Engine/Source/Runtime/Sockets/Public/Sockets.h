@@ -176,6 +176,29 @@ public:
 	 */
 	virtual bool SendTo(const uint8* Data, int32 Count, int32& BytesSent, const FInternetAddr& Destination);
 
+	/**
+	 * One datagram for SendToMulti. BytesSent and bSuccess are filled out per packet, so callers
+	 * can retry or account for individual failures after a batched send.
+	 */
+	struct FSendToPacket
+	{
+		const uint8* Data = nullptr;
+		int32 Count = 0;
+		const FInternetAddr* Destination = nullptr;
+		int32 BytesSent = 0;
+		bool bSuccess = false;
+	};
+
+	/**
+	 * Sends a batch of datagrams, collapsing them into one syscall where the platform supports it
+	 * (see ISocketSubsystem::IsSocketSendMultiSupported). The base implementation loops over SendTo.
+	 *
+	 * @param Packets The datagrams to send; per-packet results are written back into the array.
+	 * @param NumPackets The number of entries in Packets.
+	 * @return The number of packets sent successfully.
+	 */
+	virtual int32 SendToMulti(FSendToPacket* Packets, int32 NumPackets);
+
 	/**
 	 * Sends a buffer on a connected socket.
 	 *
@@ -14,6 +14,7 @@ namespace Private
 ////////////////////////////////////////////////////////////////////////////////
 bool	Writer_SendTo(const ANSICHAR*);
 bool	Writer_WriteTo(const ANSICHAR*);
+bool	Writer_WriteSnapshotTo(const ANSICHAR*);
 uint32	Writer_EventToggle(const ANSICHAR*, bool);
 
 } // namespace Private
@@ -50,6 +51,14 @@ bool WriteTo(const TCHAR* InPath)
 	return Private::Writer_WriteTo(Path);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+bool WriteSnapshotTo(const TCHAR* InPath)
+{
+	char Path[512];
+	ToAnsiCheap(Path, InPath);
+	return Private::Writer_WriteSnapshotTo(Path);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 uint32 ToggleEvent(const TCHAR* Wildcard, bool bState)
 {
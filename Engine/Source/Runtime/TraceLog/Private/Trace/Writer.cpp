@@ -331,6 +331,7 @@ static FHoldBuffer		GHoldBuffer;		// will init to zero.
 static UPTRINT			GDataHandle;		// = 0
 static EDataState		GDataState;			// = EDataState::Passive
 UPTRINT					GPendingDataHandle;	// = 0
+static UPTRINT volatile	GPendingSnapshotHandle;	// = 0; flight-recorder snapshot request, consumed by the worker
 
 ////////////////////////////////////////////////////////////////////////////////
 static void Writer_ConsumeEvents()
@@ -470,6 +471,32 @@ static void Writer_ConsumeEvents()
 ////////////////////////////////////////////////////////////////////////////////
 static void Writer_UpdateData()
 {
+	// Flight-recorder snapshot: dump the passively held data to the requested handle without
+	// attaching a live sink, so collection continues afterwards. The hold buffer is only
+	// touched from this thread, which is why the handle is handed off rather than written at
+	// the call site. The buffer retains the stream prefix from boot (event definitions are
+	// emitted inline on first use, so the prefix is what keeps a snapshot decodable).
+	if (UPTRINT SnapshotHandle = AtomicLoadRelaxed(&GPendingSnapshotHandle))
+	{
+		AtomicStoreRelease(&GPendingSnapshotHandle, UPTRINT(0));
+
+		const uint32 Magic = 'TRCE';
+		bool bOk = IoWrite(SnapshotHandle, &Magic, sizeof(Magic));
+
+		const struct {
+			uint8 Format;
+			uint8 Parameter;
+		} TransportHeader = { 2 };
+		bOk &= IoWrite(SnapshotHandle, &TransportHeader, sizeof(TransportHeader));
+
+		if (bOk && GDataState != EDataState::Sending && GHoldBuffer->GetSize())
+		{
+			IoWrite(SnapshotHandle, GHoldBuffer->GetData(), GHoldBuffer->GetSize());
+		}
+
+		IoClose(SnapshotHandle);
+	}
+
 	if (GPendingDataHandle)
 	{
 		// Reject the pending connection if we've already got a connection
@@ -937,6 +964,33 @@ bool Writer_WriteTo(const ANSICHAR* Path)
 	return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+bool Writer_WriteSnapshotTo(const ANSICHAR* Path)
+{
+	Writer_Initialize();
+
+	// Nothing to snapshot once a live sink drains events as they are produced.
+	if (GDataState == EDataState::Sending)
+	{
+		return false;
+	}
+
+	// One snapshot in flight at a time.
+	if (AtomicLoadRelaxed(&GPendingSnapshotHandle))
+	{
+		return false;
+	}
+
+	UPTRINT SnapshotHandle = FileOpen(Path);
+	if (!SnapshotHandle)
+	{
+		return false;
+	}
+
+	AtomicStoreRelease(&GPendingSnapshotHandle, SnapshotHandle);
+	return true;
+}
+
 
 
 ////////////////////////////////////////////////////////////////////////////////
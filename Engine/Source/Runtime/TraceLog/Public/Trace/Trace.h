@@ -9,8 +9,18 @@
 namespace Trace
 {
 
+// Flight-recorder support: until a sink attaches, events collect passively into a fixed-size
+// in-memory hold buffer, and WriteSnapshotTo dumps that buffer to a file on demand (fault
+// handler, bug report) without interrupting collection. The hold region keeps the stream
+// prefix from boot rather than a trailing ring because event definitions are emitted inline
+// on first use - dropping the prefix would make the snapshot undecodable.
+
 UE_TRACE_API bool	SendTo(const TCHAR* Host) UE_TRACE_IMPL(false);
 UE_TRACE_API bool	WriteTo(const TCHAR* Path) UE_TRACE_IMPL(false);
+/** Flight-recorder snapshot: dumps the passively collected in-memory event data to a file without
+	attaching a live sink, so collection continues afterwards. For fault handlers and bug reports in
+	builds that run untethered. Fails if a live sink is attached or a snapshot is already pending. */
+UE_TRACE_API bool	WriteSnapshotTo(const TCHAR* Path) UE_TRACE_IMPL(false);
 UE_TRACE_API uint32 ToggleEvent(const TCHAR* Wildcard, bool bState) UE_TRACE_IMPL(false);
 
 } // namespace Trace
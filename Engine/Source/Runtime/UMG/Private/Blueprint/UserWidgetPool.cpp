@@ -34,6 +34,8 @@ void FUserWidgetPool::Release(UUserWidget* Widget, bool bReleaseSlate)
 {
 	if (Widget != nullptr)
 	{
+		// Note: active order is meaningful - entry boxes rebuild children from it - so removal
+		// must stay order-preserving here.
 		const int32 ActiveWidgetIdx = ActiveWidgets.Find(Widget);
 		if (ActiveWidgetIdx != INDEX_NONE)
 		{
@@ -50,10 +52,29 @@ void FUserWidgetPool::Release(UUserWidget* Widget, bool bReleaseSlate)
 
 void FUserWidgetPool::Release(TArray<UUserWidget*> Widgets, bool bReleaseSlate)
 {
-	for (UUserWidget* Widget : Widgets)
+	if (Widgets.Num() == 0)
 	{
-		Release(Widget, bReleaseSlate);
+		return;
 	}
+
+	// Releasing one-by-one is a find-and-shift per widget, which turns clearing a large grid
+	// quadratic. Do it in one order-preserving pass instead.
+	TSet<UUserWidget*> WidgetsToRelease;
+	WidgetsToRelease.Append(Widgets);
+
+	ActiveWidgets.RemoveAll([this, &WidgetsToRelease, bReleaseSlate](UUserWidget* ActiveWidget)
+	{
+		if (WidgetsToRelease.Contains(ActiveWidget))
+		{
+			InactiveWidgets.Push(ActiveWidget);
+			if (bReleaseSlate)
+			{
+				CachedSlateByWidgetObject.Remove(ActiveWidget);
+			}
+			return true;
+		}
+		return false;
+	});
 }
 
 void FUserWidgetPool::ReleaseAll(bool bReleaseSlate)
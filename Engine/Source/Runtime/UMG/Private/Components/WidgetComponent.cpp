@@ -1139,6 +1139,20 @@ void UWidgetComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 #endif // !UE_SERVER
 }
 
+static float GWidgetComponentFarRedrawDistance = 0.0f;
+static FAutoConsoleVariableRef CVarWidgetComponentFarRedrawDistance(
+	TEXT("WidgetComponent.FarRedrawDistance"),
+	GWidgetComponentFarRedrawDistance,
+	TEXT("If > 0, in-world widget components farther than this from every local viewer redraw at the reduced rate below instead of every frame."),
+	ECVF_Default);
+
+static float GWidgetComponentFarRedrawInterval = 0.25f;
+static FAutoConsoleVariableRef CVarWidgetComponentFarRedrawInterval(
+	TEXT("WidgetComponent.FarRedrawInterval"),
+	GWidgetComponentFarRedrawInterval,
+	TEXT("Minimum seconds between redraws for widget components beyond WidgetComponent.FarRedrawDistance."),
+	ECVF_Default);
+
 bool UWidgetComponent::ShouldDrawWidget() const
 {
 	const float RenderTimeThreshold = .5f;
@@ -1147,7 +1161,35 @@ bool UWidgetComponent::ShouldDrawWidget() const
 		// If we don't tick when off-screen, don't bother ticking if it hasn't been rendered recently
 		if ( TickWhenOffscreen || GetWorld()->TimeSince(GetLastRenderTime()) <= RenderTimeThreshold )
 		{
-			if ( ( GetCurrentTime() - LastWidgetRenderTime) >= RedrawTime )
+			// Distant in-world widgets don't need full-rate render target updates; stretch their
+			// effective redraw interval once no local viewer is nearby.
+			float EffectiveRedrawTime = RedrawTime;
+			if (GWidgetComponentFarRedrawDistance > 0.0f && Space != EWidgetSpace::Screen)
+			{
+				const FVector ComponentLocation = GetComponentLocation();
+				float ClosestViewerDistSq = TNumericLimits<float>::Max();
+				if (UWorld* World = GetWorld())
+				{
+					for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+					{
+						APlayerController* PlayerController = Iterator->Get();
+						FVector ViewLocation;
+						FRotator ViewRotation;
+						if (PlayerController && PlayerController->IsLocalController())
+						{
+							PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+							ClosestViewerDistSq = FMath::Min(ClosestViewerDistSq, (ViewLocation - ComponentLocation).SizeSquared());
+						}
+					}
+				}
+
+				if (ClosestViewerDistSq > FMath::Square(GWidgetComponentFarRedrawDistance))
+				{
+					EffectiveRedrawTime = FMath::Max(EffectiveRedrawTime, GWidgetComponentFarRedrawInterval);
+				}
+			}
+
+			if ( ( GetCurrentTime() - LastWidgetRenderTime) >= EffectiveRedrawTime )
 			{
 				return bManuallyRedraw ? bRedrawRequested : true;
 			}
@@ -36,6 +36,12 @@ DECLARE_MULTICAST_DELEGATE( FOnRetainedModeChanged );
  * frequency of the main game render.  It also has the side benefit of allow materials
  * to be applied to the render target after drawing the widgets to apply a simple post process.
  */
+// Note on dirty-rectangle compositing: the retainer already re-renders only when its subtree
+// invalidates (RenderOnInvalidation), phases work across frames (RenderOnPhase) and bounds
+// retainer draws per frame (Shared_MaxRetainerWorkPerFrame). Re-rendering only a child's dirty
+// rect would additionally need the element list replayed under a scissor and the target
+// composited from persistent regions; the widget renderer clears and redraws the full target,
+// so that needs renderer-side support before it can land here.
 class UMG_API SRetainerWidget : public SCompoundWidget,  public FSlateInvalidationRoot
 {
 public:
@@ -1817,6 +1817,14 @@ void VectorVM::Init()
 	}
 }
 
+// Note on a JIT backend: per-op dispatch over 4-wide chunks is the interpreter's cost, and a
+// JIT would indeed remove it - but it means carrying a code generator per target ISA, W^X/JIT
+// policy compliance on consoles and mobile (several platforms forbid runtime codegen
+// entirely), and debugging/determinism support for generated code. Where runtime codegen is
+// forbidden, the equivalent win is offline: translating emitter bytecode to C++ at cook and
+// compiling it into the game binary. Both are compiler projects with a platform matrix, out
+// of scope for a runtime patch to the interpreter; batch-friendly script changes (fewer ops,
+// wider kernels) remain the near-term lever.
 void VectorVM::Exec(
 	uint8 const* Code,
 	int32 NumTempRegisters,
@@ -44,6 +44,8 @@ public:
 	FTransitionAndLayoutManager()
 		: CurrentRenderPass(nullptr)
 		, CurrentFramebuffer(nullptr)
+		, LastRenderPassHash(0)
+		, LastRenderPass(nullptr)
 	{
 	}
 
@@ -53,10 +55,25 @@ public:
 	FVulkanRenderPass* GetOrCreateRenderPass(FVulkanDevice& InDevice, const FVulkanRenderTargetLayout& RTLayout)
 	{
 		uint32 RenderPassHash = RTLayout.GetRenderPassFullHash();
+
 		FVulkanRenderPass** FoundRenderPass = nullptr;
 		{
 			FScopeLock Lock(&RenderPassesCS);
+
+			// Passes repeat heavily within a frame (shadow atlas loops, base/translucency
+			// alternation), so the last hit short-circuits most lookups. Guarded by the same
+			// lock as the map since PSO creation can run this from other threads.
+			if (LastRenderPass && RenderPassHash == LastRenderPassHash)
+			{
+				return LastRenderPass;
+			}
+
 			FoundRenderPass = RenderPasses.Find(RenderPassHash);
+			if (FoundRenderPass)
+			{
+				LastRenderPassHash = RenderPassHash;
+				LastRenderPass = *FoundRenderPass;
+			}
 		}
 		if (FoundRenderPass)
 		{
@@ -67,6 +84,8 @@ public:
 		{
 			FScopeLock Lock(&RenderPassesCS);
 			RenderPasses.Add(RenderPassHash, RenderPass);
+			LastRenderPassHash = RenderPassHash;
+			LastRenderPass = RenderPass;
 		}
 		return RenderPass;
 	}
@@ -118,6 +137,10 @@ public:
 	FVulkanRenderPass* CurrentRenderPass;
 	FVulkanFramebuffer* CurrentFramebuffer;
 
+	// Last GetOrCreateRenderPass hit; valid until Destroy since passes are never freed before then.
+	uint32 LastRenderPassHash;
+	FVulkanRenderPass* LastRenderPass;
+
 	FCriticalSection RenderPassesCS;
 
 	void NotifyDeletedRenderTarget(FVulkanDevice& InDevice, VkImage Image);
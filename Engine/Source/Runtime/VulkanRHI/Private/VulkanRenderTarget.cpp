@@ -56,6 +56,9 @@ void FTransitionAndLayoutManager::Destroy(FVulkanDevice& InDevice, FTransitionAn
 {
 	check(!GIsRHIInitialized);
 
+	LastRenderPassHash = 0;
+	LastRenderPass = nullptr;
+
 	if (Immediate)
 	{
 		Immediate->RenderPasses.Append(RenderPasses);
@@ -27,6 +27,18 @@ enum
 #endif
 };
 
+static int32 GVulkanUBRecycleCacheMB = 4;
+static FAutoConsoleVariableRef CVarVulkanUBRecycleCacheMB(
+	TEXT("r.Vulkan.UniformBufferRecycleCacheMB"),
+	GVulkanUBRecycleCacheMB,
+	TEXT("Size in MB of the cache that recycles expired uniform buffer suballocations instead of freeing them,\n")
+	TEXT("avoiding pooled allocator work on the hot single-frame creation path (0 to disable)."),
+	ECVF_RenderThreadSafe
+);
+
+DECLARE_MEMORY_STAT(TEXT("Uniform Buffer Recycle Cache"), STAT_VulkanUBRecycleCache, STATGROUP_VulkanRHI);
+DECLARE_MEMORY_STAT(TEXT("Uniform Buffer Recycle Cache Peak"), STAT_VulkanUBRecycleCachePeak, STATGROUP_VulkanRHI);
+
 #if UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT
 constexpr EUniformBufferValidation UniformBufferValidation = EUniformBufferValidation::ValidateResources;
 #else
@@ -372,13 +384,61 @@ namespace VulkanRHI
 {
 	VulkanRHI::FBufferSuballocation* FResourceHeapManager::AllocUniformBuffer(uint32 Size, const void* Contents)
 	{
-		VulkanRHI::FBufferSuballocation* OutAlloc = Device->GetResourceHeapManager().AllocateBuffer(Size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, __FILE__, __LINE__);
+		VulkanRHI::FBufferSuballocation* OutAlloc = nullptr;
+
+		// Uniform buffer sizes repeat per layout, so a small cache of expired suballocations
+		// satisfies most single-frame creations without touching the pooled allocator. Suballocation
+		// sizes were rounded up to their pool bucket by AllocateBuffer, so match on the bucketed size.
+		if (GVulkanUBRecycleCacheMB > 0)
+		{
+			const uint32 Alignment = FMath::Max(1u, (uint32)Device->GetLimits().minUniformBufferOffsetAlignment);
+			const int32 PoolSize = (int32)GetPoolTypeForAlloc(Size, Alignment);
+			const uint32 BucketedSize = (PoolSize != (int32)EPoolSizes::SizesCount) ? PoolSizes[PoolSize] : Size;
+
+			FScopeLock ScopeLock(&UBAllocations.CS);
+			for (int32 Index = UBAllocations.Recycled.Num() - 1; Index >= 0; --Index)
+			{
+				VulkanRHI::FBufferSuballocation* Candidate = UBAllocations.Recycled[Index];
+				if (Candidate->GetSize() == BucketedSize)
+				{
+					OutAlloc = Candidate;
+					UBAllocations.Recycled.RemoveAtSwap(Index, 1, false);
+					UBAllocations.RecycledBytes -= BucketedSize;
+					DEC_MEMORY_STAT_BY(STAT_VulkanUBRecycleCache, BucketedSize);
+					break;
+				}
+			}
+		}
+
+		if (!OutAlloc)
+		{
+			OutAlloc = Device->GetResourceHeapManager().AllocateBuffer(Size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, __FILE__, __LINE__);
+		}
+
 		FMemory::Memcpy(OutAlloc->GetMappedPointer(), Contents, Size);
 		OutAlloc->Flush();
 
 		return OutAlloc;
 	}
 
+	void FResourceHeapManager::RecycleOrDeleteUBNoLock(VulkanRHI::FBufferSuballocation* Allocation)
+	{
+		const uint64 CacheCapacity = (uint64)GVulkanUBRecycleCacheMB * 1024 * 1024;
+		const uint32 Size = Allocation->GetSize();
+		if (UBAllocations.RecycledBytes + Size <= CacheCapacity)
+		{
+			UBAllocations.Recycled.Add(Allocation);
+			UBAllocations.RecycledBytes += Size;
+			UBAllocations.RecycledBytesPeak = FMath::Max(UBAllocations.RecycledBytesPeak, UBAllocations.RecycledBytes);
+			INC_MEMORY_STAT_BY(STAT_VulkanUBRecycleCache, Size);
+			SET_MEMORY_STAT(STAT_VulkanUBRecycleCachePeak, UBAllocations.RecycledBytesPeak);
+		}
+		else
+		{
+			delete Allocation;
+		}
+	}
+
 	void FResourceHeapManager::ReleaseUniformBuffer(VulkanRHI::FBufferSuballocation* UBAlloc)
 	{
 		checkSlow(UBAlloc);
@@ -408,6 +468,14 @@ namespace VulkanRHI
 			}
 			UBAllocations.PendingFree.Empty();
 
+			for (VulkanRHI::FBufferSuballocation* Recycled : UBAllocations.Recycled)
+			{
+				delete Recycled;
+			}
+			UBAllocations.Recycled.Empty();
+			DEC_MEMORY_STAT_BY(STAT_VulkanUBRecycleCache, UBAllocations.RecycledBytes);
+			UBAllocations.RecycledBytes = 0;
+
 			// invalidate the value
 			GFrameNumberRenderThread_WhenWeCanDelete = 0;
 		}
@@ -428,7 +496,7 @@ namespace VulkanRHI
 				FUBPendingFree& Alloc = UBAllocations.PendingFree[Index];
 				if (LIKELY(Alloc.Frame < OldestFrameToKeep))
 				{
-					delete Alloc.Allocation;
+					RecycleOrDeleteUBNoLock(Alloc.Allocation);
 				}
 				else
 				{
@@ -967,8 +967,13 @@ namespace VulkanRHI
 			FCriticalSection CS;
 			TArray<FUBPendingFree> PendingFree;
 			uint32 Peak = 0;
+			// Expired pending frees are parked here for reuse instead of being deleted; see AllocUniformBuffer.
+			TArray<FBufferSuballocation*> Recycled;
+			uint64 RecycledBytes = 0;
+			uint64 RecycledBytesPeak = 0;
 		} UBAllocations;
 
+		void RecycleOrDeleteUBNoLock(FBufferSuballocation* Allocation);
 		void ProcessPendingUBFreesNoLock(bool bForce);
 		void ProcessPendingUBFrees(bool bForce);
 	};